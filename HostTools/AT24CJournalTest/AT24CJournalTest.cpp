@@ -0,0 +1,637 @@
+/*
+*	AT24CJournalTest.cpp, Copyright Jonathan Mackey 2023
+*	Tests AT24CJournal against a simulated AT24C64.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	The journal, AT24C and I2CQueue are the library code.  Wire is replaced
+*	by a simulated AT24C64 backed by RAM.  Like the real chip it ignores its
+*	address while completing a write, and it can be made to lose power
+*	partway through a write.  The record is the sketch's cut record.  The
+*	scenarios are:
+*
+*	- wrap: appends across several laps of the region, checks that every
+*	  slot was written the same number of times and that a reload continues
+*	  from the newest record.
+*	- boot: for journals filled to either side of each lap boundary, checks
+*	  that Load finds the newest record and only reads the sequence numbers
+*	  of log2(slots) + 1 slots.
+*	- recent: ReadRecent returns the last N records newest first.
+*	- torn: power is lost partway through a record.  After a reboot the
+*	  partial record is ignored and the next record replaces it.
+*	- crc: a corrupted record is skipped by ReadRecent, a corrupted newest
+*	  record is skipped by Load.
+*	- counters: the lifetime counters continue across reboots the way
+*	  KeyMachineSTM32 restores them from the newest record.
+*
+*	Each scenario prints one line.  The exit status is 0 when all pass.
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -IHostTools/AT24CJournalTest -Ilibraries/AT24C \
+*		-Ilibraries/I2CQueue HostTools/AT24CJournalTest/AT24CJournalTest.cpp \
+*		libraries/AT24C/AT24CJournal.cpp libraries/AT24C/AT24C.cpp \
+*		libraries/I2CQueue/I2CQueue.cpp -o AT24CJournalTest
+*/
+#include "Arduino.h"
+#include <Wire.h>
+#include "I2CQueue.h"
+#include "AT24C.h"
+#include "AT24CJournal.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+*	Same as Config::SCutRecord in the sketch.
+*/
+struct SCutRecord
+{
+	uint32_t	time;
+	uint32_t	completedCuts;
+	uint32_t	abortedCuts;
+	uint16_t	keywayMenuItemTag;
+	uint8_t		pinCount;
+	uint8_t		result;
+	int32_t		pinDepths[8];
+};
+
+static const uint8_t	kDeviceAddr = 0x50;
+static const uint16_t	kCapacity = 8192;		// AT24C64
+static const uint16_t	kPageSize = 32;
+static const uint16_t	kJournalAddr = 256;		// As in the sketch
+static const uint16_t	kJournalLength = kCapacity - kJournalAddr;
+static const uint16_t	kSlotSize = 64;			// For a 48 byte record
+static const uint16_t	kSlots = kJournalLength / kSlotSize;
+static const uint8_t	kWriteCyclePolls = 3;	// NAKs after each write
+
+/*
+*	RAMAT24C is the simulated AT24C64.  TwoWire forwards to it.
+*/
+class RAMAT24C
+{
+public:
+							RAMAT24C(void)
+								{Erase();}
+	void					Erase(void)
+							{
+								memset(mMemory, 0xFF, sizeof(mMemory));
+								memset(mPageWrites, 0, sizeof(mPageWrites));
+								mBusy = 0;
+								mPowerBudget = -1;
+								mSequenceReads = 0;
+							}
+	/*
+	*	LosePowerAfter: The next inBytes data bytes written are stored, after
+	*	that the chip doesn't respond until PowerOn.
+	*/
+	void					LosePowerAfter(
+								int32_t					inBytes)
+								{mPowerBudget = inBytes;}
+	void					PowerOn(void)
+								{mPowerBudget = -1; mBusy = 0;}
+	bool					HasPower(void) const
+								{return(mPowerBudget != 0);}
+	uint8_t*				Memory(void)
+								{return(mMemory);}
+	uint32_t				PageWrites(
+								uint16_t				inPage) const
+								{return(mPageWrites[inPage]);}
+	// Reads of 4 bytes, i.e. AT24CJournal::ReadSequence
+	uint32_t				SequenceReads(void) const
+								{return(mSequenceReads);}
+	void					ResetSequenceReads(void)
+								{mSequenceReads = 0;}
+
+	void					BeginTransmission(void)
+								{mTX.length = 0;}
+	void					Write(
+								uint8_t					inData)
+							{
+								if (mTX.length < sizeof(mTX.data))
+								{
+									mTX.data[mTX.length++] = inData;
+								}
+							}
+	uint8_t					EndTransmission(void);
+	uint8_t					RequestFrom(
+								uint8_t					inLength);
+	int						Read(void)
+								{return(mRXIndex < mRXLength ? mRX[mRXIndex++] : -1);}
+protected:
+	uint8_t		mMemory[kCapacity];
+	uint32_t	mPageWrites[kCapacity/kPageSize];
+	uint16_t	mAddress;
+	uint8_t		mBusy;
+	int32_t		mPowerBudget;	// -1 unlimited
+	uint32_t	mSequenceReads;
+	struct
+	{
+		uint8_t	data[34];
+		uint8_t	length;
+	} mTX;
+	uint8_t		mRX[32];
+	uint8_t		mRXIndex;
+	uint8_t		mRXLength;
+};
+
+/******************************* EndTransmission ******************************/
+/*
+*	Returns 0 for ACK, 2 for address NAK.  The first 2 bytes are the data
+*	address, the rest is data written within the page (the address wraps
+*	to the start of the page like the real chip.)
+*/
+uint8_t RAMAT24C::EndTransmission(void)
+{
+	uint8_t	status = 2;
+	if (!HasPower())
+	{
+	} else if (mBusy)
+	{
+		mBusy--;
+	} else
+	{
+		status = 0;
+		if (mTX.length >= 2)
+		{
+			mAddress = ((mTX.data[0] << 8) | mTX.data[1]) % kCapacity;
+			if (mTX.length > 2)
+			{
+				uint16_t	page = mAddress & ~(kPageSize - 1);
+				mPageWrites[page / kPageSize]++;
+				for (uint8_t i = 2; i < mTX.length && HasPower(); i++)
+				{
+					mMemory[mAddress] = mTX.data[i];
+					mAddress = page + ((mAddress + 1) & (kPageSize - 1));
+					if (mPowerBudget > 0)
+					{
+						mPowerBudget--;
+					}
+				}
+				mBusy = kWriteCyclePolls;
+			}
+		}
+	}
+	return(status);
+}
+
+/********************************* RequestFrom ********************************/
+uint8_t RAMAT24C::RequestFrom(
+	uint8_t	inLength)
+{
+	mRXIndex = 0;
+	mRXLength = 0;
+	if (HasPower() &&
+		!mBusy &&
+		inLength <= sizeof(mRX))
+	{
+		if (inLength == sizeof(uint32_t))
+		{
+			mSequenceReads++;
+		}
+		for (; mRXLength < inLength; mRXLength++)
+		{
+			mRX[mRXLength] = mMemory[mAddress];
+			mAddress = (mAddress + 1) % kCapacity;
+		}
+	}
+	return(mRXLength);
+}
+
+static RAMAT24C	sChip;
+static uint32_t	sMicros;
+TwoWire	Wire;
+
+uint32_t micros(void)
+{
+	return(sMicros += 50);
+}
+
+uint32_t millis(void)
+{
+	return(sMicros / 1000);
+}
+
+// The journal's transactions all start with a transmission (the address
+// header), so this counts the Wire transactions.
+static uint32_t	sTransmissions;
+
+void TwoWire::beginTransmission(
+	uint8_t	inAddress)
+{
+	sTransmissions++;
+	sChip.BeginTransmission();
+}
+
+size_t TwoWire::write(
+	uint8_t	inData)
+{
+	sChip.Write(inData);
+	return(1);
+}
+
+size_t TwoWire::write(
+	const uint8_t*	inData,
+	size_t			inLength)
+{
+	for (size_t i = 0; i < inLength; i++)
+	{
+		sChip.Write(inData[i]);
+	}
+	return(inLength);
+}
+
+uint8_t TwoWire::endTransmission(
+	bool	inSendStop)
+{
+	return(sChip.EndTransmission());
+}
+
+uint8_t TwoWire::requestFrom(
+	uint8_t	inAddress,
+	uint8_t	inLength,
+	uint8_t	inSendStop)
+{
+	return(sChip.RequestFrom(inLength));
+}
+
+int TwoWire::read(void)
+{
+	return(sChip.Read());
+}
+
+static uint32_t	sFailures;
+
+/*********************************** Check ************************************/
+static void Check(
+	bool		inPassed,
+	const char*	inWhat)
+{
+	if (!inPassed)
+	{
+		fprintf(stderr, "  FAILED: %s\n", inWhat);
+		sFailures++;
+	}
+}
+
+/*
+*	Machine is the part of KeyMachineSTM32 that owns the journal.  A new
+*	Machine is a reboot: the queue, AT24C and journal start from scratch and
+*	only the simulated chip's memory remains.
+*/
+class Machine
+{
+public:
+							Machine(void)
+								: mEEPROM(&mQueue, kDeviceAddr, kCapacity/1024),
+								  mJournal(&mEEPROM, kJournalAddr, kJournalLength,
+								  			sizeof(SCutRecord))
+							{
+								memset(&mCutRecord, 0, sizeof(SCutRecord));
+							}
+	/*
+	*	Boot: Same as KeyMachineSTM32::begin, the lifetime counters continue
+	*	from the newest record.
+	*/
+	bool					Boot(void)
+							{
+								bool	loaded = mJournal.Load();
+								if (loaded)
+								{
+									mJournal.ReadRecent(0, &mCutRecord);
+								}
+								return(loaded);
+							}
+	/*
+	*	Cut: Same as KeyMachineSTM32::AppendCutRecord.  inTime identifies
+	*	the record.  The write is done by updating the queue, as in loop().
+	*/
+	void					Cut(
+								uint32_t				inTime,
+								bool					inCompleted = true)
+							{
+								mCutRecord.time = inTime;
+								mCutRecord.result = inCompleted ? 0 : 1;
+								mCutRecord.keywayMenuItemTag = inTime & 0xFFFF;
+								mCutRecord.pinCount = 5 + (inTime & 1);
+								for (uint8_t i = 0; i < 8; i++)
+								{
+									mCutRecord.pinDepths[i] = inTime * 8 + i;
+								}
+								if (inCompleted)
+								{
+									mCutRecord.completedCuts++;
+								} else
+								{
+									mCutRecord.abortedCuts++;
+								}
+								mJournal.Append(&mCutRecord);
+								for (uint16_t i = 0; i < 1000 && !mQueue.IsEmpty(); i++)
+								{
+									uint32_t	transmissions = sTransmissions;
+									mQueue.Update();
+									Check(sTransmissions - transmissions <= 1,
+											"queue: more than one transaction per update");
+								}
+							}
+	/*
+	*	Returns true if the record inIndex from the newest is the one cut at
+	*	inTime.
+	*/
+	bool					IsRecent(
+								uint16_t				inIndex,
+								uint32_t				inTime)
+							{
+								SCutRecord	record;
+								return(mJournal.ReadRecent(inIndex, &record) &&
+										record.time == inTime &&
+										record.keywayMenuItemTag == (inTime & 0xFFFF) &&
+										record.pinDepths[7] == (int32_t)(inTime * 8 + 7));
+							}
+	I2CQueue				mQueue;
+	AT24C					mEEPROM;
+	AT24CJournal			mJournal;
+	SCutRecord				mCutRecord;
+};
+
+/******************************* SlotAddress **********************************/
+static uint16_t SlotAddress(
+	uint32_t	inSequence)
+{
+	return(kJournalAddr + (inSequence % kSlots) * kSlotSize);
+}
+
+/************************************ Wrap ************************************/
+static void Wrap(void)
+{
+	uint32_t	failures = sFailures;
+	const uint32_t	kLaps = 3;
+	sChip.Erase();
+	Machine	machine;
+	Check(!machine.Boot(), "wrap: empty journal loaded");
+	Check(machine.mJournal.Slots() == kSlots, "wrap: slot count");
+	for (uint32_t i = 0; i < kSlots * kLaps; i++)
+	{
+		machine.Cut(i);
+	}
+	/*
+	*	Every slot was written kLaps times, so every page of the region was
+	*	written the same number of times as the first.
+	*/
+	uint32_t	firstPageWrites = sChip.PageWrites(kJournalAddr / kPageSize);
+	bool	even = firstPageWrites != 0;
+	for (uint16_t page = kJournalAddr / kPageSize; page < kCapacity / kPageSize; page += kSlotSize / kPageSize)
+	{
+		even = even && sChip.PageWrites(page) == firstPageWrites;
+	}
+	Check(even, "wrap: slots written unevenly");
+	machine.Cut(kSlots * kLaps);
+	Check(machine.mJournal.Count() == kSlots, "wrap: count");
+	Check(machine.mJournal.Appended() == kSlots * kLaps + 1, "wrap: appended");
+	Check(machine.IsRecent(0, kSlots * kLaps), "wrap: newest record");
+	Check(machine.IsRecent(1, kSlots * kLaps - 1), "wrap: record before the wrap");
+	Machine	rebooted;
+	Check(rebooted.Boot(), "wrap: reload");
+	Check(rebooted.mJournal.Appended() == kSlots * kLaps + 1, "wrap: reload appended");
+	rebooted.Cut(kSlots * kLaps + 1);
+	Check(rebooted.IsRecent(0, kSlots * kLaps + 1) &&
+			rebooted.IsRecent(1, kSlots * kLaps), "wrap: append after reload");
+	printf("wrap: %s, %u laps of %u slots, %u writes per slot page\n",
+			failures == sFailures ? "passed" : "FAILED", kLaps, kSlots, firstPageWrites);
+}
+
+/************************************ Boot ************************************/
+static void Boot(void)
+{
+	uint32_t	failures = sFailures;
+	uint32_t	maxReads = 1;	// Slot 0
+	for (uint16_t slots = kSlots - 1; slots; slots /= 2)
+	{
+		maxReads++;
+	}
+	const uint32_t	kFills[] = {0, 1, 2, kSlots/2, kSlots - 1, kSlots, kSlots + 1,
+							2*kSlots - 1, 2*kSlots, 2*kSlots + kSlots/3, 5*kSlots + 7};
+	uint32_t	mostReads = 0;
+	for (uint32_t fill : kFills)
+	{
+		sChip.Erase();
+		{
+			Machine	machine;
+			for (uint32_t i = 0; i < fill; i++)
+			{
+				machine.Cut(i);
+			}
+		}
+		Machine	machine;
+		sChip.ResetSequenceReads();
+		bool	loaded = machine.Boot();
+		uint32_t	reads = sChip.SequenceReads();
+		if (reads > mostReads)
+		{
+			mostReads = reads;
+		}
+		Check(loaded == (fill != 0), "boot: loaded");
+		Check(machine.mJournal.Appended() == fill, "boot: newest record not found");
+		Check(fill == 0 || machine.IsRecent(0, fill - 1), "boot: newest record");
+		Check(reads <= maxReads, "boot: too many sequence reads");
+	}
+	printf("boot: %s, at most %u of %u sequence reads\n",
+			failures == sFailures ? "passed" : "FAILED", mostReads, maxReads);
+}
+
+/*********************************** Recent ***********************************/
+static void Recent(void)
+{
+	uint32_t	failures = sFailures;
+	const uint32_t	kFills[] = {1, 10, kSlots, kSlots + 10};
+	for (uint32_t fill : kFills)
+	{
+		sChip.Erase();
+		{
+			Machine	machine;
+			for (uint32_t i = 0; i < fill; i++)
+			{
+				machine.Cut(i);
+			}
+		}
+		Machine	machine;
+		machine.Boot();
+		uint16_t	count = machine.mJournal.Count();
+		Check(count == (fill < kSlots ? fill : kSlots), "recent: count");
+		bool	inOrder = true;
+		for (uint16_t i = 0; i < count; i++)
+		{
+			inOrder = inOrder && machine.IsRecent(i, fill - 1 - i);
+		}
+		Check(inOrder, "recent: records out of order");
+		SCutRecord	record;
+		Check(!machine.mJournal.ReadRecent(count, &record), "recent: read past the oldest");
+	}
+	printf("recent: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/************************************ Torn ************************************/
+/*
+*	Power is lost after some of the record's bytes were written, including
+*	none and all but the last.  The records before the torn one are written
+*	so the torn record is in the first slot, the last slot, and the first
+*	slot of the second lap.
+*/
+static void Torn(void)
+{
+	uint32_t	failures = sFailures;
+	const uint32_t	kBefore[] = {0, 5, kSlots - 1, kSlots, kSlots + 5};
+	const int32_t	kWritten[] = {0, 1, 4, 30, 53};
+	uint32_t	cases = 0;
+	for (uint32_t before : kBefore)
+	{
+		for (int32_t written : kWritten)
+		{
+			sChip.Erase();
+			{
+				Machine	machine;
+				for (uint32_t i = 0; i < before; i++)
+				{
+					machine.Cut(i);
+				}
+				/*
+				*	The machine loses power too, so only the state after
+				*	the reboot matters.
+				*/
+				sChip.LosePowerAfter(written);
+				machine.Cut(before);
+			}
+			sChip.PowerOn();
+			Machine	machine;
+			Check(machine.Boot() == (before != 0), "torn: load");
+			Check(machine.mJournal.Appended() == before, "torn: partial record loaded");
+			Check(before == 0 || machine.IsRecent(0, before - 1), "torn: newest record");
+			machine.Cut(1000);
+			Check(machine.IsRecent(0, 1000), "torn: record after reboot");
+			Check(before == 0 || machine.IsRecent(1, before - 1), "torn: record before");
+			Machine	rebooted;
+			rebooted.Boot();
+			Check(rebooted.mJournal.Appended() == before + 1 &&
+					rebooted.IsRecent(0, 1000), "torn: reload after replace");
+			cases++;
+		}
+	}
+	printf("torn: %s, %u cases\n", failures == sFailures ? "passed" : "FAILED", cases);
+}
+
+/************************************ CRC *************************************/
+static void CRC(void)
+{
+	uint32_t	failures = sFailures;
+	const uint32_t	kFill = kSlots + 20;
+	sChip.Erase();
+	{
+		Machine	machine;
+		for (uint32_t i = 0; i < kFill; i++)
+		{
+			machine.Cut(i);
+		}
+	}
+	/*
+	*	A bad record in the middle is skipped by ReadRecent, the records
+	*	around it are still read.
+	*/
+	sChip.Memory()[SlotAddress(kFill - 15) + 20] ^= 0x04;
+	{
+		Machine	machine;
+		machine.Boot();
+		Check(machine.mJournal.Appended() == kFill, "crc: load");
+		Check(!machine.IsRecent(14, kFill - 15), "crc: bad record read");
+		Check(machine.IsRecent(13, kFill - 14) && machine.IsRecent(15, kFill - 16),
+				"crc: records around the bad record");
+	}
+	/*
+	*	A bad CRC in the newest record: Load uses the one before it.
+	*/
+	sChip.Memory()[SlotAddress(kFill - 1) + sizeof(uint32_t) + sizeof(SCutRecord)] ^= 0x80;
+	{
+		Machine	machine;
+		machine.Boot();
+		Check(machine.mJournal.Appended() == kFill - 1, "crc: bad newest record loaded");
+		Check(machine.IsRecent(0, kFill - 2), "crc: newest record");
+	}
+	/*
+	*	Neither the newest nor the one before it: not a journal.
+	*/
+	sChip.Memory()[SlotAddress(kFill - 2) + 8] ^= 0x01;
+	{
+		Machine	machine;
+		Check(!machine.Boot() && machine.mJournal.Count() == 0, "crc: two bad records loaded");
+	}
+	printf("crc: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/********************************** Counters **********************************/
+/*
+*	Cuts over several boots, one of them ending in a lost record.  After each
+*	boot the counters are those of the last record written.
+*/
+static void Counters(void)
+{
+	uint32_t	failures = sFailures;
+	uint32_t	completed = 0;
+	uint32_t	aborted = 0;
+	uint32_t	time = 0;
+	sChip.Erase();
+	for (uint32_t boot = 0; boot < 6; boot++)
+	{
+		Machine	machine;
+		machine.Boot();
+		Check(machine.mCutRecord.completedCuts == completed &&
+				machine.mCutRecord.abortedCuts == aborted, "counters: not restored");
+		for (uint32_t cut = 0; cut < 50; cut++, time++)
+		{
+			bool	completes = (time % 7) != 3;
+			machine.Cut(time, completes);
+			completes ? completed++ : aborted++;
+		}
+		if (boot == 3)
+		{
+			sChip.LosePowerAfter(10);
+			machine.Cut(time++, true);
+			sChip.PowerOn();
+		}
+	}
+	Machine	machine;
+	machine.Boot();
+	Check(machine.mCutRecord.completedCuts + machine.mCutRecord.abortedCuts ==
+			machine.mJournal.Appended(), "counters: don't match the records appended");
+	printf("counters: %s, %u completed, %u aborted\n",
+			failures == sFailures ? "passed" : "FAILED",
+			machine.mCutRecord.completedCuts, machine.mCutRecord.abortedCuts);
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	Wrap();
+	Boot();
+	Recent();
+	Torn();
+	CRC();
+	Counters();
+	return(sFailures ? 1 : 0);
+}
@@ -0,0 +1,32 @@
+/*
+*	Arduino.h, Copyright Jonathan Mackey 2023
+*	The part of Arduino.h used by I2CQueue and AT24C, for AT24CJournalTest.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <inttypes.h>
+#include <stddef.h>
+
+uint32_t	micros(void);
+uint32_t	millis(void);
+
+#endif // Arduino_h
@@ -0,0 +1,52 @@
+/*
+*	Wire.h, Copyright Jonathan Mackey 2023
+*	The part of TwoWire used by I2CQueue and AT24C, for AT24CJournalTest.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef Wire_h
+#define Wire_h
+
+#include "Arduino.h"
+
+/*
+*	Implemented by AT24CJournalTest.cpp.  The only device on the bus is the
+*	simulated AT24C.
+*/
+class TwoWire
+{
+public:
+	void					beginTransmission(
+								uint8_t					inAddress);
+	size_t					write(
+								uint8_t					inData);
+	size_t					write(
+								const uint8_t*			inData,
+								size_t					inLength);
+	uint8_t					endTransmission(
+								bool					inSendStop = true);
+	uint8_t					requestFrom(
+								uint8_t					inAddress,
+								uint8_t					inLength,
+								uint8_t					inSendStop = true);
+	int						read(void);
+};
+extern TwoWire Wire;
+
+#endif // Wire_h
@@ -0,0 +1,77 @@
+/*
+*	DialogLayerWriter.h, Copyright Jonathan Mackey 2023
+*	Writes the pre-rendered static layer of an XDialogBox for host builds.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef DialogLayerWriter_h
+#define DialogLayerWriter_h
+
+#include "FramebufferDisplayController.h"
+#include "XDialogBox.h"
+#include <stdio.h>
+
+/****************************** WriteDialogLayer ******************************/
+/*
+*	Draws inDialog with its dynamic views hidden and writes the dialog's
+*	bounds to inPath in the format read by XDialogBox::SetStaticLayer.  The
+*	dialog must not have a static layer set.  The dialog is closed and the
+*	dynamic views are made visible again before returning.
+*
+*	The pixels outside of the dialog's rounded corners aren't drawn by the
+*	dialog.  The view the dialog is shown over must be drawn before calling
+*	this routine so that the corners match.
+*
+*	Returns true if successful.
+*/
+inline bool WriteDialogLayer(
+	FramebufferDisplayController&	inDisplay,
+	XDialogBox&						inDialog,
+	XView* const*					inDynamicViews,
+	const char*						inPath)
+{
+	for (XView* const* dynamicView = inDynamicViews; *dynamicView; dynamicView++)
+	{
+		(*dynamicView)->SetVisible(false);
+	}
+	inDialog.Show();
+	FILE*	file = fopen(inPath, "wb");
+	if (file)
+	{
+		uint16_t	header[3] = {inDialog.Tag(), inDialog.Width(), inDialog.Height()};
+		fwrite(header, sizeof(uint16_t), 3, file);
+		for (uint16_t row = 0; row < inDialog.Height(); row++)
+		{
+			for (uint16_t column = 0; column < inDialog.Width(); column++)
+			{
+				uint16_t	pixel = inDisplay.GetPixel(inDialog.X() + column, inDialog.Y() + row);
+				fwrite(&pixel, sizeof(uint16_t), 1, file);
+			}
+		}
+		fclose(file);
+	}
+	inDialog.DoCancel();
+	for (XView* const* dynamicView = inDynamicViews; *dynamicView; dynamicView++)
+	{
+		(*dynamicView)->SetVisible(true);
+	}
+	return(file != nullptr);
+}
+
+#endif // DialogLayerWriter_h
@@ -0,0 +1,48 @@
+/*
+*	pgmspace_stub.h, Copyright Jonathan Mackey 2023
+*	PROGMEM access stubs for host builds.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef pgmspace_stub_h
+#define pgmspace_stub_h
+/*
+*	On the host there's no separate program memory so PROGMEM data is just
+*	const data.
+*/
+#include <inttypes.h>
+#include <string.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_byte_near(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_word_near(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#ifndef memcpy_P
+#define memcpy_P memcpy
+#endif
+#define strcpy_P strcpy
+#define strlen_P strlen
+#define PSTR(str) (str)
+
+#endif // pgmspace_stub_h
@@ -0,0 +1,134 @@
+/*
+*	KMDialogLayers.cpp, Copyright Jonathan Mackey 2023
+*	Renders the static layers of the KeyMachine dialogs.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Builds the real view tree from KeyMachine/KMXViews.h against a
+*	FramebufferDisplayController and renders the Setup Origin, Adjust Origin
+*	and Cut Key dialogs without their dynamic views.  Each dialog is written
+*	to outputDir in the format read by XDialogBox::SetStaticLayer using the
+*	file names in KMXViews.h.  Copy the files to the root of the KeyMachine's
+*	SD card.
+*
+*	The layers must be rendered again whenever the dialogs or the UI fonts of
+*	KeyMachineSTM32.cpp change.  A layer that doesn't match the size of its
+*	dialog is ignored.
+*
+*	Usage: KMDialogLayers outputDir
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -D__MACH__ -IHostTools/Common -IKeyMachine \
+*		$(for d in libraries/[A-Z]*; do echo -n "-I$d "; done) \
+*		HostTools/KMDialogLayers/KMDialogLayers.cpp \
+*		libraries/XView/[A-Z]*.cpp libraries/XFont/[A-Z]*.cpp \
+*		libraries/DisplayController/DisplayController.cpp \
+*		libraries/DisplayController/FramebufferDisplayController.cpp \
+*		libraries/DisplayController/StripDisplayController.cpp \
+*		libraries/DisplayController/CircleQuadrant.cpp \
+*		libraries/DisplayController/TintedSpan.cpp \
+*		libraries/DisplayController/TintTable.cpp \
+*		libraries/DataStream/DataStream.cpp libraries/UnixTime/UnixTime.cpp \
+*		libraries/ValueFormatter/ValueFormatter.cpp libraries/BMP280Utils/BMP280Utils.cpp \
+*		KeyMachine/KMPinsValueField.cpp KeyMachine/KeySpec.cpp \
+*		KeyMachine/KMTextFile.cpp \
+*		KeyMachine/KMKeywaySearchField.cpp KeyMachine/KMKeywayList.cpp KeyMachine/KeySpecCatalog.cpp \
+*		-o KMDialogLayers
+*/
+#include "pgmspace_stub.h"
+#include "DialogLayerWriter.h"
+#include "FramebufferDisplayController.h"
+#include "XFont.h"
+#include <stdio.h>
+#include <string>
+
+XFont	xFont;
+// Same fonts as KeyMachineSTM32.cpp
+#include "MyriadPro-Regular_20_4b.h"
+#include "Avenir_64_4b.h"
+#include "KM_Icons_4b.h"
+#define UI20ptFont	MyriadPro_Regular_20_4b::font
+#define UI64ptFont	Avenir_64_4b::font
+#define UIIconsFont	KM_Icons_4b::font
+#include "KMXViews.h"
+
+// Same as Config.h
+static const uint16_t	kDisplayWidth = 320;
+static const uint16_t	kDisplayHeight = 480;
+
+static FramebufferDisplayController	sDisplay(kDisplayWidth, kDisplayHeight);
+
+struct SDialogLayer
+{
+	XDialogBox*		dialog;
+	XView* const*	dynamicViews;
+	const char*		path;
+};
+
+static const SDialogLayer	kDialogLayers[] =
+{
+	{&setupKeyHolderOriginDialog, setupKeyHolderOriginDynamicViews, kSetupZeroLayerPath},
+	{&adjustOriginDialog, adjustOriginDynamicViews, kAdjustOriginLayerPath},
+	{&cutKeyDialog, cutKeyDynamicViews, kCutKeyLayerPath},
+	{nullptr}
+};
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	if (argc != 2)
+	{
+		fprintf(stderr, "Usage: %s outputDir\n", argv[0]);
+		return(1);
+	}
+	/*
+	*	Same setup as KeyMachineSTM32::begin
+	*/
+	rootView.SetSize(kDisplayHeight, kDisplayWidth);
+	rootView.SetDisplay(&sDisplay);
+	rootView.SetModalView(&mainMenuBtn);
+	xFont.SetDisplay(&sDisplay, &UI20ptFont);
+	cutKeyDialog.AutoSize();
+	resetBtn.SetOrigin(resetBtn.X(), cutKeyDialog.GetOKButton()->Y());
+	// The dialogs are shown over the info view.
+	infoView.SetVisible(true);
+	rootView.Draw(0, 0, kDisplayHeight, kDisplayWidth);
+
+	int	result = 0;
+	for (const SDialogLayer* layer = kDialogLayers; layer->dialog; layer++)
+	{
+		std::string	path(argv[1]);
+		path += "/";
+		path += layer->path;
+		if (WriteDialogLayer(sDisplay, *layer->dialog, layer->dynamicViews, path.c_str()))
+		{
+			printf("%s: %hux%hu\n", path.c_str(), layer->dialog->Width(),
+								layer->dialog->Height());
+		} else
+		{
+			fprintf(stderr, "Unable to write %s\n", path.c_str());
+			result = 1;
+		}
+	}
+	return(result);
+}
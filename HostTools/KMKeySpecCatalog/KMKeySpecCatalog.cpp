@@ -0,0 +1,129 @@
+/*
+*	KMKeySpecCatalog.cpp, Copyright Jonathan Mackey 2023
+*	Compiles KeySpec text files into a KeySpecCatalog.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Each input file is read by KeySpec::ReadFile, the same parser used for a
+*	single spec on the SD card.  The tags must be unique.  The catalog is
+*	written in the format described in KeyMachine/KeySpecCatalog.h.  Copy
+*	the output file to the root of the KeyMachine's SD card as
+*	KMKeySpecs.bin.
+*
+*	The built-in Schlage and Kwikset specs (tags 1 and 2) take precedence
+*	over catalog specs with the same tag.
+*
+*	Usage: KMKeySpecCatalog outputFile specFile...
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -D__MACH__ -IKeyMachine \
+*		HostTools/KMKeySpecCatalog/KMKeySpecCatalog.cpp KeyMachine/KeySpec.cpp \
+*		KeyMachine/KMTextFile.cpp \
+*		-o KMKeySpecCatalog
+*/
+#include "KeySpecCatalog.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include <vector>
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "Usage: %s outputFile specFile...\n", argv[0]);
+		return(1);
+	}
+	std::vector<SKeySpec>	specs;
+	for (int i = 2; i < argc; i++)
+	{
+		KeySpec	keySpec;
+		if (!keySpec.ReadFile(argv[i]))
+		{
+			fprintf(stderr, "%s: missing or invalid key values\n", argv[i]);
+			return(1);
+		}
+		specs.push_back(keySpec.Spec());
+	}
+	if (specs.size() > 0xFFFF)
+	{
+		fprintf(stderr, "Too many specs (%zu)\n", specs.size());
+		return(1);
+	}
+	SKeySpecCatalogHeader	header = {0};
+	header.signature = kKeySpecCatalogSignature;
+	header.version = kKeySpecCatalogVersion;
+	header.count = (uint16_t)specs.size();
+	header.specSize = sizeof(SKeySpec);
+	header.specsOffset = sizeof(SKeySpecCatalogHeader);
+	header.tagIndexOffset = header.specsOffset + (header.count * sizeof(SKeySpec));
+	header.nameIndexOffset = header.tagIndexOffset + (header.count * sizeof(SKeySpecCatalogTagEntry));
+
+	std::vector<SKeySpecCatalogTagEntry>	tagIndex(header.count);
+	std::vector<SKeySpecCatalogNameEntry>	nameIndex(header.count);
+	for (uint16_t i = 0; i < header.count; i++)
+	{
+		tagIndex[i].tag = specs[i].tag;
+		tagIndex[i].specIndex = i;
+		memset(&nameIndex[i], 0, sizeof(SKeySpecCatalogNameEntry));
+		strncpy(nameIndex[i].name, specs[i].name, sizeof(nameIndex[i].name) -1);
+		nameIndex[i].tag = specs[i].tag;
+	}
+	std::sort(tagIndex.begin(), tagIndex.end(),
+		[](const SKeySpecCatalogTagEntry& a, const SKeySpecCatalogTagEntry& b)
+		{return(a.tag < b.tag);});
+	for (uint16_t i = 1; i < header.count; i++)
+	{
+		if (tagIndex[i].tag == tagIndex[i-1].tag)
+		{
+			fprintf(stderr, "%s and %s have the same tag (%hu)\n",
+				argv[tagIndex[i-1].specIndex + 2], argv[tagIndex[i].specIndex + 2],
+				tagIndex[i].tag);
+			return(1);
+		}
+	}
+	std::sort(nameIndex.begin(), nameIndex.end(),
+		[](const SKeySpecCatalogNameEntry& a, const SKeySpecCatalogNameEntry& b)
+		{return(strcasecmp(a.name, b.name) < 0);});
+
+	FILE*	file = fopen(argv[1], "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Unable to create %s\n", argv[1]);
+		return(1);
+	}
+	fwrite(&header, sizeof(header), 1, file);
+	fwrite(specs.data(), sizeof(SKeySpec), header.count, file);
+	fwrite(tagIndex.data(), sizeof(SKeySpecCatalogTagEntry), header.count, file);
+	fwrite(nameIndex.data(), sizeof(SKeySpecCatalogNameEntry), header.count, file);
+	bool	success = ferror(file) == 0;
+	fclose(file);
+	if (success)
+	{
+		printf("%s: %hu specs, %ld bytes\n", argv[1], header.count,
+			(long)(header.nameIndexOffset + (header.count * sizeof(SKeySpecCatalogNameEntry))));
+	}
+	return(success ? 0 : 1);
+}
@@ -0,0 +1,210 @@
+/*
+*	KMParseBenchmark.cpp, Copyright Jonathan Mackey 2023
+*	Times the KeySpec and KMSettings text file parsers.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Writes a directory of synthetic key spec files and times KeySpec::ReadFile
+*	over all of them, then times writing and reading a settings file with
+*	KMSettings.  Each scenario is reported as one line of JSON containing the
+*	host time per file and the number of reads and writes KMTextFile made.
+*	On the KeyMachine each read or write is an SdFat call, so the counts
+*	matter more than the host time.
+*
+*	Usage: KMParseBenchmark [-n specCount] [-dir directory]
+*
+*	The directory defaults to /tmp.  The files are written to a
+*	KMParseBenchmark subdirectory and left there.
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -D__MACH__ -IKeyMachine \
+*		-Ilibraries/UnixTime \
+*		HostTools/KMParseBenchmark/KMParseBenchmark.cpp \
+*		KeyMachine/KeySpec.cpp KeyMachine/KMSettings.cpp \
+*		KeyMachine/KMTextFile.cpp libraries/UnixTime/UnixTime.cpp \
+*		-o KMParseBenchmark
+*/
+#include "KeySpec.h"
+#include "KMSettings.h"
+#include "KMTextFile.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+
+static std::string	sDir;
+
+/******************************** SpecPath ************************************/
+static std::string SpecPath(
+	uint32_t	inIndex)
+{
+	char	name[32];
+	snprintf(name, sizeof(name), "/Key%u.txt", inIndex);
+	return(sDir + name);
+}
+
+/****************************** WriteSpecFiles ********************************/
+/*
+*	The synthetic specs use every key, a few comments, blank lines and CRLF
+*	line endings on every other file so that all of the tokenizer's paths
+*	are exercised.
+*/
+static bool WriteSpecFiles(
+	uint32_t	inCount)
+{
+	bool	success = true;
+	for (uint32_t i = 1; success && i <= inCount; i++)
+	{
+		FILE*	file = fopen(SpecPath(i).c_str(), "w");
+		success = file != nullptr;
+		if (success)
+		{
+			const char*	eol = (i & 1) ? "\r\n" : "\n";
+			fprintf(file, "# Synthetic key spec %u%s%s", i, eol, eol);
+			fprintf(file, "name = Keyway %u%s", i, eol);
+			fprintf(file, "cutAngle = %u%s", 90 + (i % 10), eol);
+			fprintf(file, "pinDepthInc = %.3f%s", 0.015 + (i % 10) * 0.001, eol);
+			fprintf(file, "deepestCut = %.3f%s", 0.180 + (i % 20) * 0.001, eol);
+			fprintf(file, "bladeWidth = %.3f%s", 0.335, eol);
+			fprintf(file, "flatWidth = %.3f%s", 0.084, eol);
+			fprintf(file, "pinSpacing = %.3f%s", 0.150, eol);
+			fprintf(file, "firstPinCenter = %.3f%s", 0.247, eol);
+			fprintf(file, "macs = %u	# maximum adjacent cut spec%s", 4 + (i % 4), eol);
+			fprintf(file, "shalowestCutIndex = 0%s", eol);
+			fprintf(file, "deepestCutIndex = 9%s", eol);
+			fprintf(file, "isMetric = %s%s", (i % 3) ? "false" : "true", eol);
+			fprintf(file, "increasingDepths = true%s", eol);
+			fprintf(file, "tag = %u%s", 100 + i, eol);
+			fprintf(file, "pinsSupported = 0x%X%s", 0x60 | (i & 0x1F), eol);
+			success = fclose(file) == 0;
+		}
+	}
+	return(success);
+}
+
+/******************************** Report **************************************/
+static void Report(
+	const char*					inScenario,
+	uint32_t					inFiles,
+	uint32_t					inFailures,
+	std::chrono::nanoseconds	inElapsed)
+{
+	printf("{\"scenario\":\"%s\",\"files\":%u,\"failures\":%u,"
+			"\"usPerFile\":%.2f,\"fileReads\":%u,\"fileWrites\":%u}\n",
+			inScenario, inFiles, inFailures,
+			(double)inElapsed.count() / 1000.0 / inFiles,
+			KMTextFile::FileReads(), KMTextFile::FileWrites());
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	uint32_t	specCount = 1000;
+	sDir = "/tmp";
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && (i+1) < argc)
+		{
+			specCount = (uint32_t)atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-dir") == 0 && (i+1) < argc)
+		{
+			sDir = argv[++i];
+		} else
+		{
+			fprintf(stderr, "Usage: %s [-n specCount] [-dir directory]\n", argv[0]);
+			return(1);
+		}
+	}
+	if (specCount == 0)
+	{
+		specCount = 1;
+	}
+	sDir += "/KMParseBenchmark";
+	mkdir(sDir.c_str(), 0755);
+	if (!WriteSpecFiles(specCount))
+	{
+		fprintf(stderr, "Unable to write the spec files to %s\n", sDir.c_str());
+		return(1);
+	}
+
+	/*
+	*	KeySpec: Parse every spec file.  A spec is counted as a failure when
+	*	its tag doesn't match the one written.
+	*/
+	{
+		KeySpec		keySpec;
+		uint32_t	failures = 0;
+		KMTextFile::ResetStats();
+		auto	start = std::chrono::steady_clock::now();
+		for (uint32_t i = 1; i <= specCount; i++)
+		{
+			if (!keySpec.ReadFile(SpecPath(i).c_str()) ||
+				keySpec.Spec().tag != (uint16_t)(100 + i))
+			{
+				failures++;
+			}
+		}
+		Report("KeySpec", specCount, failures,
+			std::chrono::steady_clock::now() - start);
+	}
+
+	/*
+	*	KMSettings: Write then read back the settings file.
+	*/
+	{
+		std::string	path(sDir + "/KMSettings.txt");
+		SKMSettings	settings = {1, 3, {200, 3900, 250, 3850}};
+		KMSettings	kmSettings;
+		uint32_t	failures = 0;
+		KMTextFile::ResetStats();
+		auto	start = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < specCount; i++)
+		{
+			if (!kmSettings.WriteFile(path.c_str(), settings))
+			{
+				failures++;
+			}
+		}
+		Report("KMSettingsWrite", specCount, failures,
+			std::chrono::steady_clock::now() - start);
+
+		failures = 0;
+		KMTextFile::ResetStats();
+		start = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < specCount; i++)
+		{
+			if (!kmSettings.ReadFile(path.c_str()) ||
+				kmSettings.Settings().currentView != settings.currentView ||
+				memcmp(kmSettings.Settings().tsMinMax, settings.tsMinMax,
+									sizeof(settings.tsMinMax)))
+			{
+				failures++;
+			}
+		}
+		Report("KMSettingsRead", specCount, failures,
+			std::chrono::steady_clock::now() - start);
+	}
+	return(0);
+}
@@ -0,0 +1,345 @@
+/*
+*	KMRemoteClient.cpp, Copyright Jonathan Mackey 2023
+*	Host side client of the KeyMachine's binary serial protocol.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Add this file, libraries/SerialFrame/SerialFrame.cpp and the include
+*	paths -IHostTools/KMRemoteClient -IKeyMachine -Ilibraries/SerialFrame to
+*	the application's build.  See HostTools/KMRemoteLoopback for an example.
+*/
+#include "KMRemoteClient.h"
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+typedef std::chrono::steady_clock	Clock;
+
+/***************************** KMRemoteSerialPort *****************************/
+KMRemoteSerialPort::KMRemoteSerialPort(void)
+	: mFD(-1)
+{
+}
+
+/***************************** ~KMRemoteSerialPort ****************************/
+KMRemoteSerialPort::~KMRemoteSerialPort(void)
+{
+	Close();
+}
+
+/************************************ Open ************************************/
+bool KMRemoteSerialPort::Open(
+	const char*	inPath,
+	uint32_t	inBaudRate)
+{
+	Close();
+	speed_t	speed = 0;
+	switch (inBaudRate)
+	{
+		case 9600:
+			speed = B9600;
+			break;
+		case 19200:
+			speed = B19200;
+			break;
+		case 38400:
+			speed = B38400;
+			break;
+		case 57600:
+			speed = B57600;
+			break;
+		case 115200:
+			speed = B115200;
+			break;
+	}
+	if (speed)
+	{
+		mFD = open(inPath, O_RDWR | O_NOCTTY);
+		if (mFD >= 0)
+		{
+			struct termios	options;
+			if (tcgetattr(mFD, &options) == 0)
+			{
+				cfmakeraw(&options);
+				cfsetispeed(&options, speed);
+				cfsetospeed(&options, speed);
+				options.c_cflag |= (CLOCAL | CREAD);
+				options.c_cflag &= ~(CSTOPB | CRTSCTS);
+				options.c_cc[VMIN] = 0;
+				options.c_cc[VTIME] = 0;
+			}
+			if (tcsetattr(mFD, TCSANOW, &options) != 0)
+			{
+				Close();
+			} else
+			{
+				tcflush(mFD, TCIOFLUSH);
+			}
+		}
+	}
+	return(mFD >= 0);
+}
+
+/*********************************** Close ************************************/
+void KMRemoteSerialPort::Close(void)
+{
+	if (mFD >= 0)
+	{
+		close(mFD);
+		mFD = -1;
+	}
+}
+
+/*********************************** Write ************************************/
+bool KMRemoteSerialPort::Write(
+	const uint8_t*	inData,
+	uint16_t		inLength)
+{
+	bool	success = mFD >= 0;
+	while (success && inLength)
+	{
+		ssize_t	bytesWritten = write(mFD, inData, inLength);
+		success = bytesWritten > 0;
+		if (success)
+		{
+			inData += bytesWritten;
+			inLength -= bytesWritten;
+		}
+	}
+	return(success);
+}
+
+/************************************ Read ************************************/
+int32_t KMRemoteSerialPort::Read(
+	uint8_t*	outBuffer,
+	uint16_t	inMaxLength,
+	uint32_t	inTimeoutMS)
+{
+	int32_t	bytesRead = -1;
+	if (mFD >= 0)
+	{
+		struct pollfd	pollFD = {mFD, POLLIN, 0};
+		int	result = poll(&pollFD, 1, inTimeoutMS);
+		if (result > 0)
+		{
+			bytesRead = (int32_t)read(mFD, outBuffer, inMaxLength);
+		} else if (result == 0)
+		{
+			bytesRead = 0;
+		}
+	}
+	return(bytesRead);
+}
+
+/******************************* KMRemoteClient *******************************/
+KMRemoteClient::KMRemoteClient(
+	KMRemoteTransport*	inTransport,
+	uint32_t			inTimeoutMS,
+	uint8_t				inRetries)
+	: mTransport(inTransport), mTimeoutMS(inTimeoutMS), mRetries(inRetries),
+	  mReadLength(0), mReadIndex(0), mResends(0), mHasTelemetrySeq(false),
+	  mTelemetrySeq(0), mLostTelemetry(0)
+{
+	/*
+	*	Start with an arbitrary sequence number so that the first request of
+	*	this session isn't taken as a resend of the last request of a
+	*	previous session.
+	*/
+	mSeq = (uint8_t)Clock::now().time_since_epoch().count();
+}
+
+/********************************** QueueCut **********************************/
+uint8_t KMRemoteClient::QueueCut(
+	const SKMRemoteCutJob&	inJob,
+	SKMRemoteCutResponse*	outResponse)
+{
+	SKMRemoteCutResponse	response;
+	uint8_t	status = Request(kKMRemoteQueueCut, &inJob, sizeof(SKMRemoteCutJob),
+								&response, sizeof(SKMRemoteCutResponse));
+	if (outResponse)
+	{
+		*outResponse = response;
+	}
+	return(status);
+}
+
+/******************************* GetQueueState ********************************/
+uint8_t KMRemoteClient::GetQueueState(
+	SKMRemoteQueueState&	outState)
+{
+	return(Request(kKMRemoteGetQueueState, nullptr, 0,
+								&outState, sizeof(SKMRemoteQueueState)));
+}
+
+/******************************** SetTelemetry ********************************/
+uint8_t KMRemoteClient::SetTelemetry(
+	uint16_t	inPeriodMS)
+{
+	SKMRemoteTelemetryRequest	request = {inPeriodMS};
+	SKMRemoteStatus				response;
+	return(Request(kKMRemoteSetTelemetry, &request, sizeof(SKMRemoteTelemetryRequest),
+								&response, sizeof(SKMRemoteStatus)));
+}
+
+/******************************* NextTelemetry ********************************/
+bool KMRemoteClient::NextTelemetry(
+	SKMRemoteTelemetry&	outTelemetry,
+	uint32_t			inTimeoutMS)
+{
+	Clock::time_point	deadline = Clock::now() + std::chrono::milliseconds(inTimeoutMS);
+	while (mTelemetry.empty())
+	{
+		Clock::time_point	now = Clock::now();
+		if (now >= deadline ||
+			!ReceiveFrame((uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()))
+		{
+			break;
+		}
+		if (mFrame.Type() == kKMRemoteTelemetry)
+		{
+			SaveTelemetry();
+		}
+	}
+	bool	haveTelemetry = !mTelemetry.empty();
+	if (haveTelemetry)
+	{
+		outTelemetry = mTelemetry.front();
+		mTelemetry.pop_front();
+	}
+	return(haveTelemetry);
+}
+
+/********************************** Request ***********************************/
+/*
+*	Sends the request and waits for its response.  The response payload is
+*	copied to outResponse.  A response shorter than inResponseLength (e.g. an
+*	eKMRemoteBadRequest status) is zero filled.
+*/
+uint8_t KMRemoteClient::Request(
+	uint8_t		inType,
+	const void*	inPayload,
+	uint8_t		inLength,
+	void*		outResponse,
+	uint8_t		inResponseLength)
+{
+	uint8_t	status = kNoResponse;
+	uint8_t	frame[SerialFrame::kMaxFrameSize];
+	uint16_t	frameLength = SerialFrame::Encode(++mSeq, inType, inPayload, inLength, frame);
+	memset(outResponse, 0, inResponseLength);
+	for (uint8_t attempt = 0; attempt <= mRetries && status == kNoResponse; attempt++)
+	{
+		if (attempt)
+		{
+			mResends++;
+		}
+		if (!mTransport->Write(frame, frameLength))
+		{
+			break;
+		}
+		Clock::time_point	deadline = Clock::now() + std::chrono::milliseconds(mTimeoutMS);
+		while (status == kNoResponse)
+		{
+			Clock::time_point	now = Clock::now();
+			if (now >= deadline ||
+				!ReceiveFrame((uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()))
+			{
+				break;
+			}
+			if (mFrame.Type() == kKMRemoteTelemetry)
+			{
+				SaveTelemetry();
+			/*
+			*	Else if this is the response to this request THEN
+			*	it's done.  Responses to earlier requests are ignored.
+			*/
+			} else if (mFrame.Type() == (inType | kKMRemoteResponse) &&
+				mFrame.Seq() == mSeq &&
+				mFrame.PayloadLength() > 0)
+			{
+				uint8_t	length = mFrame.PayloadLength();
+				memcpy(outResponse, mFrame.Payload(),
+							length < inResponseLength ? length : inResponseLength);
+				status = mFrame.Payload()[0];
+			}
+		}
+	}
+	return(status);
+}
+
+/******************************** ReceiveFrame ********************************/
+/*
+*	Feeds the received bytes to mFrame until a frame is received.  Bytes
+*	following the frame are kept for the next call.  Returns false if no
+*	frame was received within inTimeoutMS.
+*/
+bool KMRemoteClient::ReceiveFrame(
+	uint32_t	inTimeoutMS)
+{
+	bool	frameReceived = false;
+	Clock::time_point	deadline = Clock::now() + std::chrono::milliseconds(inTimeoutMS);
+	while (!frameReceived)
+	{
+		if (mReadIndex >= mReadLength)
+		{
+			Clock::time_point	now = Clock::now();
+			if (now >= deadline)
+			{
+				break;
+			}
+			mReadIndex = 0;
+			mReadLength = mTransport->Read(mReadBuffer, sizeof(mReadBuffer),
+				(uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+			if (mReadLength < 0)
+			{
+				mReadLength = 0;
+				break;
+			}
+		}
+		for (; mReadIndex < mReadLength && !frameReceived; mReadIndex++)
+		{
+			frameReceived = mFrame.Receive(mReadBuffer[mReadIndex]) == SerialFrame::eFrameReceived;
+		}
+	}
+	return(frameReceived);
+}
+
+/******************************** SaveTelemetry *******************************/
+void KMRemoteClient::SaveTelemetry(void)
+{
+	if (mFrame.PayloadLength() == sizeof(SKMRemoteTelemetry))
+	{
+		if (mHasTelemetrySeq)
+		{
+			mLostTelemetry += (uint8_t)(mFrame.Seq() - mTelemetrySeq - 1);
+		}
+		mHasTelemetrySeq = true;
+		mTelemetrySeq = mFrame.Seq();
+		SKMRemoteTelemetry	telemetry;
+		memcpy(&telemetry, mFrame.Payload(), sizeof(SKMRemoteTelemetry));
+		if (mTelemetry.size() >= kMaxQueuedTelemetry)
+		{
+			mTelemetry.pop_front();
+		}
+		mTelemetry.push_back(telemetry);
+	}
+}
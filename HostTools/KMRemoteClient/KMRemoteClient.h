@@ -0,0 +1,153 @@
+/*
+*	KMRemoteClient.h, Copyright Jonathan Mackey 2023
+*	Host side client of the KeyMachine's binary serial protocol.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMRemoteClient_h
+#define KMRemoteClient_h
+
+#include "SerialFrame.h"
+#include "KMRemoteProtocol.h"
+#include <deque>
+
+/*
+*	KMRemoteTransport carries the frames.  KMRemoteSerialPort is the
+*	transport for a KeyMachine connected by a serial port.
+*/
+class KMRemoteTransport
+{
+public:
+	virtual					~KMRemoteTransport(void){}
+	virtual bool			Write(
+								const uint8_t*			inData,
+								uint16_t				inLength) = 0;
+	/*
+	*	Read: Waits up to inTimeoutMS for at least one byte.  Returns the
+	*	number of bytes read, 0 on timeout, or -1 on error.
+	*/
+	virtual int32_t			Read(
+								uint8_t*				outBuffer,
+								uint16_t				inMaxLength,
+								uint32_t				inTimeoutMS) = 0;
+};
+
+class KMRemoteSerialPort : public KMRemoteTransport
+{
+public:
+							KMRemoteSerialPort(void);
+	virtual					~KMRemoteSerialPort(void);
+	/*
+	*	Open: Opens the port (e.g. /dev/ttyUSB0) 8N1 without flow control.
+	*	inBaudRate must match BAUD_RATE in KeyMachine/Config.h.
+	*/
+	bool					Open(
+								const char*				inPath,
+								uint32_t				inBaudRate = 19200);
+	void					Close(void);
+	virtual bool			Write(
+								const uint8_t*			inData,
+								uint16_t				inLength);
+	virtual int32_t			Read(
+								uint8_t*				outBuffer,
+								uint16_t				inMaxLength,
+								uint32_t				inTimeoutMS);
+protected:
+	int		mFD;
+};
+
+/*
+*	KMRemoteClient sends the requests of KMRemoteProtocol.h and waits for
+*	their responses.  A request that isn't answered within the timeout is
+*	resent unchanged, up to the retry count.  The KeyMachine recognizes a
+*	resent request and only resends its response, so a cut is never queued
+*	twice.  Telemetry reports that arrive while waiting are kept for
+*	NextTelemetry.
+*
+*	The request functions return an EKMRemoteStatus or kNoResponse.  When the
+*	result is kNoResponse the request may or may not have been carried out.
+*	Use GetQueueState to find out.
+*
+*	Usage:
+*		KMRemoteSerialPort	port;
+*		port.Open("/dev/ttyUSB0");
+*		KMRemoteClient		client(&port);
+*		SKMRemoteCutJob		job = {tag, 5, {3, 5, 1, 4, 2}};
+*		if (client.QueueCut(job) == eKMRemoteOK) ...
+*/
+class KMRemoteClient
+{
+public:
+	static const uint8_t	kNoResponse = 0xFF;
+							KMRemoteClient(
+								KMRemoteTransport*		inTransport,
+								uint32_t				inTimeoutMS = 500,
+								uint8_t					inRetries = 3);
+	uint8_t					QueueCut(
+								const SKMRemoteCutJob&	inJob,
+								SKMRemoteCutResponse*	outResponse = nullptr);
+	uint8_t					GetQueueState(
+								SKMRemoteQueueState&	outState);
+	// inPeriodMS 0 stops the reports.
+	uint8_t					SetTelemetry(
+								uint16_t				inPeriodMS);
+	/*
+	*	NextTelemetry: Returns the oldest report received, waiting up to
+	*	inTimeoutMS for one.  Returns false on timeout.
+	*/
+	bool					NextTelemetry(
+								SKMRemoteTelemetry&		outTelemetry,
+								uint32_t				inTimeoutMS);
+	// Requests resent because the response wasn't received in time.
+	uint32_t				Resends(void) const
+								{return(mResends);}
+	// Reports missing from the report sequence numbers.
+	uint32_t				LostTelemetry(void) const
+								{return(mLostTelemetry);}
+	// Frames received with a bad CRC or length.
+	uint16_t				DroppedFrames(void) const
+								{return(mFrame.DroppedFrames());}
+protected:
+	static const uint16_t	kMaxQueuedTelemetry = 64;
+	KMRemoteTransport*	mTransport;
+	uint32_t			mTimeoutMS;
+	uint8_t				mRetries;
+	uint8_t				mSeq;
+	SerialFrame			mFrame;
+	uint8_t				mReadBuffer[256];
+	int32_t				mReadLength;
+	int32_t				mReadIndex;
+	uint32_t			mResends;
+	bool				mHasTelemetrySeq;
+	uint8_t				mTelemetrySeq;
+	uint32_t			mLostTelemetry;
+	std::deque<SKMRemoteTelemetry>	mTelemetry;
+
+	uint8_t					Request(
+								uint8_t					inType,
+								const void*				inPayload,
+								uint8_t					inLength,
+								void*					outResponse,
+								uint8_t					inResponseLength);
+	bool					ReceiveFrame(
+								uint32_t				inTimeoutMS);
+	void					SaveTelemetry(void);
+};
+
+#endif // KMRemoteClient_h
@@ -0,0 +1,474 @@
+/*
+*	KMRemoteLoopback.cpp, Copyright Jonathan Mackey 2023
+*	Tests KMRemote and KMRemoteClient over a simulated serial line.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Connects a KMRemoteClient to a KMRemote whose delegate simulates the
+*	KeyMachine.  The simulated line can drop and corrupt bytes in both
+*	directions and mixes debug text into the KeyMachine's output the way
+*	the sketch's printfs do.  The scenarios are:
+*
+*	- clean: every request type, the validation statuses, the busy status
+*	  and the telemetry rate.
+*	- lossy: queues jobs over a line that drops and corrupts bytes, then
+*	  checks that each job acknowledged was queued exactly once.
+*	- legacy: bytes outside of a frame, such as the '>' time command, are
+*	  returned to the caller.
+*
+*	Each scenario prints one line.  The exit status is 0 when all pass.
+*
+*	Usage: KMRemoteLoopback [-n jobCount] [-seed seed] [-loss 1/N bytes]
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -D__MACH__ -IKeyMachine -IHostTools/KMRemoteClient \
+*		-Ilibraries/SerialFrame -Ilibraries/MSPeriod \
+*		HostTools/KMRemoteLoopback/KMRemoteLoopback.cpp \
+*		HostTools/KMRemoteClient/KMRemoteClient.cpp \
+*		KeyMachine/KMRemote.cpp libraries/SerialFrame/SerialFrame.cpp \
+*		-o KMRemoteLoopback
+*/
+#include "KMRemote.h"
+#include "KMRemoteClient.h"
+#include <random>
+#include <set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+
+/*
+*	FakeMachine is both ends of the line.  Bytes written by the client are
+*	passed to mRemote.  Bytes written by mRemote are queued for the client.
+*	The simulated machine accepts keyway tags 1 to 3 with 4 to 6 pins, and
+*	each job keeps it busy for kJobMS.
+*/
+class FakeMachine : public KMRemoteTransport, public KMRemoteDelegate
+{
+public:
+							FakeMachine(
+								uint32_t				inSeed)
+								: mRemote(this), mRandom(inSeed), mLossRate(0),
+								  mDebugText(false), mJobEnd(0), mCompletedCuts(0),
+								  mDuplicateJobs(0), mX(0){}
+	void					SetLossRate(
+								uint32_t				inLossRate)
+								{mLossRate = inLossRate;}
+	void					SetDebugText(
+								bool					inDebugText)
+								{mDebugText = inDebugText;}
+	bool					Running(void) const
+								{return(mJobEnd != 0);}
+	const std::set<int32_t>&	JobIDs(void) const
+								{return(mJobIDs);}
+	uint32_t				DuplicateJobs(void) const
+								{return(mDuplicateJobs);}
+	KMRemote&				Remote(void)
+								{return(mRemote);}
+	// KMRemoteTransport
+	virtual bool			Write(
+								const uint8_t*			inData,
+								uint16_t				inLength);
+	virtual int32_t			Read(
+								uint8_t*				outBuffer,
+								uint16_t				inMaxLength,
+								uint32_t				inTimeoutMS);
+	// KMRemoteDelegate
+	virtual uint8_t			QueueRemoteCut(
+								const SKMRemoteCutJob&	inJob,
+								SKMRemoteCutResponse&	outResponse);
+	virtual void			GetRemoteQueueState(
+								SKMRemoteQueueState&	outState);
+	virtual void			GetRemoteTelemetry(
+								SKMRemoteTelemetry&		outTelemetry);
+	virtual void			WriteRemote(
+								const uint8_t*			inData,
+								uint16_t				inLength);
+protected:
+	static const uint32_t	kJobMS = 20;
+	KMRemote		mRemote;
+	std::mt19937	mRandom;
+	uint32_t		mLossRate;
+	bool			mDebugText;
+	uint32_t		mJobEnd;
+	uint32_t		mCompletedCuts;
+	uint32_t		mDuplicateJobs;
+	int32_t			mX;
+	std::set<int32_t>	mJobIDs;
+	std::string		mToHost;
+
+	bool					Damage(
+								uint8_t&				ioByte);
+	void					Tick(void);
+};
+
+/*********************************** Damage ***********************************/
+/*
+*	Returns false if the byte is dropped.  Otherwise ioByte may have a bit
+*	flipped.
+*/
+bool FakeMachine::Damage(
+	uint8_t&	ioByte)
+{
+	bool	keep = true;
+	if (mLossRate)
+	{
+		switch (mRandom() % mLossRate)
+		{
+			case 0:
+				keep = false;
+				break;
+			case 1:
+				ioByte ^= 1 << (mRandom() % 8);
+				break;
+		}
+	}
+	return(keep);
+}
+
+/*********************************** Write ************************************/
+bool FakeMachine::Write(
+	const uint8_t*	inData,
+	uint16_t		inLength)
+{
+	for (uint16_t i = 0; i < inLength; i++)
+	{
+		uint8_t	thisByte = inData[i];
+		if (Damage(thisByte))
+		{
+			mRemote.Receive(thisByte);
+		}
+	}
+	return(true);
+}
+
+/************************************ Read ************************************/
+int32_t FakeMachine::Read(
+	uint8_t*	outBuffer,
+	uint16_t	inMaxLength,
+	uint32_t	inTimeoutMS)
+{
+	MSPeriod	timeout(inTimeoutMS);
+	timeout.Start();
+	while (true)
+	{
+		Tick();
+		if (mToHost.size() || !inTimeoutMS || timeout.Passed())
+		{
+			break;
+		}
+		usleep(1000);
+	}
+	int32_t	bytesRead = mToHost.size() < inMaxLength ? (int32_t)mToHost.size() : inMaxLength;
+	memcpy(outBuffer, mToHost.data(), bytesRead);
+	mToHost.erase(0, bytesRead);
+	return(bytesRead);
+}
+
+/************************************ Tick ************************************/
+// Same order as KeyMachineSTM32::Update
+void FakeMachine::Tick(void)
+{
+	if (mJobEnd)
+	{
+		mX += 7;
+		if ((int32_t)(MSPeriod::millis() - mJobEnd) >= 0)
+		{
+			mJobEnd = 0;
+			mCompletedCuts++;
+			mX = 0;
+		}
+	}
+	mRemote.Update();
+}
+
+/******************************* QueueRemoteCut *******************************/
+uint8_t FakeMachine::QueueRemoteCut(
+	const SKMRemoteCutJob&	inJob,
+	SKMRemoteCutResponse&	outResponse)
+{
+	uint8_t	status = eKMRemoteOK;
+	if (mJobEnd)
+	{
+		status = eKMRemoteBusy;
+	} else if (inJob.keywayTag < 1 || inJob.keywayTag > 3)
+	{
+		status = eKMRemoteUnknownKeyway;
+	} else if (inJob.pinCount < 4 || inJob.pinCount > kKMRemoteMaxPins)
+	{
+		status = eKMRemoteBadPinCount;
+	} else
+	{
+		for (uint8_t i = 0; i < inJob.pinCount; i++)
+		{
+			if (inJob.pins[i] > 9)
+			{
+				status = eKMRemoteBadPins;
+				outResponse.errorPin = i;
+				break;
+			}
+		}
+	}
+	if (status == eKMRemoteOK)
+	{
+		// customDepths[0] is used as the job ID by the lossy scenario.
+		if (!mJobIDs.insert(inJob.customDepths[0]).second)
+		{
+			mDuplicateJobs++;
+		}
+		mJobEnd = MSPeriod::millis() + kJobMS;
+	}
+	return(status);
+}
+
+/**************************** GetRemoteQueueState *****************************/
+void FakeMachine::GetRemoteQueueState(
+	SKMRemoteQueueState&	outState)
+{
+	outState.queueState = mJobEnd != 0;
+	outState.queuedActions = mJobEnd ? 3 : 0;
+	outState.cutInProgress = mJobEnd != 0;
+	outState.completedCuts = mCompletedCuts;
+	if (mJobEnd)
+	{
+		strcpy(outState.currentAction, "Cut");
+	}
+}
+
+/***************************** GetRemoteTelemetry *****************************/
+void FakeMachine::GetRemoteTelemetry(
+	SKMRemoteTelemetry&	outTelemetry)
+{
+	outTelemetry.x = mX;
+	outTelemetry.queueState = mJobEnd != 0;
+	outTelemetry.motorRunning = mJobEnd != 0;
+	outTelemetry.cutInProgress = mJobEnd != 0;
+}
+
+/******************************** WriteRemote *********************************/
+void FakeMachine::WriteRemote(
+	const uint8_t*	inData,
+	uint16_t		inLength)
+{
+	if (mDebugText)
+	{
+		mToHost += "Cutting pin 3\n";
+	}
+	for (uint16_t i = 0; i < inLength; i++)
+	{
+		uint8_t	thisByte = inData[i];
+		if (Damage(thisByte))
+		{
+			mToHost += (char)thisByte;
+		}
+	}
+}
+
+static uint32_t	sFailures;
+
+/*********************************** Check ************************************/
+static void Check(
+	bool		inPassed,
+	const char*	inWhat)
+{
+	if (!inPassed)
+	{
+		fprintf(stderr, "  FAILED: %s\n", inWhat);
+		sFailures++;
+	}
+}
+
+/*********************************** Clean ************************************/
+static void Clean(
+	uint32_t	inSeed)
+{
+	uint32_t	failures = sFailures;
+	FakeMachine		machine(inSeed);
+	KMRemoteClient	client(&machine, 100, 0);
+	machine.SetDebugText(true);
+	Check(SerialFrame::CRC16((const uint8_t*)"123456789", 9) == 0x29B1,
+								"CRC-16/CCITT check value");
+
+	SKMRemoteCutJob			job = {9, 5, {3, 5, 1, 4, 2}};
+	SKMRemoteCutResponse	response;
+	Check(client.QueueCut(job) == eKMRemoteUnknownKeyway, "unknown keyway");
+	job.keywayTag = 1;
+	job.pinCount = 7;
+	Check(client.QueueCut(job) == eKMRemoteBadPinCount, "bad pin count");
+	job.pinCount = 5;
+	job.pins[2] = 10;
+	Check(client.QueueCut(job, &response) == eKMRemoteBadPins &&
+			response.errorPin == 2, "bad pin");
+	job.pins[2] = 1;
+	Check(client.QueueCut(job) == eKMRemoteOK, "queue cut");
+	Check(client.QueueCut(job) == eKMRemoteBusy, "busy");
+
+	SKMRemoteQueueState	state;
+	Check(client.GetQueueState(state) == eKMRemoteOK &&
+			state.cutInProgress && strcmp(state.currentAction, "Cut") == 0,
+								"queue state");
+	while (machine.Running())
+	{
+		client.GetQueueState(state);
+	}
+	Check(client.GetQueueState(state) == eKMRemoteOK &&
+			state.completedCuts == 1 && !state.cutInProgress, "cut completed");
+
+	// Reports faster than kKMRemoteMinTelemetryPeriod are slowed down.
+	SKMRemoteTelemetry	telemetry;
+	Check(client.SetTelemetry(10) == eKMRemoteOK, "set telemetry");
+	MSPeriod	period(1000);
+	period.Start();
+	uint32_t	reports = 0;
+	while (!period.Passed())
+	{
+		reports += client.NextTelemetry(telemetry, 10);
+	}
+	Check(reports >= 15 && reports <= 1000/kKMRemoteMinTelemetryPeriod + 1,
+								"telemetry rate");
+	Check(client.SetTelemetry(0) == eKMRemoteOK, "stop telemetry");
+	while (client.NextTelemetry(telemetry, 100)){}
+	Check(!client.NextTelemetry(telemetry, 200), "telemetry stopped");
+
+	Check(client.Resends() == 0 && client.DroppedFrames() == 0 &&
+			client.LostTelemetry() == 0, "clean line");
+	printf("clean: %s, %u telemetry reports/s\n",
+			failures == sFailures ? "passed" : "FAILED", reports);
+}
+
+/*********************************** Lossy ************************************/
+static void Lossy(
+	uint32_t	inSeed,
+	uint32_t	inJobCount,
+	uint32_t	inLossRate)
+{
+	uint32_t	failures = sFailures;
+	FakeMachine		machine(inSeed);
+	KMRemoteClient	client(&machine, 50, 8);
+	machine.SetLossRate(inLossRate);
+	client.SetTelemetry(kKMRemoteMinTelemetryPeriod);
+	std::set<int32_t>	acknowledged;
+	uint32_t	busy = 0;
+	uint32_t	noResponse = 0;
+	SKMRemoteCutJob	job = {2, 6, {0, 9, 2, 8, 3, 7}};
+	for (uint32_t jobID = 1; jobID <= inJobCount; jobID++)
+	{
+		job.customDepths[0] = jobID;
+		uint8_t	status;
+		while ((status = client.QueueCut(job)) == eKMRemoteBusy)
+		{
+			busy++;
+			SKMRemoteTelemetry	telemetry;
+			client.NextTelemetry(telemetry, 5);
+		}
+		if (status == eKMRemoteOK)
+		{
+			acknowledged.insert(jobID);
+		} else
+		{
+			noResponse++;
+		}
+	}
+	client.SetTelemetry(0);
+	const std::set<int32_t>&	queued = machine.JobIDs();
+	bool	allQueued = true;
+	for (int32_t jobID : acknowledged)
+	{
+		allQueued = allQueued && queued.count(jobID) != 0;
+	}
+	Check(machine.DuplicateJobs() == 0, "no job queued twice");
+	Check(allQueued, "every acknowledged job queued");
+	Check(queued.size() - acknowledged.size() <= noResponse,
+								"unacknowledged jobs");
+	printf("lossy: %s, %u jobs, %zu acknowledged, %u no response, "
+			"%u duplicates, %u resends, %u dropped frames, %u busy, "
+			"%u telemetry lost\n",
+			failures == sFailures ? "passed" : "FAILED", inJobCount,
+			acknowledged.size(), noResponse, machine.DuplicateJobs(),
+			client.Resends(), client.DroppedFrames(), busy,
+			client.LostTelemetry());
+}
+
+/*********************************** Legacy ***********************************/
+static void Legacy(
+	uint32_t	inSeed)
+{
+	uint32_t	failures = sFailures;
+	FakeMachine		machine(inSeed);
+	KMRemote&	remote = machine.Remote();
+	const char*	text = ">1700000000\r\n";
+	bool	allIgnored = true;
+	for (const char* textPtr = text; *textPtr; textPtr++)
+	{
+		allIgnored = allIgnored && !remote.Receive(*textPtr);
+	}
+	Check(allIgnored, "text outside of a frame returned");
+
+	/*
+	*	A frame containing '>' whose opening flag is lost.  None of the
+	*	frame's bytes may be taken as the time command.
+	*/
+	SKMRemoteCutJob	job = {'>', '>', {'>', '>'}};
+	uint8_t	frame[SerialFrame::kMaxFrameSize];
+	uint16_t	frameLength = SerialFrame::Encode('>', kKMRemoteQueueCut, &job,
+								sizeof(SKMRemoteCutJob), frame);
+	bool	commandSeen = false;
+	for (uint16_t i = 1; i < frameLength; i++)
+	{
+		commandSeen = commandSeen ||
+			(!remote.Receive(frame[i]) && frame[i] == SerialFrame::kCommandChar);
+	}
+	Check(!commandSeen, "'>' within a frame escaped");
+	Check(!machine.Running(), "frame without opening flag ignored");
+	printf("legacy: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	uint32_t	jobCount = 100;
+	uint32_t	seed = 1;
+	uint32_t	lossRate = 400;
+	for (int i = 1; i < argc; i++)
+	{
+		if (i + 1 < argc && strcmp(argv[i], "-n") == 0)
+		{
+			jobCount = atoi(argv[++i]);
+		} else if (i + 1 < argc && strcmp(argv[i], "-seed") == 0)
+		{
+			seed = atoi(argv[++i]);
+		} else if (i + 1 < argc && strcmp(argv[i], "-loss") == 0)
+		{
+			lossRate = atoi(argv[++i]);
+		} else
+		{
+			fprintf(stderr, "Usage: %s [-n jobCount] [-seed seed] [-loss 1/N bytes]\n", argv[0]);
+			return(1);
+		}
+	}
+	Clean(seed);
+	Lossy(seed, jobCount, lossRate);
+	Legacy(seed);
+	return(sFailures ? 1 : 0);
+}
@@ -0,0 +1,865 @@
+/*
+*	KMRenderBenchmark.cpp, Copyright Jonathan Mackey 2023
+*	Host benchmark of the KeyMachine XView hierarchy redraws.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Builds the real view tree from KeyMachine/KMXViews.h against a
+*	FramebufferDisplayController and times the important redraws.  Each
+*	scenario is reported as one line of JSON containing the host time per
+*	iteration and the SPI traffic TFT_ILI9488 would have generated.  The
+*	estimated SPI time assumes the 15MHz clock used by TFT_ST77XX.  The
+*	Decode scenarios only unpack glyphs, they report the pixels decoded per
+*	second.
+*
+*	Usage: KMRenderBenchmark [-n iterations] [-ppm outputDir] [-nocache] [-noline]
+*			[-noindex]
+*
+*	-nocache disables the XFont glyph cache.
+*	-noline disables the XFont line buffer.
+*	-noindex disables the XFont glyph indexes of the UI fonts.
+*
+*	The SD and Layer scenarios emulate the SD card using files written to
+*	/tmp.  The Layer scenarios draw the dialogs using their static layers.
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -D__MACH__ -IHostTools/Common -IKeyMachine \
+*		$(for d in libraries/[A-Z]*; do echo -n "-I$d "; done) \
+*		HostTools/KMRenderBenchmark/KMRenderBenchmark.cpp \
+*		libraries/XView/[A-Z]*.cpp libraries/XFont/[A-Z]*.cpp \
+*		libraries/DisplayController/DisplayController.cpp \
+*		libraries/DisplayController/FramebufferDisplayController.cpp \
+*		libraries/DisplayController/StripDisplayController.cpp \
+*		libraries/DisplayController/CircleQuadrant.cpp \
+*		libraries/DisplayController/TintedSpan.cpp \
+*		libraries/DisplayController/TintTable.cpp \
+*		libraries/DataStream/DataStream.cpp libraries/UnixTime/UnixTime.cpp \
+*		libraries/SdFatDataStream/SdFatDataStream.cpp \
+*		libraries/ValueFormatter/ValueFormatter.cpp libraries/BMP280Utils/BMP280Utils.cpp \
+*		KeyMachine/KMPinsValueField.cpp KeyMachine/KeySpec.cpp \
+*		KeyMachine/KMTextFile.cpp \
+*		KeyMachine/KMKeywaySearchField.cpp KeyMachine/KMKeywayList.cpp KeyMachine/KeySpecCatalog.cpp \
+*		-o KMRenderBenchmark
+*/
+#include "pgmspace_stub.h"
+#include "DialogLayerWriter.h"
+#include "FramebufferDisplayController.h"
+#include "SdFatDataStream.h"
+#include "StripDisplayController.h"
+#include "UnixTime.h"
+#include "XFont.h"
+#include "XGlyphCache.h"
+#include "XGlyphIndex.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+XFont	xFont;
+#include "MyriadPro-Regular_20.h"
+#include "MyriadPro-Regular_20_4b.h"
+#include "Avenir_64.h"
+#include "Avenir_64_4b.h"
+#include "KM_Icons.h"
+#include "KM_Icons_4b.h"
+// 1-bit font, only used to measure the 1-bit decoder
+#include "MyriadPro-Regular_20_1b.h"
+#ifdef KMB_8BIT_FONTS
+// 8-bit fonts (antialiased)
+#define UI20ptFont	MyriadPro_Regular_20::font
+#define UI64ptFont	Avenir_64::font
+#define UIIconsFont	KM_Icons::font
+typedef XFont16BitDataStream	UIFontDataStream;
+#else
+// 4-bit fonts (antialiased), same as KeyMachineSTM32.cpp
+#define UI20ptFont	MyriadPro_Regular_20_4b::font
+#define UI64ptFont	Avenir_64_4b::font
+#define UIIconsFont	KM_Icons_4b::font
+typedef XFont4BitDataStream		UIFontDataStream;
+#endif
+#include "KMXViews.h"
+
+// Same as the hardcoded SKeySpec in KeyMachineSTM32.cpp
+static SKeySpec	schlageKeySpec = {"Schlage", 0.83909963117, 0.015, 0.200, 0.343, 0.031, 0.1562, 0.231, 7, 0, 9, false, true, kSchlageSC1MenuItem, SKeySpec::e6PinMask | SKeySpec::e5PinMask};
+
+/*
+*	Config.h can't be included by host builds (it uses Arduino pin types), the
+*	values below are the same as those in Config.h.
+*/
+static const uint16_t	kDisplayWidth = 320;
+static const uint16_t	kDisplayHeight = 480;
+static const uint16_t	kStripBufferPixels = 70*20;	// Same as Config.h
+static const uint16_t	kGlyphCachePixels = 4096;
+static const uint16_t	kLineBufferPixels = 480*5;
+
+static FramebufferDisplayController	sDisplay(kDisplayWidth, kDisplayHeight);
+static uint16_t		sStripBuffer[kStripBufferPixels];
+static StripDisplayController	sStrip(sStripBuffer, kStripBufferPixels);
+static uint16_t		sGlyphCacheBuffer[kGlyphCachePixels];
+static XGlyphCache	sGlyphCache(sGlyphCacheBuffer, kGlyphCachePixels);
+static uint16_t		sLineBuffer[kLineBufferPixels];
+static XGlyphIndex	sUI20ptGlyphIndex;
+static XGlyphIndex	sUI64ptGlyphIndex;
+static const char*	sPPMDir;
+/*
+*	SD card emulation.  The glyph data of the UI fonts and a full screen
+*	image are written to files.  See WriteSDFiles.
+*/
+static const uint16_t	kSDBufferSize = 4096;
+static uint8_t			sSD20ptBuffer[kSDBufferSize];
+static SdFatDataStream	sSD20ptStream(sSD20ptBuffer, kSDBufferSize, 2);
+static UIFontDataStream	sSD20ptFontStream(&xFont, &sSD20ptStream);
+static uint8_t			sSD64ptBuffer[kSDBufferSize];
+static SdFatDataStream	sSD64ptStream(sSD64ptBuffer, kSDBufferSize, 2);
+static UIFontDataStream	sSD64ptFontStream(&xFont, &sSD64ptStream);
+static uint8_t			sSDImageBuffer[kSDBufferSize];
+static SdFatPixelStream	sSDImageStream(sSDImageBuffer, kSDBufferSize, 2);
+// Same as KeyMachineSTM32's mDialogLayer
+static const uint16_t	kDialogLayerBufferSize = 2048;
+static uint8_t			sSDLayerBuffer[kDialogLayerBufferSize];
+static SdFatPixelStream	sSDLayerStream(sSDLayerBuffer, kDialogLayerBufferSize, 1);
+static XFontDataStream*	sSaved20ptFontStream;
+static XFontDataStream*	sSaved64ptFontStream;
+static uint32_t		sDecodedPixels;	// Pixels unpacked by the Decode scenarios
+
+/*
+*	A keyway menu with more items than will fit on the display.  This is
+*	used to measure scrolling.
+*/
+static const uint16_t	kLongMenuItems = 60;
+static char		sLongMenuStrs[kLongMenuItems][16];
+static XMenu	longKeywayMenu(kKeywayMenuTag,
+					&UI20ptFont, nullptr, &keywayPopUp, kDialogBGColor);
+
+/*
+*	A virtual keyway menu with far more items than the long menu.  Only
+*	kVirtualMenuItems XMenuItems exist, the same as the KeyMachine's keyway
+*	menu.  The time to show and scroll it shouldn't depend on
+*	kVirtualMenuCount.
+*/
+static const uint16_t	kVirtualMenuCount = 1000;
+static const uint16_t	kVirtualMenuItems = 11;	// Same as KMKeywayList
+static XMenuItem	sVirtualMenuItems[kVirtualMenuItems];
+static char			sVirtualMenuStrs[kVirtualMenuItems][16];
+static XMenu	virtualKeywayMenu(kKeywayMenuTag,
+					&UI20ptFont, nullptr, &keywayPopUp, kDialogBGColor);
+
+class VirtualMenuDataSource : public XMenuDataSource
+{
+public:
+	virtual uint16_t		GetMenuItemCount(
+								XMenu*					inMenu)
+								{return(kVirtualMenuCount);}
+	virtual void			LoadMenuItem(
+								XMenu*					inMenu,
+								uint16_t				inIndex,
+								XMenuItem*				ioItem)
+	{
+		char*	itemStr = sVirtualMenuStrs[ioItem - sVirtualMenuItems];
+		snprintf(itemStr, sizeof(sVirtualMenuStrs[0]), "Keyway %u", inIndex+1);
+		ioItem->SetTag(inIndex+1);
+		ioItem->SetString(itemStr);
+	}
+	virtual uint16_t		FindMenuItemIndex(
+								XMenu*					inMenu,
+								uint16_t				inTag)
+								{return(inTag ? inTag-1 : kVirtualMenuCount);}
+};
+static VirtualMenuDataSource	sVirtualMenuDataSource;
+
+typedef void (*ScenarioPtr)(void);
+
+/********************************* ShowInfo ***********************************/
+/*
+*	Same as KeyMachineSTM32::ShowInfoView
+*/
+static void ShowInfo(void)
+{
+	infoView.SetVisible(true);
+	rootView.Draw(0, 0, 480, 320);
+}
+
+/******************************** SetInfoDate *********************************/
+/*
+*	The date is reset before each update so that every iteration, with or
+*	without the strip, draws the same change.
+*/
+static const time32_t	kInfoDate = 946684800;	// 2000-01-01
+
+static void SetInfoDate(void)
+{
+	infoDateValueField.SetValue(kInfoDate);
+}
+
+/******************************* UpdateInfoDate *******************************/
+/*
+*	Same as KeyMachineSTM32::UpdateInfoView after the time changes.
+*/
+static void UpdateInfoDate(void)
+{
+	infoDateValueField.SetValue(kInfoDate + 1);
+}
+
+/****************************** ShowLayeredDialog *****************************/
+/*
+*	Same as KeyMachineSTM32::ShowLayeredDialog.
+*/
+static void ShowLayeredDialog(
+	XDialogBox&	inDialog,
+	const char*	inPath)
+{
+	char	path[256];
+	snprintf(path, sizeof(path), "/tmp/KMRenderBenchmark_%s", inPath);
+	sSDLayerStream.Open(path);
+	inDialog.Show();
+	sSDLayerStream.Close();
+}
+
+/******************************* LoadCutKeyDialog *****************************/
+/*
+*	Same as KeyMachineSTM32::ShowCutKeyDialog using the default prefs.
+*/
+static void LoadCutKeyDialog(void)
+{
+	int32_t	pinDepths[8] = {0};
+	keywayPopUp.SelectMenuItem(kSchlageSC1MenuItem);
+	pinCountPopUp.SelectMenuItem(k5PinMenuItem);
+	pinsValueField.SetPinCount(k5PinMenuItem, false);
+	pinsValueField.SetKeySpec(&schlageKeySpec, false);
+	pinsValueField.SetPinDepthsDec22mm(pinDepths);
+}
+
+/******************************* ShowCutKeyDialog *****************************/
+static void ShowCutKeyDialog(void)
+{
+	LoadCutKeyDialog();
+	cutKeyDialog.Show();
+}
+
+/**************************** ShowCutKeyDialogLayer ***************************/
+static void ShowCutKeyDialogLayer(void)
+{
+	LoadCutKeyDialog();
+	ShowLayeredDialog(cutKeyDialog, kCutKeyLayerPath);
+}
+
+/******************************* CloseCutKeyDialog ****************************/
+static void CloseCutKeyDialog(void)
+{
+	cutKeyDialog.DoCancel();
+}
+
+/***************************** LoadSetupZeroDialog ****************************/
+/*
+*	Same as KeyMachineSTM32::ShowSetupZeroDialog using the default prefs.
+*/
+static void LoadSetupZeroDialog(void)
+{
+	currentXValueField.SetValue(4700, false);	// Config::kKeyHolderRoughXSteps
+	currentZValueField.SetValue(1600, false);	// Config::kKeyHolderRoughZSteps
+	zeroXOffsetValueField.SetValue(0, false);
+	zeroZOffsetValueField.SetValue(457, false);	// Config::kKeyHolderDepth
+	zeroXOffsetValueField.SetIncrement(kPt01mmMenuItem);
+	zeroZOffsetValueField.SetIncrement(kPt01mmMenuItem);
+	incrementPopUp.SelectMenuItem(kPt01mmMenuItem);
+}
+
+/***************************** ShowSetupZeroDialog ****************************/
+static void ShowSetupZeroDialog(void)
+{
+	LoadSetupZeroDialog();
+	setupKeyHolderOriginDialog.Show();
+}
+
+/************************** ShowSetupZeroDialogLayer **************************/
+static void ShowSetupZeroDialogLayer(void)
+{
+	LoadSetupZeroDialog();
+	ShowLayeredDialog(setupKeyHolderOriginDialog, kSetupZeroLayerPath);
+}
+
+/**************************** CloseSetupZeroDialog ****************************/
+static void CloseSetupZeroDialog(void)
+{
+	setupKeyHolderOriginDialog.DoCancel();
+}
+
+/*************************** ShowAdjustOriginDialog ***************************/
+/*
+*	Same as KeyMachineSTM32::ShowAdjustOriginDialog.
+*/
+static void ShowAdjustOriginDialog(void)
+{
+	deltaXValueField.SetValue(0, false);
+	deltaZValueField.SetValue(0, false);
+	adjustOriginDialog.Show();
+}
+
+/************************* ShowAdjustOriginDialogLayer ************************/
+static void ShowAdjustOriginDialogLayer(void)
+{
+	deltaXValueField.SetValue(0, false);
+	deltaZValueField.SetValue(0, false);
+	ShowLayeredDialog(adjustOriginDialog, kAdjustOriginLayerPath);
+}
+
+/*************************** CloseAdjustOriginDialog **************************/
+static void CloseAdjustOriginDialog(void)
+{
+	adjustOriginDialog.DoCancel();
+}
+
+/******************************** JogPosition *********************************/
+/*
+*	Same as KeyMachineSTM32::Update when the steppers have moved while the
+*	Setup Origin dialog is visible.  The dialog is shown with the X and Z
+*	positions 47.00 and 16.00.
+*/
+static void JogPosition(void)
+{
+	currentXValueField.SetValue(4712, true);
+	currentZValueField.SetValue(1601, true);
+}
+
+/********************************* ChangePin **********************************/
+static void ChangePin(void)
+{
+	static bool	sIncrement;
+	sIncrement = !sIncrement;
+	if (sIncrement)
+	{
+		pinsValueField.IncrementValue();
+	} else
+	{
+		pinsValueField.DecrementValue();
+	}
+}
+
+/****************************** ChangePinDepth ********************************/
+/*
+*	Same as tapping the pin depth stepper of the Cut Key dialog.  Unlike the
+*	pins field, the pin depth is an XNumberValueField so it's drawn using the
+*	strip when there is one.
+*/
+static void ChangePinDepth(void)
+{
+	static bool	sIncrement;
+	sIncrement = !sIncrement;
+	if (sIncrement)
+	{
+		pinDepthValueField.IncrementValue();
+	} else
+	{
+		pinDepthValueField.DecrementValue();
+	}
+}
+
+/******************************** ShowKeywayMenu *****************************/
+static void ShowKeywayMenu(void)
+{
+	keywayMenu.Show();
+}
+
+/******************************** HideKeywayMenu *****************************/
+static void HideKeywayMenu(void)
+{
+	keywayMenu.Hide();
+	cutKeyDialog.DoCancel();
+}
+
+/******************************** InitLongMenu ********************************/
+static void InitLongMenu(void)
+{
+	for (uint16_t i = kLongMenuItems; i; i--)
+	{
+		snprintf(sLongMenuStrs[i-1], sizeof(sLongMenuStrs[0]), "Keyway %u", i);
+		longKeywayMenu.InsertMenuItem(new XMenuItem(i, sLongMenuStrs[i-1]));
+	}
+	longKeywayMenu.SetSuperViewAnchor(XMenu::eAnchorCentered);
+	virtualKeywayMenu.SetDataSource(&sVirtualMenuDataSource,
+								sVirtualMenuItems, kVirtualMenuItems);
+	virtualKeywayMenu.SetSuperViewAnchor(XMenu::eAnchorCentered);
+}
+
+/******************************** ShowLongMenu ********************************/
+static void ShowLongMenu(void)
+{
+	ShowCutKeyDialog();
+	longKeywayMenu.Show();
+}
+
+/******************************** OpenLongMenu ********************************/
+static void OpenLongMenu(void)
+{
+	longKeywayMenu.Show();
+}
+
+/***************************** ScrollLongMenuItem *****************************/
+static void ScrollLongMenuItem(void)
+{
+	longKeywayMenu.ScrollBy(1);
+}
+
+/***************************** ScrollLongMenuPage *****************************/
+static void ScrollLongMenuPage(void)
+{
+	// Same as a tap on the menu's down arrow.
+	longKeywayMenu.MouseDown(longKeywayMenu.X(), longKeywayMenu.Y() + longKeywayMenu.Height() - 2);
+	longKeywayMenu.MouseUp(longKeywayMenu.X(), longKeywayMenu.Y() + longKeywayMenu.Height() - 2);
+}
+
+/******************************** HideLongMenu ********************************/
+static void HideLongMenu(void)
+{
+	longKeywayMenu.Hide();
+	cutKeyDialog.DoCancel();
+}
+
+/****************************** OpenVirtualMenu *******************************/
+static void OpenVirtualMenu(void)
+{
+	virtualKeywayMenu.Show();
+}
+
+/****************************** ShowVirtualMenu *******************************/
+static void ShowVirtualMenu(void)
+{
+	ShowCutKeyDialog();
+	virtualKeywayMenu.Show();
+}
+
+/**************************** ScrollVirtualMenuItem ***************************/
+static void ScrollVirtualMenuItem(void)
+{
+	virtualKeywayMenu.ScrollBy(1);
+}
+
+/**************************** ScrollVirtualMenuPage ***************************/
+static void ScrollVirtualMenuPage(void)
+{
+	// Same as a tap on the menu's down arrow.
+	virtualKeywayMenu.MouseDown(virtualKeywayMenu.X(), virtualKeywayMenu.Y() + virtualKeywayMenu.Height() - 2);
+	virtualKeywayMenu.MouseUp(virtualKeywayMenu.X(), virtualKeywayMenu.Y() + virtualKeywayMenu.Height() - 2);
+}
+
+/****************************** HideVirtualMenu *******************************/
+static void HideVirtualMenu(void)
+{
+	virtualKeywayMenu.Hide();
+	cutKeyDialog.DoCancel();
+}
+
+/********************************* ShowWarning ********************************/
+static void ShowWarning(void)
+{
+	warningDialog.DoMessage(kSteppersBusyStr);
+}
+
+/********************************* CloseWarning *******************************/
+static void CloseWarning(void)
+{
+	warningDialog.DoCancel();
+}
+
+/******************************** WriteSDFile *********************************/
+static bool WriteSDFile(
+	const char*	inPath,
+	const void*	inData,
+	uint32_t	inLength)
+{
+	FILE*	file = fopen(inPath, "wb");
+	if (file)
+	{
+		fwrite(inData, 1, inLength, file);
+		fclose(file);
+	}
+	return(file != nullptr);
+}
+
+/******************************** WriteSDFiles ********************************/
+/*
+*	Writes the glyph data of the UI fonts and a full screen gradient image,
+*	then opens them.  The static layers of the dialogs are written and set
+*	the same as KMDialogLayers and KeyMachineSTM32::begin.
+*/
+static bool WriteSDFiles(void)
+{
+	static const char	kSD20ptPath[] = "/tmp/KMRenderBenchmark_20pt.bin";
+	static const char	kSD64ptPath[] = "/tmp/KMRenderBenchmark_64pt.bin";
+	static const char	kSDImagePath[] = "/tmp/KMRenderBenchmark_image.bin";
+	static uint16_t	sImage[kDisplayWidth*kDisplayHeight];
+	for (uint32_t i = 0; i < kDisplayWidth*kDisplayHeight; i++)
+	{
+		uint16_t	row = i/kDisplayHeight;
+		uint16_t	column = i%kDisplayHeight;
+		sImage[i] = ((row >> 3) << 11) | ((column >> 3) << 5) | ((row + column) >> 5);
+	}
+	DataStream*	source20pt = UI20ptFont.glyphData->GetSourceStream();
+	DataStream*	source64pt = UI64ptFont.glyphData->GetSourceStream();
+	static uint8_t	sGlyphData[0x10000];
+	source20pt->Seek(0, DataStream::eSeekSet);
+	uint32_t	length20pt = source20pt->Read(sizeof(sGlyphData), sGlyphData);
+	bool	success = WriteSDFile(kSD20ptPath, sGlyphData, length20pt);
+	source64pt->Seek(0, DataStream::eSeekSet);
+	uint32_t	length64pt = source64pt->Read(sizeof(sGlyphData), sGlyphData);
+	success = success &&
+		WriteSDFile(kSD64ptPath, sGlyphData, length64pt) &&
+		WriteSDFile(kSDImagePath, sImage, sizeof(sImage)) &&
+		sSD20ptStream.Open(kSD20ptPath) &&
+		sSD64ptStream.Open(kSD64ptPath) &&
+		sSDImageStream.Open(kSDImagePath);
+	struct SDialogLayer
+	{
+		XDialogBox*		dialog;
+		XView* const*	dynamicViews;
+		const char*		path;
+	} const	kDialogLayers[] =
+	{
+		{&setupKeyHolderOriginDialog, setupKeyHolderOriginDynamicViews, kSetupZeroLayerPath},
+		{&adjustOriginDialog, adjustOriginDynamicViews, kAdjustOriginLayerPath},
+		{&cutKeyDialog, cutKeyDynamicViews, kCutKeyLayerPath}
+	};
+	for (uint8_t i = 0; success && i < 3; i++)
+	{
+		char	path[256];
+		snprintf(path, sizeof(path), "/tmp/KMRenderBenchmark_%s", kDialogLayers[i].path);
+		success = WriteDialogLayer(sDisplay, *kDialogLayers[i].dialog,
+							kDialogLayers[i].dynamicViews, path);
+		kDialogLayers[i].dialog->SetStaticLayer(&sSDLayerStream, kDialogLayers[i].dynamicViews);
+	}
+	return(success);
+}
+
+/******************************** UseSDFonts **********************************/
+/*
+*	Replaces the glyph data of the UI fonts with the SD card files.  The glyph
+*	cache is cleared so that the glyphs are unpacked from the SD card.
+*/
+static void UseSDFonts(void)
+{
+	sSaved20ptFontStream = UI20ptFont.glyphData;
+	sSaved64ptFontStream = UI64ptFont.glyphData;
+	UI20ptFont.glyphData = &sSD20ptFontStream;
+	UI64ptFont.glyphData = &sSD64ptFontStream;
+	sGlyphCache.Clear();
+}
+
+/******************************** UseFlashFonts *******************************/
+static void UseFlashFonts(void)
+{
+	UI20ptFont.glyphData = sSaved20ptFontStream;
+	UI64ptFont.glyphData = sSaved64ptFontStream;
+	sGlyphCache.Clear();
+}
+
+/****************************** CloseCutKeyDialogSD ***************************/
+static void CloseCutKeyDialogSD(void)
+{
+	cutKeyDialog.DoCancel();
+	UseFlashFonts();
+}
+
+/******************************** DrawSDImage *********************************/
+static void DrawSDImage(void)
+{
+	sSDImageStream.Seek(0, DataStream::eSeekSet);
+	sDisplay.MoveTo(0, 0);
+	sDisplay.StreamCopyBlock(&sSDImageStream, kDisplayWidth, kDisplayHeight);
+}
+
+/******************************* MeasureLongMenu ******************************/
+/*
+*	Measures each item of the long menu, the same as XMenu does when it sizes
+*	itself.  Nothing is drawn.
+*/
+static void MeasureLongMenu(void)
+{
+	UI20ptFont.MakeCurrent();
+	uint16_t	height, width;
+	for (uint16_t i = 0; i < kLongMenuItems; i++)
+	{
+		xFont.MeasureStr(sLongMenuStrs[i], height, width);
+	}
+}
+
+/********************************* DecodeFont *********************************/
+/*
+*	Unpacks every glyph of inFont without drawing it.  This measures the
+*	font's glyph data stream decoder rather than the display.  A non-black
+*	background is used so that every tint is blended.
+*/
+static void DecodeFont(
+	XFont::Font*	inFont)
+{
+	static uint16_t	sPixels[255*255];
+	XFont::Font*	savedFont = xFont.GetFont();
+	uint16_t	savedTextColor = xFont.GetTextColor();
+	uint16_t	savedBGTextColor = xFont.GetBGTextColor();
+	xFont.SetFont(inFont);
+	xFont.SetTextColor(XFont::eWhite);
+	xFont.SetBGTextColor(XFont::eBlue);
+	uint16_t	numCharCodes = xFont.GetFontHeader().numCharCodes;
+	for (uint16_t entryIndex = 0; entryIndex < numCharCodes; entryIndex++)
+	{
+		if (xFont.LoadGlyphHeader(entryIndex))
+		{
+			const GlyphHeader&	glyph = xFont.Glyph();
+			uint32_t	pixels = (uint32_t)glyph.rows * glyph.columns;
+			inFont->glyphData->Seek(inFont->glyphDataOffsets[entryIndex] +
+							sizeof(GlyphHeader), DataStream::eSeekSet);
+			inFont->glyphData->Read(pixels, sPixels);
+			sDecodedPixels += pixels;
+		}
+	}
+	xFont.SetFont(savedFont);
+	xFont.SetTextColor(savedTextColor);
+	xFont.SetBGTextColor(savedBGTextColor);
+}
+
+/******************************* DecodeAvenir64 *******************************/
+static void DecodeAvenir64(void)
+{
+	DecodeFont(&Avenir_64::font);
+}
+
+/****************************** DecodeAvenir64_4b *****************************/
+static void DecodeAvenir64_4b(void)
+{
+	DecodeFont(&Avenir_64_4b::font);
+}
+
+/***************************** DecodeMyriadPro20 ******************************/
+static void DecodeMyriadPro20(void)
+{
+	DecodeFont(&MyriadPro_Regular_20::font);
+}
+
+/**************************** DecodeMyriadPro20_4b ****************************/
+static void DecodeMyriadPro20_4b(void)
+{
+	DecodeFont(&MyriadPro_Regular_20_4b::font);
+}
+
+/**************************** DecodeMyriadPro20_1b ****************************/
+static void DecodeMyriadPro20_1b(void)
+{
+	DecodeFont(&MyriadPro_Regular_20_1b::font);
+}
+
+/********************************* NoSetup ************************************/
+static void NoSetup(void)
+{
+}
+
+struct SScenario
+{
+	const char*	name;
+	ScenarioPtr	setup;		// Not timed, called before each iteration
+	ScenarioPtr	scenario;	// Timed
+	ScenarioPtr	cleanup;	// Not timed, called after each iteration
+};
+
+static const SScenario	kScenarios[] =
+{
+	{"InfoView", NoSetup, ShowInfo, NoSetup},
+	{"InfoViewDateUpdate", SetInfoDate, UpdateInfoDate, NoSetup},
+	{"CutKeyDialogOpen", NoSetup, ShowCutKeyDialog, CloseCutKeyDialog},
+	{"PinChange", ShowCutKeyDialog, ChangePin, CloseCutKeyDialog},
+	{"PinDepthChange", ShowCutKeyDialog, ChangePinDepth, CloseCutKeyDialog},
+	{"KeywayMenuPopUp", ShowCutKeyDialog, ShowKeywayMenu, HideKeywayMenu},
+	{"WarningAlert", NoSetup, ShowWarning, CloseWarning},
+	{"LongMenuOpen", ShowCutKeyDialog, OpenLongMenu, HideLongMenu},
+	{"LongMenuScrollItem", ShowLongMenu, ScrollLongMenuItem, HideLongMenu},
+	{"LongMenuScrollPage", ShowLongMenu, ScrollLongMenuPage, HideLongMenu},
+	{"LongMenuMeasure", NoSetup, MeasureLongMenu, NoSetup},
+	{"VirtualMenuOpen", ShowCutKeyDialog, OpenVirtualMenu, HideVirtualMenu},
+	{"VirtualMenuScrollItem", ShowVirtualMenu, ScrollVirtualMenuItem, HideVirtualMenu},
+	{"VirtualMenuScrollPage", ShowVirtualMenu, ScrollVirtualMenuPage, HideVirtualMenu},
+	{"InfoViewSD", UseSDFonts, ShowInfo, UseFlashFonts},
+	{"CutKeyDialogOpenSD", UseSDFonts, ShowCutKeyDialog, CloseCutKeyDialogSD},
+	{"CutKeyDialogOpenLayer", NoSetup, ShowCutKeyDialogLayer, CloseCutKeyDialog},
+	{"SetupZeroDialogOpen", NoSetup, ShowSetupZeroDialog, CloseSetupZeroDialog},
+	{"SetupZeroDialogOpenLayer", NoSetup, ShowSetupZeroDialogLayer, CloseSetupZeroDialog},
+	{"PositionUpdate", ShowSetupZeroDialog, JogPosition, CloseSetupZeroDialog},
+	{"AdjustOriginDialogOpen", NoSetup, ShowAdjustOriginDialog, CloseAdjustOriginDialog},
+	{"AdjustOriginDialogOpenLayer", NoSetup, ShowAdjustOriginDialogLayer, CloseAdjustOriginDialog},
+	{"ImageSD", NoSetup, DrawSDImage, ShowInfo},
+	{"Avenir64Decode", NoSetup, DecodeAvenir64, NoSetup},
+	{"Avenir64_4bDecode", NoSetup, DecodeAvenir64_4b, NoSetup},
+	{"MyriadPro20Decode", NoSetup, DecodeMyriadPro20, NoSetup},
+	{"MyriadPro20_4bDecode", NoSetup, DecodeMyriadPro20_4b, NoSetup},
+	{"MyriadPro20_1bDecode", NoSetup, DecodeMyriadPro20_1b, NoSetup},
+	{nullptr}
+};
+
+/********************************* RunScenario ********************************/
+static void RunScenario(
+	const SScenario&	inScenario,
+	uint32_t			inIterations,
+	bool				inUseStrip)
+{
+	FramebufferDisplayController::SSPIStats	totals;
+	FramebufferDisplayController::SSPIStats	stats[FramebufferDisplayController::eNumPrimitives];
+	std::chrono::nanoseconds	elapsed(0);
+	uint32_t	glyphCacheHits = 0;
+	uint32_t	glyphCacheMisses = 0;
+	uint32_t	sdHits = 0;
+	uint32_t	sdMisses = 0;
+	rootView.SetStrip(inUseStrip ? &sStrip : nullptr);
+	for (uint32_t i = 0; i < inIterations; i++)
+	{
+		inScenario.setup();
+		sDisplay.ResetStats();
+		sGlyphCache.ResetStats();
+		sSD20ptStream.ResetStats();
+		sSD64ptStream.ResetStats();
+		sSDImageStream.ResetStats();
+		sSDLayerStream.ResetStats();
+		sDecodedPixels = 0;
+		auto	start = std::chrono::steady_clock::now();
+		inScenario.scenario();
+		elapsed += std::chrono::steady_clock::now() - start;
+		/*
+		*	The stats of the last iteration are reported.  The scenarios are
+		*	deterministic so the stats of each iteration are the same except
+		*	for the first iteration of a scenario that changes state.  The
+		*	stats are copied here because cleanup also draws.
+		*/
+		sDisplay.GetTotals(totals);
+		for (uint8_t p = 0; p < FramebufferDisplayController::eNumPrimitives; p++)
+		{
+			stats[p] = sDisplay.GetStats((FramebufferDisplayController::EPrimitive)p);
+		}
+		glyphCacheHits = sGlyphCache.Hits();
+		glyphCacheMisses = sGlyphCache.Misses();
+		sdHits = sSD20ptStream.Hits() + sSD64ptStream.Hits() +
+					sSDImageStream.Hits() + sSDLayerStream.Hits();
+		sdMisses = sSD20ptStream.Misses() + sSD64ptStream.Misses() +
+					sSDImageStream.Misses() + sSDLayerStream.Misses();
+		if (sPPMDir && i == 0)
+		{
+			char	path[1024];
+			snprintf(path, sizeof(path), "%s/%s%s.ppm", sPPMDir,
+						inScenario.name, inUseStrip ? "_strip" : "");
+			sDisplay.WritePPM(path);
+		}
+		inScenario.cleanup();
+	}
+	uint32_t	spiBytes = totals.cmdBytes + totals.dataBytes;
+	double	micros = (double)elapsed.count()/inIterations/1000.0;
+	printf("{\"scenario\":\"%s\",\"strip\":%s,\"iterations\":%u,"
+			"\"hostMicros\":%.2f,\"calls\":%u,\"transactions\":%u,"
+			"\"cmdBytes\":%u,\"dataBytes\":%u,\"pixels\":%u,"
+			"\"estSPIMicros\":%.1f,\"glyphCacheHits\":%u,\"glyphCacheMisses\":%u,"
+			"\"decodedPixels\":%u,\"decodedMPixelsPerSec\":%.1f,"
+			"\"sdHits\":%u,\"sdMisses\":%u",
+			inScenario.name, inUseStrip ? "true" : "false", inIterations,
+			micros, totals.calls,
+			totals.transactions, totals.cmdBytes, totals.dataBytes,
+			totals.pixels, (double)spiBytes*8/15.0, glyphCacheHits,
+			glyphCacheMisses, sDecodedPixels,
+			micros > 0 ? sDecodedPixels/micros : 0.0, sdHits, sdMisses);
+	printf(",\"primitives\":{");
+	for (uint8_t p = 0; p < FramebufferDisplayController::eNumPrimitives; p++)
+	{
+		printf("%s\"%s\":{\"calls\":%u,\"bytes\":%u}", p ? "," : "",
+			FramebufferDisplayController::PrimitiveName((FramebufferDisplayController::EPrimitive)p),
+			stats[p].calls, stats[p].cmdBytes + stats[p].dataBytes);
+	}
+	printf("}}\n");
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	uint32_t	iterations = 20;
+	bool		useGlyphCache = true;
+	bool		useLineBuffer = true;
+	bool		useGlyphIndex = true;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && (i+1) < argc)
+		{
+			iterations = (uint32_t)atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-ppm") == 0 && (i+1) < argc)
+		{
+			sPPMDir = argv[++i];
+		} else if (strcmp(argv[i], "-nocache") == 0)
+		{
+			useGlyphCache = false;
+		} else if (strcmp(argv[i], "-noline") == 0)
+		{
+			useLineBuffer = false;
+		} else if (strcmp(argv[i], "-noindex") == 0)
+		{
+			useGlyphIndex = false;
+		} else
+		{
+			fprintf(stderr, "Usage: %s [-n iterations] [-ppm outputDir] [-nocache] [-noline] [-noindex]\n", argv[0]);
+			return(1);
+		}
+	}
+	if (iterations == 0)
+	{
+		iterations = 1;
+	}
+	/*
+	*	Same setup as KeyMachineSTM32::begin
+	*/
+	rootView.SetSize(kDisplayHeight, kDisplayWidth);
+	rootView.SetDisplay(&sDisplay);
+	rootView.SetModalView(&mainMenuBtn);
+	warningDialog.SetMinDialogSize();
+	if (useGlyphIndex)
+	{
+		UI20ptFont.SetGlyphIndex(&sUI20ptGlyphIndex);
+		UI64ptFont.SetGlyphIndex(&sUI64ptGlyphIndex);
+	}
+	xFont.SetDisplay(&sDisplay, &UI20ptFont);
+	xFont.SetGlyphCache(useGlyphCache ? &sGlyphCache : nullptr);
+	xFont.SetLineBuffer(useLineBuffer ? sLineBuffer : nullptr, kLineBufferPixels);
+	cutKeyDialog.AutoSize();
+	resetBtn.SetOrigin(resetBtn.X(), cutKeyDialog.GetOKButton()->Y());
+	InitLongMenu();
+	ShowInfo();	// The dialog layers are written over the info view
+	if (!WriteSDFiles())
+	{
+		fprintf(stderr, "Unable to write the SD files to /tmp\n");
+		return(1);
+	}
+
+	/*
+	*	Each scenario is run without and then with the strip so that both
+	*	runs start from the same state.  Running all of the scenarios twice
+	*	doesn't, e.g. the second InfoView is drawn after InfoViewDateUpdate
+	*	and the SD scenarios.
+	*/
+	for (const SScenario* scenario = kScenarios; scenario->name; scenario++)
+	{
+		for (uint32_t useStrip = 0; useStrip < 2; useStrip++)
+		{
+			RunScenario(*scenario, iterations, useStrip != 0);
+		}
+	}
+	return(0);
+}
@@ -0,0 +1,445 @@
+/*
+*	XFont4BitConverter.cpp, Copyright Jonathan Mackey 2023
+*	Converts an 8 bit (antialiased) xfnt header to the compressed 4 bit format.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	Reads a font header created by SubsetFontCreator (8 bit, not rotated) and
+*	writes the same font with its glyph data in the format unpacked by
+*	XFont4BitDataStream.  See XFont4BitDataStream.h for the format.  The
+*	namespace, include guard and font name get a _4b suffix, the same as the
+*	_1b suffix used for 1 bit fonts.  Everything else in the header is copied
+*	as is.
+*
+*	Usage: XFont4BitConverter inFont.h outFont_4b.h
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 HostTools/XFont4BitConverter/XFont4BitConverter.cpp \
+*		-o XFont4BitConverter
+*
+*	Example:
+*		./XFont4BitConverter KeyMachine/Avenir_64.h KeyMachine/Avenir_64_4b.h
+*/
+#include <stdio.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static const uint8_t	kGlyphHeaderSize = 5;	// sizeof(GlyphHeader)
+static const uint8_t	kCopyCode = 14;
+static const uint8_t	kMinCopyLength = 2;
+
+/******************************** ReadTextFile ********************************/
+static bool ReadTextFile(
+	const char*		inPath,
+	std::string&	outText)
+{
+	FILE*	file = fopen(inPath, "rb");
+	if (file)
+	{
+		char	buffer[4096];
+		size_t	bytesRead;
+		while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		{
+			outText.append(buffer, bytesRead);
+		}
+		fclose(file);
+	}
+	return(file != nullptr);
+}
+
+/********************************* FindArray **********************************/
+/*
+*	Returns the range of the text between the braces of the array named
+*	inName, e.g. "glyphData[]".  Returns false if the array wasn't found.
+*/
+static bool FindArray(
+	const std::string&	inText,
+	const char*			inName,
+	size_t&				outStart,
+	size_t&				outEnd)
+{
+	size_t	namePos = inText.find(inName);
+	if (namePos != std::string::npos)
+	{
+		outStart = inText.find('{', namePos);
+		if (outStart != std::string::npos)
+		{
+			outStart++;
+			outEnd = inText.find("};", outStart);
+			return(outEnd != std::string::npos);
+		}
+	}
+	return(false);
+}
+
+/********************************* ParseArray *********************************/
+/*
+*	Parses the numbers (hex or decimal) of the text between inStart and inEnd.
+*	Comments are skipped.
+*/
+static void ParseArray(
+	const std::string&		inText,
+	size_t					inStart,
+	size_t					inEnd,
+	std::vector<int32_t>&	outValues)
+{
+	const char*	textPtr = &inText[inStart];
+	const char*	textEnd = &inText[inEnd];
+	while (textPtr < textEnd)
+	{
+		if (textPtr[0] == '/' && textPtr[1] == '/')
+		{
+			while (textPtr < textEnd && *textPtr != '\n')
+			{
+				textPtr++;
+			}
+		} else if (*textPtr == '-' || (*textPtr >= '0' && *textPtr <= '9'))
+		{
+			char*	numEnd;
+			outValues.push_back((int32_t)strtol(textPtr, &numEnd, 0));
+			textPtr = numEnd;
+		} else
+		{
+			textPtr++;
+		}
+	}
+}
+
+/********************************* UnpackRLE **********************************/
+/*
+*	Unpacks the run length encoded 8 bit glyph data, see XFontGlyph.h.
+*/
+static bool UnpackRLE(
+	const std::vector<int32_t>&	inData,
+	size_t						inIndex,
+	size_t						inEnd,
+	uint32_t					inPixels,
+	std::vector<uint8_t>&		outTints)
+{
+	outTints.clear();
+	while (outTints.size() < inPixels && inIndex < inEnd)
+	{
+		int8_t	runLength = (int8_t)inData[inIndex++];
+		if (runLength > 0)
+		{
+			outTints.insert(outTints.end(), runLength, (uint8_t)inData[inIndex++]);
+		} else
+		{
+			for (; runLength && inIndex < inEnd; runLength++)
+			{
+				outTints.push_back((uint8_t)inData[inIndex++]);
+			}
+		}
+	}
+	outTints.resize(inPixels);
+	return(inIndex <= inEnd);
+}
+
+/******************************** NibbleTint **********************************/
+/*
+*	Reduces an 8 bit tint to the nearest of the 15 nibble tints.  Tint 14 is
+*	used as the copy code, 0xEE becomes 13 or 15.
+*/
+static uint8_t NibbleTint(
+	uint8_t	inTint)
+{
+	uint8_t	nibble = (inTint + 8)/17;
+	if (nibble == kCopyCode)
+	{
+		nibble = inTint < (kCopyCode * 17) ? 13 : 15;
+	}
+	return(nibble);
+}
+
+/********************************** Nibbles ***********************************/
+class Nibbles
+{
+public:
+							Nibbles(void)
+								: mHasNibble(false){}
+	void					Append(
+								uint8_t					inNibble)
+								{
+									if (mHasNibble)
+									{
+										mBytes.back() |= inNibble;
+									} else
+									{
+										mBytes.push_back(inNibble << 4);
+									}
+									mHasNibble = !mHasNibble;
+								}
+	void					AppendLength(
+								uint32_t				inLength)
+								{
+									do
+									{
+										uint8_t	nibble = inLength & 7;
+										inLength >>= 3;
+										Append(inLength ? (nibble | 8) : nibble);
+									} while (inLength);
+								}
+	const std::vector<uint8_t>&	Bytes(void) const
+								{return(mBytes);}
+protected:
+	std::vector<uint8_t>	mBytes;
+	bool					mHasNibble;
+};
+
+/********************************* Pack4Bit ***********************************/
+/*
+*	Packs the nibble tints of one glyph.  At each pixel the longest of a copy
+*	of the row above or a run of tint 0 or 15 is used.
+*/
+static void Pack4Bit(
+	const std::vector<uint8_t>&	inTints,
+	uint32_t					inColumns,
+	std::vector<uint8_t>&		outData)
+{
+	Nibbles	nibbles;
+	uint32_t	pixels = (uint32_t)inTints.size();
+	for (uint32_t i = 0; i < pixels;)
+	{
+		uint32_t	copyLength = 0;
+		if (i >= inColumns)
+		{
+			while ((i + copyLength) < pixels &&
+				inTints[i + copyLength] == inTints[i + copyLength - inColumns])
+			{
+				copyLength++;
+			}
+		}
+		uint8_t		tint = inTints[i];
+		uint32_t	runLength = 0;
+		if (tint == 0 || tint == 15)
+		{
+			while ((i + runLength) < pixels &&
+				inTints[i + runLength] == tint)
+			{
+				runLength++;
+			}
+		}
+		if (copyLength >= kMinCopyLength &&
+			copyLength > runLength)
+		{
+			nibbles.Append(kCopyCode);
+			nibbles.AppendLength(copyLength - kMinCopyLength);
+			i += copyLength;
+		} else if (runLength)
+		{
+			nibbles.Append(tint);
+			nibbles.AppendLength(runLength - 1);
+			i += runLength;
+		} else
+		{
+			nibbles.Append(tint);
+			i++;
+		}
+	}
+	outData.insert(outData.end(), nibbles.Bytes().begin(), nibbles.Bytes().end());
+}
+
+/****************************** FormatArrayBody *******************************/
+static std::string FormatArrayBody(
+	const std::vector<uint8_t>*		inBytes,
+	const std::vector<uint32_t>*	inWords)
+{
+	std::string	body("\n");
+	size_t	count = inBytes ? inBytes->size() : inWords->size();
+	size_t	perLine = inBytes ? 12 : 8;
+	char	valueStr[16];
+	for (size_t i = 0; i < count; i++)
+	{
+		if ((i % perLine) == 0)
+		{
+			body += "\t\t";
+		}
+		if (inBytes)
+		{
+			snprintf(valueStr, sizeof(valueStr), "0x%02X", (*inBytes)[i]);
+		} else
+		{
+			snprintf(valueStr, sizeof(valueStr), "0x%04X", (*inWords)[i]);
+		}
+		body += valueStr;
+		if ((i+1) < count)
+		{
+			body += ((i % perLine) == (perLine-1)) ? ",\n" : ", ";
+		}
+	}
+	body += "\n\t";
+	return(body);
+}
+
+/****************************** ReplaceAll ************************************/
+/*
+*	Replaces each occurrence of inFind that isn't part of a longer
+*	identifier.  inFind followed by "_h" (the include guard) is replaced.
+*/
+static void ReplaceAll(
+	std::string&	ioText,
+	const char*		inFind,
+	const char*		inReplace)
+{
+	size_t	findLen = strlen(inFind);
+	size_t	replaceLen = strlen(inReplace);
+	for (size_t pos = ioText.find(inFind); pos != std::string::npos;
+								pos = ioText.find(inFind, pos))
+	{
+		char	before = pos ? ioText[pos-1] : ' ';
+		char	after = (pos + findLen) < ioText.size() ? ioText[pos + findLen] : ' ';
+		bool	isIdentifier = isalnum(before) || before == '_' ||
+							((isalnum(after) || after == '_') &&
+							ioText.compare(pos + findLen, 2, "_h") != 0);
+		if (!isIdentifier)
+		{
+			ioText.replace(pos, findLen, inReplace);
+			pos += replaceLen;
+		} else
+		{
+			pos += findLen;
+		}
+	}
+}
+
+/*********************************** BaseName *********************************/
+static std::string BaseName(
+	const char*	inPath)
+{
+	const char*	name = strrchr(inPath, '/');
+	return(name ? name+1 : inPath);
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage: %s inFont.h outFont_4b.h\n", argv[0]);
+		return(1);
+	}
+	std::string	text;
+	if (!ReadTextFile(argv[1], text))
+	{
+		fprintf(stderr, "Unable to read %s\n", argv[1]);
+		return(1);
+	}
+	size_t	headerStart, headerEnd, offsetsStart, offsetsEnd, dataStart, dataEnd;
+	if (!FindArray(text, "fontHeader", headerStart, headerEnd) ||
+		!FindArray(text, "glyphDataOffset[]", offsetsStart, offsetsEnd) ||
+		!FindArray(text, "glyphData[]", dataStart, dataEnd))
+	{
+		fprintf(stderr, "%s is not an xfnt header\n", argv[1]);
+		return(1);
+	}
+	std::vector<int32_t>	header, offsets, data;
+	ParseArray(text, headerStart, headerEnd, header);
+	ParseArray(text, offsetsStart, offsetsEnd, offsets);
+	ParseArray(text, dataStart, dataEnd, data);
+	/*
+	*	header[0] is the version, [1] oneBit, [2] rotated
+	*/
+	if (header.size() < 11 || header[1] || header[2] ||
+		text.find("XFont16BitDataStream") == std::string::npos)
+	{
+		fprintf(stderr, "%s is not an 8 bit font\n", argv[1]);
+		return(1);
+	}
+	/*
+	*	Convert each glyph.  The last offset is the end of the last glyph.
+	*/
+	std::vector<uint8_t>	newData;
+	std::vector<uint32_t>	newOffsets;
+	std::vector<uint8_t>	tints;
+	for (size_t i = 0; (i+1) < offsets.size(); i++)
+	{
+		size_t	glyphStart = offsets[i];
+		size_t	glyphEnd = offsets[i+1];
+		if (glyphEnd > data.size() ||
+			(glyphStart + kGlyphHeaderSize) > glyphEnd)
+		{
+			fprintf(stderr, "Glyph %zu is invalid\n", i);
+			return(1);
+		}
+		newOffsets.push_back((uint32_t)newData.size());
+		for (size_t j = 0; j < kGlyphHeaderSize; j++)
+		{
+			newData.push_back((uint8_t)data[glyphStart + j]);
+		}
+		uint32_t	rows = (uint8_t)data[glyphStart + 3];
+		uint32_t	columns = (uint8_t)data[glyphStart + 4];
+		UnpackRLE(data, glyphStart + kGlyphHeaderSize, glyphEnd, rows * columns, tints);
+		for (size_t j = 0; j < tints.size(); j++)
+		{
+			tints[j] = NibbleTint(tints[j]);
+		}
+		Pack4Bit(tints, columns, newData);
+	}
+	newOffsets.push_back((uint32_t)newData.size());
+	if (newData.size() > 0xFFFF)
+	{
+		fprintf(stderr, "The converted glyph data is larger than 64KB\n");
+		return(1);
+	}
+	/*
+	*	Replace the arrays, last to first so that the positions stay valid.
+	*/
+	std::vector<uint8_t>*	noBytes = nullptr;
+	std::vector<uint32_t>*	noWords = nullptr;
+	text.replace(dataStart, dataEnd - dataStart, FormatArrayBody(&newData, noWords));
+	text.replace(offsetsStart, offsetsEnd - offsetsStart, FormatArrayBody(noBytes, &newOffsets));
+	/*
+	*	Rename the namespace, and the file name used in the usage comments.
+	*/
+	size_t	namePos = text.find("namespace ");
+	if (namePos != std::string::npos)
+	{
+		namePos += 10;
+		size_t	nameEnd = namePos;
+		while (nameEnd < text.size() && (isalnum(text[nameEnd]) || text[nameEnd] == '_'))
+		{
+			nameEnd++;
+		}
+		std::string	name(text, namePos, nameEnd - namePos);
+		ReplaceAll(text, name.c_str(), (name + "_4b").c_str());
+	}
+	ReplaceAll(text, BaseName(argv[1]).c_str(), BaseName(argv[2]).c_str());
+	ReplaceAll(text, "XFont16BitDataStream", "XFont4BitDataStream");
+	text.insert(0, std::string("// Converted to 4 bit by XFont4BitConverter from ") +
+						BaseName(argv[1]) + "\n");
+	FILE*	file = fopen(argv[2], "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Unable to create %s\n", argv[2]);
+		return(1);
+	}
+	fwrite(text.data(), 1, text.size(), file);
+	fclose(file);
+	printf("%s: glyph data %zu -> %zu bytes\n", BaseName(argv[2]).c_str(),
+					data.size(), newData.size());
+	return(0);
+}
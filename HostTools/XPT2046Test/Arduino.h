@@ -0,0 +1,140 @@
+/*
+*	Arduino.h, Copyright Jonathan Mackey 2023
+*	The part of the STM32 core used by XPT2046 and SPIBus, for XPT2046Test.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+#include <functional>
+
+// The XPT2046 sampling and SPIBus IRQ masking are STM32 only.
+#define _STM32_DEF_
+
+#define HIGH	1
+#define LOW		0
+#define INPUT	0
+#define OUTPUT	1
+#define CHANGE	2
+
+typedef int IRQn_Type;
+struct TIM_TypeDef
+{
+	uint32_t	CR1;
+};
+enum TimerFormat_t
+{
+	MICROSEC_FORMAT
+};
+
+/*
+*	The sample timer doesn't run by itself.  XPT2046Test calls the callback
+*	for each sample period while the timer is running.
+*/
+class HardwareTimer
+{
+public:
+	void					setup(
+								TIM_TypeDef*			inTimer){}
+	void					setOverflow(
+								uint32_t				inOverflow,
+								TimerFormat_t			inFormat){}
+	void					setInterruptPriority(
+								uint32_t				inPreemptPriority,
+								uint32_t				inSubPriority){}
+	void					attachInterrupt(
+								std::function<void(void)>	inCallback)
+								{mCallback = inCallback;}
+	void					setCount(
+								uint32_t				inCount){}
+	void					resume(void)
+								{mRunning = true;}
+	void					pause(void)
+								{mRunning = false;}
+	bool					IsRunning(void) const
+								{return(mRunning);}
+	void					Interrupt(void)
+								{mCallback();}
+protected:
+	std::function<void(void)>	mCallback;
+	bool					mRunning = false;
+};
+
+class HardwareSerial
+{
+public:
+	template<class T> void	print(
+								T						inValue){}
+	template<class T> void	println(
+								T						inValue){}
+	void					println(void){}
+};
+extern HardwareSerial	Serial;
+
+// Implemented by XPT2046Test.cpp
+uint32_t	millis(void);
+int			digitalRead(
+				uint32_t	inPin);
+void		attachInterrupt(
+				uint32_t	inInterrupt,
+				void		(*inISR)(void),
+				int			inMode);
+void		NVIC_DisableIRQ(
+				IRQn_Type	inIRQn);
+void		NVIC_EnableIRQ(
+				IRQn_Type	inIRQn);
+
+inline void		digitalWrite(
+					uint32_t	inPin,
+					uint8_t		inValue){}
+inline void		pinMode(
+					uint32_t	inPin,
+					uint32_t	inMode){}
+inline void		detachInterrupt(
+					uint32_t	inInterrupt){}
+inline uint32_t	digitalPinToBitMask(
+					uint32_t	inPin)
+					{return(1 << (inPin & 15));}
+inline uint32_t	digitalPinToPort(
+					uint32_t	inPin)
+					{return(inPin >> 4);}
+inline uint32_t	digitalPinToInterrupt(
+					uint32_t	inPin)
+					{return(inPin);}
+volatile uint32_t*	portOutputRegister(
+						uint32_t	inPort);
+inline IRQn_Type	getTimerUpIrq(
+						TIM_TypeDef*	inTimer)
+						{return(0);}
+inline long		map(
+					long		inValue,
+					long		inFromLow,
+					long		inFromHigh,
+					long		inToLow,
+					long		inToHigh)
+					{return((inValue - inFromLow) * (inToHigh - inToLow) / (inFromHigh - inFromLow) + inToLow);}
+inline void		__DMB(void){}
+inline void		__DSB(void){}
+inline void		__ISB(void){}
+
+#endif // Arduino_h
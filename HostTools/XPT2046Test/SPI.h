@@ -0,0 +1,58 @@
+/*
+*	SPI.h, Copyright Jonathan Mackey 2023
+*	The part of SPI.h used by XPT2046 and SPIBus, for XPT2046Test.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef SPI_h
+#define SPI_h
+
+#include "Arduino.h"
+
+#define MSBFIRST	1
+#define SPI_MODE0	0
+
+class SPISettings
+{
+public:
+							SPISettings(void){}
+							SPISettings(
+								uint32_t				inClock,
+								uint8_t					inBitOrder,
+								uint8_t					inDataMode){}
+};
+
+/*
+*	Implemented by XPT2046Test.cpp.  The only device on the bus is the
+*	simulated touch controller.
+*/
+class SPIClass
+{
+public:
+	void					begin(void){}
+	void					beginTransaction(
+								const SPISettings&		inSettings);
+	void					endTransaction(void);
+	void					transfer(
+								void*					ioBuffer,
+								size_t					inCount);
+};
+extern SPIClass SPI;
+
+#endif // SPI_h
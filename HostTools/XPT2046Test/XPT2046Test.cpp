@@ -0,0 +1,449 @@
+/*
+*	XPT2046Test.cpp, Copyright Jonathan Mackey 2023
+*	Tests the XPT2046 sampled touch events against a simulated controller.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+/*
+*	XPT2046, its sample ISR and SPIBus are the library code.  SPI is
+*	replaced by a simulated touch controller, the sample timer is driven by
+*	Tick, one call per sample period, and the NVIC by a mask that holds a
+*	sample due while the IRQ is masked.  The scenarios are:
+*
+*	- tap: a pen down is reported after kPenDownSamples, a pen up after
+*	  kPenUpSamples, then the sample timer stops.
+*	- short: contact shorter than kPenDownSamples isn't reported.
+*	- noise: single noisy readings of a stationary pen don't queue moves.
+*	- drag: moves the consumer doesn't read are coalesced, the latest
+*	  position is kept and nothing is dropped.
+*	- bus: a sample due while another device owns the bus waits until the
+*	  outermost transaction ends.
+*	- full: short taps the consumer doesn't read fill the queue.  Every pen
+*	  down read is followed by its pen up.
+*
+*	Each scenario prints one line.  The exit status is 0 when all pass.
+*
+*	Build from the repository root (Mac or Linux):
+*
+*	g++ -std=gnu++17 -O2 -IHostTools/XPT2046Test -Ilibraries/XPT2046 \
+*		-Ilibraries/SPIBus -Ilibraries/MSPeriod -Ilibraries/DisplayController \
+*		HostTools/XPT2046Test/XPT2046Test.cpp libraries/XPT2046/XPT2046.cpp \
+*		libraries/SPIBus/SPIBus.cpp -o XPT2046Test
+*/
+#include "Arduino.h"
+#include <SPI.h>
+#include "XPT2046.h"
+#include <stdio.h>
+
+static const uint32_t	kCSPin = 0x04;
+static const uint32_t	kPenIRQPin = 0x05;
+static const uint16_t	kZ1 = 1000;		// z = Z1 + 0xFFF - Z2 = 3095
+static const uint16_t	kZ2 = 2000;
+
+/*
+*	SimXPT2046 is the simulated touch controller.  SPIClass and the pen IRQ
+*	pin forward to it.
+*/
+class SimXPT2046
+{
+public:
+							SimXPT2046(void)
+								: mX(2000), mY(1000), mZ1(kZ1), mZ2(kZ2),
+								  mNoise(0), mPenDown(false), mTransfers(0){}
+	void					Transfer(
+								uint8_t*				ioBuffer,
+								size_t					inCount);
+	uint16_t	mX;			// Raw 12 bit readings
+	uint16_t	mY;
+	uint16_t	mZ1;
+	uint16_t	mZ2;
+	uint16_t	mNoise;		// Added to one X reading of each sample
+	bool		mPenDown;
+	uint32_t	mTransfers;
+};
+
+/********************************** Transfer **********************************/
+/*
+*	Each 3 bytes are a command followed by its 12 bit reading, MSB first and
+*	left justified by 3 bits.
+*/
+void SimXPT2046::Transfer(
+	uint8_t*	ioBuffer,
+	size_t		inCount)
+{
+	mTransfers++;
+	uint8_t	noisyX = rand() % 4;
+	uint8_t	xReadings = 0;
+	for (size_t i = 0; i + 2 < inCount; i += 3)
+	{
+		uint16_t	value = 0;
+		switch (ioBuffer[i] & 0xF0)
+		{
+			case 0xB0:
+				value = mZ1;
+				break;
+			case 0xC0:
+				value = mZ2;
+				break;
+			case 0x90:
+				value = mX + (xReadings++ == noisyX ? mNoise : 0);
+				break;
+			case 0xD0:
+				value = mY;
+				break;
+		}
+		value = (value & 0xFFF) << 3;
+		ioBuffer[i+1] = value >> 8;
+		ioBuffer[i+2] = value;
+	}
+}
+
+static SimXPT2046	sController;
+static uint32_t		sMillis;
+static uint32_t		sPorts[4];
+static void			(*sPenISR)(void);
+static bool			sIRQMasked;
+static bool			sSamplePending;	// Due while masked
+HardwareSerial		Serial;
+SPIClass			SPI;
+
+uint32_t millis(void)
+{
+	return(sMillis);
+}
+
+int digitalRead(
+	uint32_t	inPin)
+{
+	return(inPin == kPenIRQPin && sController.mPenDown ? LOW : HIGH);
+}
+
+volatile uint32_t* portOutputRegister(
+	uint32_t	inPort)
+{
+	return(&sPorts[inPort & 3]);
+}
+
+void attachInterrupt(
+	uint32_t	inInterrupt,
+	void		(*inISR)(void),
+	int			inMode)
+{
+	sPenISR = inISR;
+}
+
+void SPIClass::beginTransaction(
+	const SPISettings&	inSettings)
+{
+}
+
+void SPIClass::endTransaction(void)
+{
+}
+
+void SPIClass::transfer(
+	void*	ioBuffer,
+	size_t	inCount)
+{
+	sController.Transfer((uint8_t*)ioBuffer, inCount);
+}
+
+/*
+*	TestXPT2046 exposes the sample timer.
+*/
+class TestXPT2046 : public XPT2046
+{
+public:
+							TestXPT2046(void)
+								: XPT2046(kCSPin, kPenIRQPin, 320, 480, 0, 4095, 0, 4095){}
+	HardwareTimer&			SampleTimer(void)
+								{return(mSampleTimer);}
+};
+
+static TestXPT2046	sTouch;
+
+void NVIC_DisableIRQ(
+	IRQn_Type	inIRQn)
+{
+	sIRQMasked = true;
+}
+
+void NVIC_EnableIRQ(
+	IRQn_Type	inIRQn)
+{
+	sIRQMasked = false;
+	if (sSamplePending)
+	{
+		sSamplePending = false;
+		sTouch.SampleTimer().Interrupt();
+	}
+}
+
+static uint32_t	sFailures;
+
+/*********************************** Check ************************************/
+static void Check(
+	bool		inPassed,
+	const char*	inWhat)
+{
+	if (!inPassed)
+	{
+		fprintf(stderr, "  FAILED: %s\n", inWhat);
+		sFailures++;
+	}
+}
+
+/************************************ Tick ************************************/
+/*
+*	One sample period.
+*/
+static void Tick(
+	uint16_t	inPeriods = 1)
+{
+	for (; inPeriods; inPeriods--)
+	{
+		sMillis += XPT2046::kSamplePeriodUS / 1000;
+		if (sTouch.SampleTimer().IsRunning())
+		{
+			if (sIRQMasked)
+			{
+				sSamplePending = true;
+			} else
+			{
+				sTouch.SampleTimer().Interrupt();
+			}
+		}
+	}
+}
+
+/********************************* PenDown ************************************/
+static void PenDown(void)
+{
+	sController.mPenDown = true;
+	sPenISR();
+}
+
+/*********************************** PenUp ************************************/
+static void PenUp(void)
+{
+	sController.mPenDown = false;
+	sPenISR();
+}
+
+/******************************** DrainEvents *********************************/
+/*
+*	Reads the queued events.  Returns the number read, optionally the count
+*	of each type and the last event.
+*/
+static uint32_t DrainEvents(
+	uint32_t*				outTypeCounts = nullptr,
+	XPT2046::STouchEvent*	outLast = nullptr)
+{
+	uint32_t	count = 0;
+	XPT2046::STouchEvent	event;
+	while (sTouch.GetEvent(event))
+	{
+		count++;
+		if (outTypeCounts)
+		{
+			outTypeCounts[event.type]++;
+		}
+		if (outLast)
+		{
+			*outLast = event;
+		}
+	}
+	return(count);
+}
+
+/************************************ Tap *************************************/
+static void Tap(void)
+{
+	uint32_t	failures = sFailures;
+	XPT2046::STouchEvent	event;
+	PenDown();
+	Check(sTouch.SampleTimer().IsRunning(), "tap: pen down didn't start sampling");
+	Tick();
+	Check(!sTouch.GetEvent(event), "tap: pen down after one sample");
+	Tick();
+	Check(sTouch.GetEvent(event) && event.type == XPT2046::ePenDown &&
+			event.time == sMillis, "tap: no pen down");
+	PenUp();
+	Tick();
+	Check(!sTouch.GetEvent(event), "tap: pen up after one sample");
+	Tick();
+	Check(sTouch.GetEvent(event) && event.type == XPT2046::ePenUp, "tap: no pen up");
+	Tick();
+	Check(!sTouch.SampleTimer().IsRunning(), "tap: sampling didn't stop");
+	printf("tap: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/*********************************** Short ************************************/
+static void Short(void)
+{
+	uint32_t	failures = sFailures;
+	PenDown();
+	Tick();
+	PenUp();
+	Tick(3);
+	Check(DrainEvents() == 0, "short: reported");
+	Check(!sTouch.SampleTimer().IsRunning(), "short: sampling didn't stop");
+	printf("short: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/*********************************** Noise ************************************/
+static void Noise(void)
+{
+	uint32_t	failures = sFailures;
+	uint32_t	typeCounts[3] = {0};
+	PenDown();
+	Tick(2);
+	sController.mNoise = 800;
+	Tick(50);
+	sController.mNoise = 0;
+	PenUp();
+	Tick(3);
+	DrainEvents(typeCounts);
+	Check(typeCounts[XPT2046::ePenMoved] == 0, "noise: moves queued");
+	Check(typeCounts[XPT2046::ePenDown] == 1 &&
+			typeCounts[XPT2046::ePenUp] == 1, "noise: not one touch");
+	printf("noise: %s, %u moves\n", failures == sFailures ? "passed" : "FAILED",
+			typeCounts[XPT2046::ePenMoved]);
+}
+
+/*********************************** Drag *************************************/
+static void Drag(void)
+{
+	uint32_t	failures = sFailures;
+	uint32_t	dropped = sTouch.DroppedEvents();
+	XPT2046::STouchEvent	event;
+	PenDown();
+	Tick(2);
+	sTouch.GetEvent(event);
+	uint16_t	downX = event.x;
+	for (uint16_t i = 0; i < 100; i++)
+	{
+		sController.mX -= 10;
+		Tick();
+	}
+	uint32_t	typeCounts[3] = {0};
+	uint32_t	count = DrainEvents(typeCounts, &event);
+	Check(count == typeCounts[XPT2046::ePenMoved], "drag: not only moves");
+	Check(count == 15, "drag: queue not filled");
+	Check(sTouch.DroppedEvents() == dropped, "drag: events dropped");
+	/*
+	*	The last move replaced the moves that didn't fit, so it's the
+	*	latest position.
+	*/
+	uint16_t	lastX = event.x;
+	sController.mX -= 10;
+	Tick();
+	Check(sTouch.GetEvent(event) && event.x <= lastX && lastX < downX,
+			"drag: latest position not kept");
+	PenUp();
+	Tick(3);
+	DrainEvents();
+	printf("drag: %s, %u moves queued\n", failures == sFailures ? "passed" : "FAILED", count);
+}
+
+/************************************ Bus *************************************/
+static void Bus(void)
+{
+	uint32_t	failures = sFailures;
+	PenDown();
+	Tick(2);
+	DrainEvents();
+	SPIBus::BeginTransaction(SPISettings());
+	SPIBus::BeginTransaction(SPISettings());
+	uint32_t	transfers = sController.mTransfers;
+	Tick(5);
+	Check(sController.mTransfers == transfers, "bus: sampled during a transaction");
+	SPIBus::EndTransaction();
+	Check(sController.mTransfers == transfers, "bus: sampled during the outer transaction");
+	SPIBus::EndTransaction();
+	Check(sController.mTransfers == transfers + 1 && !sIRQMasked,
+			"bus: sample not taken after the transaction");
+	PenUp();
+	Tick(3);
+	DrainEvents();
+	printf("bus: %s\n", failures == sFailures ? "passed" : "FAILED");
+}
+
+/************************************ Full ************************************/
+/*
+*	Short taps fill the queue, so the pen down of a tap is queued in the last
+*	slot.  Its pen up must not be lost, otherwise the consumer would track
+*	the touch until the next one.
+*/
+static void Full(void)
+{
+	uint32_t	failures = sFailures;
+	for (uint16_t taps = 7; taps <= 10; taps++)
+	{
+		for (uint16_t i = 0; i < taps; i++)
+		{
+			PenDown();
+			Tick(2);
+			PenUp();
+			Tick(3);
+		}
+		bool	penDown = false;
+		bool	paired = true;
+		uint32_t	count = 0;
+		XPT2046::STouchEvent	event;
+		while (sTouch.GetEvent(event))
+		{
+			count++;
+			paired = paired && (event.type == XPT2046::ePenDown) != penDown &&
+						event.type != XPT2046::ePenMoved;
+			penDown = event.type == XPT2046::ePenDown;
+		}
+		Check(paired && !penDown, "full: a pen down without its pen up");
+		Check(count >= 14, "full: taps lost with room in the queue");
+		/*
+		*	The queue works normally once read.
+		*/
+		PenDown();
+		Tick(2);
+		PenUp();
+		Tick(3);
+		uint32_t	typeCounts[3] = {0};
+		DrainEvents(typeCounts);
+		Check(typeCounts[XPT2046::ePenDown] == 1 &&
+				typeCounts[XPT2046::ePenUp] == 1, "full: next tap not reported");
+	}
+	printf("full: %s, %u dropped\n", failures == sFailures ? "passed" : "FAILED",
+			sTouch.DroppedEvents());
+}
+
+/************************************ main ************************************/
+int main(
+	int		argc,
+	char*	argv[])
+{
+	sTouch.begin(3);
+	sTouch.BeginSampling(nullptr);
+	Tap();
+	Short();
+	Noise();
+	Drag();
+	Bus();
+	Full();
+	return(sFailures ? 1 : 0);
+}
@@ -0,0 +1,264 @@
+// Converted to 4 bit by XFont4BitConverter from Avenir_64.h
+// Subset font created by SubsetFontCreator
+// For subset: "%%09" (Height minimized)
+
+#ifndef Avenir_64_4b_h
+#define Avenir_64_4b_h
+
+#include "XFontGlyph.h"
+#include "XFont4BitDataStream.h"
+
+namespace Avenir_64_4b
+{
+	const FontHeader	fontHeader PROGMEM =
+	{
+		1,		// version, currently version = 1
+		0,		// oneBit, 1 = 1 bit per pixel, 0 = 8 bit (antialiased)
+		0,		// rotated, glyph data is rotated (applies to 1 bit only)
+		0,		// horizontal, addressing for rotated data, else vertical
+		0,		// monospaced, fixed width font (for this subset)
+		47,		// ascent, font in pixels
+		-2,		// descent, font in pixels
+		49,		// height, font height (ascent+descent+leading) in pixels
+		55,		// width, widest glyph advanceX within subset in pixels
+		3,		// numCharcodeRuns
+		11		// numCharCodes
+	};
+	
+	const CharcodeRun	charcodeRun[] PROGMEM = // {start, entryIndex}, ...
+	{
+		{0x0025, 0}, {0x0030, 1}, {0xFFFF, 11}
+	};
+	
+	const uint16_t	glyphDataOffset[] PROGMEM =
+	{
+		0x0000, 0x01BF, 0x02CE, 0x0310, 0x03CB, 0x04B9, 0x0542, 0x05F4,
+		0x06DF, 0x0777, 0x088F, 0x097B
+	};
+	
+	const uint8_t	glyphData[] PROGMEM =
+	{
+		0x37, 0x02, 0x00, 0x31, 0x33, 0x0C, 0x49, 0x92, 0x09, 0x22, 0x7B, 0xDF,
+		0x0D, 0xC9, 0x40, 0xB2, 0x3F, 0x28, 0x10, 0xD1, 0x2A, 0xF8, 0x1D, 0x50,
+		0x92, 0xCF, 0x33, 0x0C, 0x15, 0xFC, 0x1A, 0x0F, 0x17, 0xF3, 0x90, 0xC1,
+		0x6F, 0xE1, 0xB0, 0xD1, 0x1F, 0x3D, 0x10, 0xB1, 0x4F, 0x82, 0x90, 0xC1,
+		0xAF, 0x36, 0x0C, 0x1D, 0xF4, 0xD6, 0x20, 0x01, 0x4A, 0xF5, 0x50, 0xA1,
+		0x4F, 0x3C, 0x0C, 0x17, 0xF4, 0x90, 0x64, 0xF4, 0xD0, 0xA1, 0xDF, 0x33,
+		0x0C, 0x1D, 0xF3, 0xA0, 0x81, 0x5F, 0x44, 0x08, 0x17, 0xF3, 0x80, 0xC1,
+		0x3F, 0x41, 0x09, 0x1A, 0xF3, 0x90, 0x72, 0xF3, 0xD1, 0x0C, 0x16, 0xF3,
+		0xA0, 0xA1, 0x4F, 0x3C, 0x07, 0xAF, 0x35, 0x0D, 0x18, 0xF3, 0x70, 0xA1,
+		0x1F, 0x40, 0x64, 0xF3, 0xB0, 0xE1, 0x9F, 0x36, 0x0B, 0x1E, 0xA1, 0xDF,
+		0x32, 0x0E, 0x18, 0xF3, 0x70, 0xA1, 0x1E, 0x91, 0x7F, 0x38, 0x0F, 0x16,
+		0xF3, 0xA0, 0xA1, 0x4F, 0x3C, 0x04, 0x2F, 0x3D, 0x10, 0xF1, 0x3F, 0x41,
+		0x09, 0x1A, 0xF3, 0x90, 0x4B, 0xF3, 0x50, 0x92, 0xDF, 0x3A, 0x08, 0x15,
+		0xF4, 0x40, 0x35, 0xF3, 0xB0, 0xA2, 0x7F, 0x49, 0x06, 0x4F, 0x4D, 0x03,
+		0x1D, 0xF3, 0x20, 0xB2, 0xDF, 0x4D, 0x62, 0x00, 0x14, 0xAF, 0x55, 0x03,
+		0x8F, 0x38, 0x0C, 0x24, 0xF8, 0x29, 0x03, 0x2F, 0x3D, 0x0E, 0x26, 0xFE,
+		0x1B, 0x04, 0xBF, 0x34, 0x0F, 0x25, 0xFC, 0x1A, 0x04, 0x5F, 0x3A, 0x09,
+		0x32, 0xAF, 0x81, 0xD5, 0x04, 0x1D, 0xF3, 0x20, 0xB3, 0x27, 0xBD, 0xF0,
+		0xDC, 0x94, 0x06, 0x8F, 0x37, 0x0B, 0x53, 0xF3, 0xD0, 0xC5, 0xBF, 0x34,
+		0x05, 0x27, 0xBD, 0xF1, 0xDA, 0x51, 0x0B, 0x35, 0xF3, 0xA0, 0x41, 0x9F,
+		0x81, 0xD6, 0x09, 0x31, 0xDF, 0x32, 0x03, 0x3D, 0xFB, 0x1B, 0x10, 0xF2,
+		0x9F, 0x37, 0x03, 0x4F, 0xE1, 0xD1, 0x0D, 0x23, 0xF3, 0xC0, 0x32, 0xF8,
+		0x2B, 0x0D, 0x2C, 0xF3, 0x40, 0x3C, 0xF4, 0xD7, 0x20, 0x01, 0x39, 0xF5,
+		0x60, 0xB2, 0x6F, 0x3A, 0x03, 0x5F, 0x4B, 0x10, 0x53, 0xDF, 0x3D, 0x10,
+		0x92, 0x1D, 0xF3, 0x10, 0x3B, 0xF3, 0xC0, 0x81, 0x3F, 0x46, 0x09, 0x29,
+		0xF3, 0x60, 0x31, 0xF4, 0x30, 0x91, 0x8F, 0x3B, 0x08, 0x23, 0xF3, 0xC0,
+		0x45, 0xF3, 0xC0, 0xA1, 0x2F, 0x40, 0x82, 0xCF, 0x33, 0x04, 0x6F, 0x39,
+		0x0B, 0x1D, 0xF3, 0x10, 0xE1, 0x6F, 0x39, 0x05, 0x7F, 0x38, 0xEF, 0x12,
+		0x0D, 0x11, 0xF3, 0xD1, 0x05, 0x6F, 0x39, 0xEF, 0x11, 0x0D, 0x19, 0xF3,
+		0x60, 0x65, 0xF3, 0xC0, 0xA1, 0x2F, 0x40, 0xD1, 0x4F, 0x3C, 0x07, 0x1F,
+		0x43, 0x09, 0x18, 0xF3, 0xB0, 0xD1, 0xCF, 0x33, 0x08, 0x1B, 0xF3, 0xC0,
+		0x81, 0x3F, 0x46, 0x0C, 0x17, 0xF3, 0x90, 0x91, 0x5F, 0x4B, 0x10, 0x53,
+		0xDF, 0x3D, 0x10, 0xB1, 0x2F, 0x3D, 0x10, 0xA1, 0xCF, 0x4D, 0x72, 0x00,
+		0x13, 0x9F, 0x56, 0x0C, 0x1A, 0xF3, 0x60, 0xB1, 0x2F, 0x82, 0xB0, 0xC1,
+		0x4F, 0x3C, 0x0D, 0x14, 0xFE, 0x1D, 0x10, 0xC1, 0xDF, 0x33, 0x0E, 0x13,
+		0xDF, 0xB1, 0xB1, 0x0C, 0x17, 0xF3, 0x80, 0x82, 0x19, 0xF8, 0x1D, 0x60,
+		0xE1, 0x3A, 0xF1, 0xD1, 0x0A, 0x22, 0x7B, 0xDF, 0x1D, 0xA5, 0x10, 0x92,
+		0x3B, 0x50, 0xC4, 0x24, 0x02, 0x01, 0x2F, 0x20, 0x09, 0x11, 0x6A, 0xCF,
+		0x2D, 0xC8, 0x40, 0xA2, 0x18, 0xFA, 0x1D, 0x50, 0xF1, 0x5F, 0xE1, 0xB1,
+		0x0C, 0x18, 0xF8, 0x2D, 0x30, 0xA1, 0x7F, 0xA2, 0xD2, 0x08, 0x15, 0xF6,
+		0xC6, 0x21, 0x13, 0x8D, 0xF5, 0xD1, 0x06, 0x1D, 0xF5, 0x60, 0x61, 0xBF,
+		0x58, 0x06, 0x8F, 0x55, 0x09, 0x1B, 0xF5, 0x20, 0x41, 0xF5, 0x80, 0xA1,
+		0x1D, 0xF4, 0x90, 0x47, 0xF4, 0xD0, 0xC1, 0x5F, 0x51, 0x03, 0xDF, 0x46,
+		0x0D, 0x1C, 0xF4, 0x60, 0x23, 0xF5, 0x10, 0xD1, 0x6F, 0x4B, 0x02, 0x7F,
+		0x4A, 0x0E, 0x11, 0xF5, 0x10, 0x1B, 0xF4, 0x60, 0xF1, 0xCF, 0x45, 0x01,
+		0xF5, 0x20, 0xF1, 0x8F, 0x48, 0x00, 0x3F, 0x4D, 0x08, 0x25, 0xF4, 0xB0,
+		0x05, 0xF4, 0xC0, 0x82, 0x3F, 0x4D, 0x00, 0x7F, 0x4A, 0x08, 0x21, 0xF5,
+		0x19, 0xF4, 0x80, 0x92, 0xF5, 0x2A, 0xF4, 0x70, 0x92, 0xDF, 0x43, 0xE4,
+		0x60, 0x92, 0xCF, 0x45, 0xBF, 0x45, 0xEF, 0x2C, 0xEE, 0x2B, 0xF4, 0x6E,
+		0xF6, 0xCF, 0x45, 0xBE, 0xB4, 0x60, 0x92, 0xDF, 0x44, 0xAF, 0x47, 0xEE,
+		0x23, 0x8F, 0x48, 0x09, 0x2F, 0x51, 0x6F, 0x4A, 0x08, 0x22, 0xF5, 0x00,
+		0x4F, 0x4C, 0x08, 0x24, 0xF4, 0xD0, 0x02, 0xF5, 0x08, 0x26, 0xF4, 0xB0,
+		0x1F, 0x53, 0x0F, 0x19, 0xF4, 0x80, 0x1B, 0xF4, 0x70, 0xF1, 0xDF, 0x44,
+		0x01, 0x7F, 0x4B, 0x0E, 0x12, 0xF5, 0x10, 0x12, 0xF5, 0x10, 0xD1, 0x7F,
+		0x4B, 0x03, 0xCF, 0x48, 0x0D, 0x1D, 0xF4, 0x60, 0x36, 0xF4, 0xD1, 0x0B,
+		0x16, 0xF5, 0x10, 0x31, 0xF5, 0x90, 0xA1, 0x2D, 0xF4, 0x80, 0x57, 0xF5,
+		0x50, 0x91, 0xBF, 0x51, 0x06, 0xDF, 0x55, 0x06, 0x1A, 0xF5, 0x70, 0x73,
+		0xF6, 0xB5, 0x20, 0x01, 0x37, 0xDF, 0x5B, 0x09, 0x16, 0xFA, 0x2D, 0x10,
+		0xA1, 0x6F, 0x82, 0xD2, 0x0C, 0x15, 0xFE, 0x1B, 0x10, 0xE1, 0x1A, 0xFA,
+		0x1D, 0x60, 0xA2, 0x16, 0xAD, 0xDF, 0x1D, 0xC8, 0x40, 0xA1, 0x24, 0x05,
+		0x02, 0x2D, 0x13, 0x0B, 0x19, 0xF4, 0x60, 0x91, 0x2C, 0xF5, 0xE8, 0x14,
+		0xDF, 0x6E, 0x77, 0xF8, 0x1E, 0x51, 0xAF, 0x91, 0xE4, 0x2C, 0xFA, 0x1E,
+		0x34, 0xFC, 0x1E, 0x27, 0xF6, 0xAB, 0xE5, 0x1A, 0xF6, 0x70, 0x0E, 0x52,
+		0xDF, 0x65, 0x01, 0xE5, 0x3F, 0x5D, 0x30, 0x2E, 0x50, 0x05, 0xF3, 0xC2,
+		0x03, 0xE6, 0x00, 0x6F, 0x1A, 0x10, 0x4E, 0x70, 0x07, 0x80, 0x6E, 0x81,
+		0x08, 0x1E, 0xFF, 0x81, 0x24, 0x02, 0x01, 0x2E, 0x1F, 0x09, 0x13, 0x69,
+		0xCD, 0xF1, 0xDD, 0xB8, 0x40, 0x82, 0x6C, 0xFC, 0x18, 0x20, 0xB1, 0x4C,
+		0xF8, 0x27, 0x09, 0x16, 0xFB, 0x2B, 0x10, 0x66, 0xFD, 0x2B, 0x10, 0x43,
+		0xF7, 0xC6, 0x31, 0x00, 0x14, 0x9F, 0x79, 0x04, 0xDF, 0x65, 0x07, 0x1B,
+		0xF6, 0x30, 0x26, 0xF6, 0x30, 0xA1, 0xAF, 0x5B, 0x02, 0xDF, 0x56, 0x0B,
+		0x11, 0xDF, 0x51, 0x00, 0x2F, 0x5D, 0x0D, 0x17, 0xF5, 0x50, 0x06, 0xF5,
+		0x70, 0xD1, 0x2F, 0x58, 0x00, 0x48, 0x9B, 0xCD, 0xF0, 0x30, 0xE1, 0xF5,
+		0x90, 0xF2, 0xDE, 0xC3, 0xF5, 0x80, 0xE2, 0x3F, 0x57, 0x0E, 0x27, 0xF5,
+		0x40, 0xE2, 0xDF, 0x50, 0xE2, 0x7F, 0x59, 0x0D, 0x23, 0xF6, 0x20, 0xC2,
+		0x1D, 0xF5, 0x90, 0xD2, 0xBF, 0x5D, 0x10, 0xC2, 0xBF, 0x65, 0x0C, 0x2A,
+		0xF6, 0x80, 0xC2, 0xAF, 0x6A, 0x0C, 0x2A, 0xF6, 0xA0, 0xC2, 0xAF, 0x6A,
+		0x0C, 0x2A, 0xF6, 0xA0, 0xC2, 0xAF, 0x6A, 0x0C, 0x2A, 0xF6, 0x90, 0xC2,
+		0xAF, 0x69, 0x0C, 0x29, 0xF6, 0x90, 0xC2, 0x9F, 0x69, 0x0C, 0x29, 0xF6,
+		0x80, 0xC2, 0x9F, 0x68, 0x0C, 0x29, 0xF6, 0x80, 0xC2, 0x9F, 0x67, 0x0C,
+		0x29, 0xF6, 0x70, 0xC2, 0x9F, 0x67, 0x0C, 0x29, 0xF6, 0x60, 0xC2, 0x8F,
+		0x66, 0x0C, 0x21, 0xF6, 0x60, 0xD2, 0xE6, 0xFD, 0x2A, 0xEA, 0xF1, 0x24,
+		0x02, 0x01, 0x2F, 0x1F, 0x09, 0x13, 0x7A, 0xDF, 0x2D, 0xB8, 0x51, 0x08,
+		0x26, 0xDF, 0xB1, 0x93, 0x0C, 0x13, 0xDF, 0xF1, 0x80, 0xA1, 0x7F, 0xA2,
+		0xC1, 0x07, 0x7F, 0xC2, 0xB0, 0x64, 0xF7, 0xC6, 0x20, 0x01, 0x37, 0xDF,
+		0x68, 0x04, 0x1D, 0xF6, 0x70, 0x77, 0xF6, 0x20, 0x37, 0xF6, 0x50, 0x91,
+		0x5F, 0x59, 0x03, 0xDF, 0x58, 0x0B, 0x19, 0xF5, 0x03, 0x16, 0xBF, 0x2D,
+		0x0C, 0x12, 0xF5, 0x30, 0x51, 0x6C, 0x60, 0xD1, 0xDF, 0x45, 0x0F, 0x2B,
+		0xF4, 0x70, 0xF2, 0xAE, 0xC3, 0xBF, 0x46, 0x0F, 0x2D, 0xF4, 0x40, 0xE2,
+		0x2F, 0x50, 0xF2, 0x9F, 0x49, 0x0E, 0x26, 0xF5, 0x20, 0xC2, 0x2A, 0xF5,
+		0x70, 0xF1, 0x11, 0x35, 0x8C, 0xF6, 0xA0, 0xE1, 0x4F, 0xC1, 0x90, 0xF1,
+		0xEA, 0x1D, 0x50, 0x82, 0xE9, 0x16, 0x0A, 0x2E, 0x91, 0xF0, 0xC6, 0xEB,
+		0x3F, 0x1D, 0x30, 0x82, 0x12, 0x35, 0x8B, 0xF7, 0x50, 0xD2, 0x29, 0xF6,
+		0x30, 0xE2, 0x3D, 0xF4, 0xD0, 0xF2, 0x3F, 0x57, 0x0F, 0x26, 0xF4, 0xD0,
+		0x83, 0xF5, 0x30, 0xF2, 0xBF, 0x46, 0x0F, 0x29, 0xF4, 0x80, 0xF2, 0x8F,
+		0x49, 0x0F, 0x29, 0xE8, 0x11, 0x6B, 0x80, 0xF1, 0xBF, 0x48, 0x00, 0x27,
+		0xCF, 0x2D, 0x0E, 0x11, 0xF5, 0x60, 0x0D, 0xF5, 0x60, 0xD1, 0x7F, 0x53,
+		0x00, 0x8F, 0x5D, 0x10, 0xB1, 0x2F, 0x5D, 0x01, 0x2F, 0x6A, 0x0A, 0x12,
+		0xDF, 0x57, 0x02, 0x8F, 0x69, 0x08, 0x15, 0xF6, 0xC0, 0x31, 0xDF, 0x6D,
+		0x73, 0x10, 0x01, 0x37, 0xCF, 0x73, 0x04, 0x2D, 0xFD, 0x25, 0x06, 0x3D,
+		0xFB, 0x25, 0x08, 0x11, 0xAF, 0x82, 0xB2, 0x0B, 0x13, 0xAF, 0xC1, 0xA4,
+		0x0F, 0x11, 0x58, 0xBD, 0xF2, 0xDC, 0x95, 0x10, 0x81, 0x24, 0x02, 0x02,
+		0x2D, 0x21, 0x08, 0x22, 0xF6, 0xA0, 0xF2, 0xBE, 0xD3, 0x5F, 0x7E, 0xD2,
+		0x1D, 0xED, 0x39, 0xF8, 0x1E, 0xC2, 0x3F, 0x91, 0xEC, 0x2C, 0xED, 0x37,
+		0xF4, 0xBE, 0xF2, 0x2F, 0x49, 0x8E, 0xF2, 0xAF, 0x3D, 0x1E, 0xF2, 0x5F,
+		0x46, 0x00, 0xEE, 0x21, 0xDF, 0x3C, 0x01, 0xEE, 0x28, 0xF4, 0x3E, 0xF2,
+		0x3F, 0x49, 0x02, 0xED, 0x2C, 0xF3, 0xD1, 0xEF, 0x26, 0xF4, 0x50, 0x3E,
+		0xB2, 0x2F, 0x4B, 0x04, 0xEB, 0x2A, 0xF4, 0x2E, 0xF2, 0x4F, 0x48, 0x05,
+		0xE9, 0x21, 0xDF, 0x3D, 0x1E, 0xF2, 0x8F, 0x45, 0x06, 0xE8, 0x23, 0xF4,
+		0xB0, 0x7E, 0x82, 0xCF, 0x42, 0xEF, 0x26, 0xF4, 0x70, 0x81, 0xEE, 0x11,
+		0xF4, 0xD0, 0x91, 0xEE, 0x1A, 0xF4, 0x4E, 0xF2, 0x4F, 0x4A, 0x0A, 0x1E,
+		0xD1, 0xDF, 0x42, 0xEF, 0x28, 0xF4, 0x70, 0xB1, 0xEC, 0x1C, 0xF3, 0xC0,
+		0xC1, 0xE9, 0x2F, 0xA3, 0x1E, 0xA8, 0x20, 0xA2, 0x8F, 0x4A, 0x09, 0x3E,
+		0xCA, 0x40, 0x24, 0x02, 0x02, 0x2E, 0x1E, 0x02, 0x3F, 0xF2, 0x20, 0x3E,
+		0xA7, 0x4E, 0xFA, 0x15, 0xF4, 0xC0, 0xE2, 0xE4, 0xBE, 0xB6, 0x6E, 0x94,
+		0xAE, 0xB6, 0x7E, 0xF7, 0x90, 0xE2, 0x8E, 0xA4, 0x58, 0xBD, 0xF2, 0xDB,
+		0x84, 0xE8, 0x2F, 0xB1, 0xD5, 0x09, 0x19, 0xFA, 0x2C, 0x2E, 0xA3, 0xF0,
+		0xD3, 0xEA, 0x3F, 0x13, 0x05, 0xAF, 0x3B, 0x74, 0x20, 0x01, 0x24, 0x8D,
+		0xF7, 0xD1, 0xE5, 0xC6, 0x10, 0x91, 0x4C, 0xF6, 0x90, 0x48, 0x50, 0xE1,
+		0x9F, 0x62, 0x0D, 0x29, 0xF5, 0x80, 0xE2, 0xDF, 0x4D, 0x0E, 0x25, 0xF5,
+		0x20, 0xE2, 0xF5, 0x60, 0xE2, 0xBF, 0x48, 0x0E, 0x28, 0xF4, 0x90, 0xE2,
+		0x7F, 0x4B, 0x0E, 0x26, 0xEB, 0x38, 0xF4, 0xA0, 0xE2, 0x9F, 0x48, 0x0E,
+		0x2D, 0xF4, 0x50, 0x21, 0x6B, 0x90, 0xE1, 0x3F, 0x52, 0x16, 0xBF, 0x32,
+		0x0D, 0x1A, 0xF4, 0xB0, 0x09, 0xF5, 0xA0, 0xC1, 0x4F, 0x54, 0x00, 0x3F,
+		0x67, 0x0A, 0x13, 0xDF, 0x4B, 0x02, 0x9F, 0x68, 0x08, 0x16, 0xF6, 0x20,
+		0x21, 0xDF, 0x6D, 0x84, 0x10, 0x01, 0x37, 0xCF, 0x65, 0x04, 0x3D, 0xFC,
+		0x27, 0x06, 0x3D, 0xFA, 0x25, 0x08, 0x11, 0xAF, 0xF1, 0xB2, 0x0B, 0x13,
+		0xBF, 0xB1, 0xB4, 0x0F, 0x12, 0x6A, 0xCD, 0xF1, 0xDC, 0xA6, 0x20, 0x91,
+		0x24, 0x02, 0x02, 0x2E, 0x20, 0x0E, 0x12, 0xF6, 0x20, 0xE2, 0xBF, 0x57,
+		0x0E, 0x25, 0xF5, 0xC0, 0xE2, 0x1D, 0xF5, 0x20, 0xE2, 0x9F, 0x57, 0x0E,
+		0x24, 0xF5, 0xC0, 0xF2, 0xDF, 0x52, 0x0E, 0x28, 0xF5, 0x70, 0xE2, 0x3F,
+		0x5C, 0x0F, 0x2C, 0xF5, 0x20, 0xE2, 0x6F, 0x57, 0x0E, 0x22, 0xF5, 0xC0,
+		0xF2, 0xAF, 0x52, 0x0E, 0x25, 0xF5, 0x70, 0xE2, 0x1D, 0xF4, 0xB0, 0xF2,
+		0x9F, 0x52, 0x0E, 0x23, 0xF5, 0x86, 0xAD, 0xF1, 0xDC, 0x95, 0x10, 0xD1,
+		0xCF, 0x82, 0x92, 0x0A, 0x17, 0xFB, 0x27, 0x08, 0x12, 0xFD, 0x2A, 0x07,
+		0xAF, 0xE2, 0xA0, 0x53, 0xF8, 0x19, 0x42, 0x00, 0x12, 0x6B, 0xF7, 0x80,
+		0x4A, 0xF6, 0x91, 0x07, 0x4C, 0xF6, 0x30, 0x22, 0xF6, 0x60, 0xA1, 0x1B,
+		0xF5, 0xB0, 0x29, 0xF5, 0x70, 0xC1, 0x1D, 0xF5, 0x40, 0x1D, 0xF4, 0xC0,
+		0xE1, 0x3F, 0x59, 0x00, 0x3F, 0x54, 0x0F, 0x1B, 0xF4, 0xD0, 0x06, 0xF4,
+		0xD0, 0x82, 0x5F, 0x51, 0x9F, 0x4A, 0x08, 0x21, 0xF5, 0x3A, 0xF4, 0x80,
+		0x92, 0xDF, 0x44, 0xBF, 0x46, 0xEE, 0x25, 0xEC, 0x48, 0xEE, 0x24, 0x9F,
+		0x4A, 0x08, 0x21, 0xF5, 0x27, 0xF4, 0xD0, 0x82, 0x5F, 0x50, 0x03, 0xF5,
+		0x40, 0xF1, 0xBF, 0x4A, 0x01, 0xDF, 0x4C, 0x0E, 0x13, 0xF5, 0x60, 0x17,
+		0xF5, 0x70, 0xC1, 0x1D, 0xF4, 0xD1, 0x02, 0xDF, 0x56, 0x0A, 0x11, 0xBF,
+		0x56, 0x03, 0x5F, 0x69, 0x10, 0x74, 0xCF, 0x5D, 0x05, 0x8F, 0x79, 0x42,
+		0x00, 0x12, 0x6B, 0xF7, 0x30, 0x6A, 0xFD, 0x24, 0x08, 0x18, 0xFA, 0x2D,
+		0x40, 0xA1, 0x4D, 0xFF, 0x1B, 0x20, 0xD1, 0x6D, 0xFB, 0x1B, 0x40, 0x92,
+		0x37, 0xBD, 0xF2, 0xDC, 0x95, 0x20, 0x91, 0x24, 0x02, 0x02, 0x2D, 0x1E,
+		0x5F, 0xB3, 0x3E, 0xEE, 0x10, 0xD2, 0xAF, 0x4D, 0x0D, 0x22, 0xF5, 0x70,
+		0xD2, 0x9F, 0x51, 0x0C, 0x21, 0xF5, 0x80, 0xD2, 0x7F, 0x52, 0x0D, 0x2D,
+		0xF4, 0xA0, 0xD2, 0x6F, 0x53, 0x0D, 0x2D, 0xF4, 0xB0, 0xD2, 0x5F, 0x54,
+		0x0D, 0x2C, 0xF4, 0xD0, 0xD2, 0x4F, 0x56, 0x0D, 0x2B, 0xF4, 0xD0, 0xD2,
+		0x3F, 0x57, 0x0D, 0x29, 0xF5, 0x10, 0xC2, 0x2F, 0x59, 0x0D, 0x28, 0xF5,
+		0x20, 0xC2, 0x1F, 0x5A, 0x0D, 0x27, 0xF5, 0x40, 0xD2, 0xDF, 0x4C, 0x0D,
+		0x26, 0xF5, 0x50, 0xD2, 0xDF, 0x4D, 0x0D, 0x25, 0xF5, 0x70, 0xD2, 0xBF,
+		0x51, 0x0C, 0x23, 0xF5, 0x80, 0xD2, 0xAF, 0x52, 0x0C, 0x22, 0xF5, 0xA0,
+		0xD2, 0x9F, 0x53, 0x0C, 0x21, 0xF5, 0xB0, 0xD2, 0x8F, 0x54, 0x0C, 0x21,
+		0xDF, 0x4D, 0x0D, 0x27, 0xF5, 0x60, 0xD2, 0xDF, 0x4D, 0x0D, 0x25, 0xF5,
+		0x70, 0xD2, 0xCF, 0x51, 0x0C, 0x24, 0xF5, 0x90, 0xD2, 0xBF, 0x52, 0x0C,
+		0x23, 0xF5, 0xA0, 0xD2, 0xAF, 0x54, 0x0C, 0x22, 0xF5, 0xC0, 0xD2, 0x9F,
+		0x55, 0x09, 0x20, 0x24, 0x03, 0x01, 0x2F, 0x1E, 0x08, 0x12, 0x6A, 0xCD,
+		0xF1, 0xDC, 0x85, 0x08, 0x24, 0xBF, 0xA1, 0xD8, 0x10, 0xB1, 0x1A, 0xFF,
+		0x16, 0x09, 0x12, 0xDF, 0x92, 0x90, 0x72, 0xDF, 0xB2, 0x90, 0x6B, 0xF6,
+		0xB5, 0x20, 0x01, 0x37, 0xDF, 0x65, 0x04, 0x6F, 0x66, 0x07, 0x9F, 0x5D,
+		0x10, 0x3D, 0xF5, 0x40, 0x91, 0xAF, 0x56, 0x02, 0x2F, 0x59, 0x0A, 0x11,
+		0xDF, 0x4B, 0x02, 0x5F, 0x52, 0x0B, 0x18, 0xF4, 0xD0, 0x26, 0xF4, 0xD0,
+		0xC1, 0x4F, 0x5E, 0x7B, 0x0C, 0x12, 0xE7, 0x5E, 0xB3, 0x3F, 0x4D, 0x0C,
+		0x14, 0xF4, 0xC0, 0x3F, 0x52, 0x0B, 0x18, 0xF4, 0x80, 0x3A, 0xF4, 0x90,
+		0xA1, 0x1D, 0xF4, 0x30, 0x33, 0xF5, 0x50, 0x91, 0xAF, 0x4C, 0x05, 0x9F,
+		0x56, 0x06, 0x1A, 0xF5, 0x30, 0x51, 0xCF, 0x5C, 0x62, 0x00, 0x13, 0x7D,
+		0xF5, 0x60, 0x71, 0xBF, 0x92, 0x60, 0xA1, 0x6D, 0xFD, 0x1B, 0x30, 0xC1,
+		0x1B, 0xFB, 0x16, 0x0C, 0x12, 0x9F, 0xE1, 0xD6, 0x09, 0x16, 0xFA, 0x2C,
+		0x20, 0x68, 0xF6, 0xA5, 0x21, 0x12, 0x6B, 0xF5, 0xD3, 0x04, 0x6F, 0x5C,
+		0x20, 0x74, 0xDF, 0x4D, 0x10, 0x22, 0xF5, 0xA0, 0xA1, 0x1D, 0xF4, 0xA0,
+		0x2A, 0xF4, 0xC1, 0x0B, 0x12, 0xF5, 0x40, 0x02, 0xF5, 0x30, 0xD1, 0x8F,
+		0x4B, 0x00, 0x7F, 0x4B, 0x0E, 0x12, 0xF5, 0x1B, 0xF4, 0x70, 0xF1, 0xDF,
+		0x45, 0xDF, 0x44, 0x0F, 0x1A, 0xF4, 0x7F, 0x53, 0x0F, 0x19, 0xF4, 0x8E,
+		0xC3, 0xDF, 0x44, 0x0F, 0x1A, 0xF4, 0x7C, 0xF4, 0x70, 0xF1, 0xDF, 0x45,
+		0x9F, 0x4C, 0x0E, 0x12, 0xF5, 0x25, 0xF5, 0x30, 0xD1, 0x9F, 0x4D, 0x01,
+		0xDF, 0x4C, 0x0C, 0x13, 0xF5, 0x80, 0x17, 0xF5, 0xA0, 0xA1, 0x2D, 0xF5,
+		0x10, 0x2D, 0xF5, 0xB2, 0x07, 0x4D, 0xF5, 0x70, 0x34, 0xF7, 0xA5, 0x20,
+		0x01, 0x26, 0xBF, 0x6C, 0x05, 0x6F, 0xC2, 0xD1, 0x06, 0x6F, 0xA2, 0xC2,
+		0x08, 0x13, 0xDF, 0xF1, 0x90, 0xC1, 0x5C, 0xFB, 0x19, 0x30, 0xF1, 0x36,
+		0xAC, 0xDF, 0x1D, 0xC9, 0x51, 0x08, 0x10, 0x24, 0x02, 0x01, 0x2E, 0x20,
+		0x09, 0x13, 0x7B, 0xDF, 0x2D, 0xC9, 0x61, 0x09, 0x26, 0xDF, 0xB1, 0xA3,
+		0x0D, 0x14, 0xDF, 0xF1, 0xA1, 0x0A, 0x18, 0xFA, 0x2D, 0x30, 0x81, 0x9F,
+		0xD2, 0x40, 0x67, 0xF7, 0x94, 0x20, 0x01, 0x26, 0xBF, 0x73, 0x04, 0x4F,
+		0x69, 0x10, 0x74, 0xCF, 0x5D, 0x04, 0xCF, 0x56, 0x0A, 0x11, 0xBF, 0x57,
+		0x02, 0x5F, 0x57, 0x0C, 0x11, 0xDF, 0x51, 0x01, 0xCF, 0x4C, 0x0E, 0x13,
+		0xF5, 0x70, 0x02, 0xF5, 0x40, 0xF1, 0xBF, 0x4C, 0x00, 0x5F, 0x4D, 0x08,
+		0x25, 0xF5, 0x18, 0xF4, 0xA0, 0x82, 0x1F, 0x53, 0xAF, 0x48, 0x09, 0x2D,
+		0xF4, 0x4B, 0xF4, 0x6E, 0xE2, 0x5E, 0xC4, 0x8E, 0xE2, 0x4A, 0xF4, 0xA0,
+		0x82, 0x1F, 0x52, 0x8F, 0x4D, 0x08, 0x25, 0xF5, 0x00, 0x5F, 0x54, 0x0F,
+		0x1B, 0xF4, 0xB0, 0x01, 0xF5, 0xC0, 0xE1, 0x3F, 0x57, 0x01, 0xAF, 0x57,
+		0x0C, 0x11, 0xDF, 0x52, 0x01, 0x3F, 0x66, 0x0A, 0x11, 0xBF, 0x5B, 0x03,
+		0x9F, 0x69, 0x10, 0x74, 0xCF, 0x64, 0x03, 0x1D, 0xF7, 0x94, 0x20, 0x01,
+		0x26, 0xBF, 0x7C, 0x05, 0x3F, 0xF2, 0x40, 0x64, 0xDF, 0xC2, 0xA0, 0x81,
+		0x2B, 0xFB, 0x21, 0x0A, 0x15, 0xCF, 0x82, 0x60, 0xD1, 0x37, 0xBD, 0xF2,
+		0xC9, 0x5D, 0xF4, 0xC0, 0xF2, 0x8F, 0x53, 0x0E, 0x23, 0xF5, 0x80, 0xF2,
+		0xDF, 0x4D, 0x10, 0xE2, 0x8F, 0x54, 0x0E, 0x23, 0xF5, 0x90, 0xF2, 0xDF,
+		0x4D, 0x10, 0xE2, 0x8F, 0x55, 0x0E, 0x23, 0xF5, 0xB0, 0xF2, 0xDF, 0x52,
+		0x0E, 0x28, 0xF5, 0x70, 0xE2, 0x3F, 0x5C, 0x0F, 0x2D, 0xF5, 0x30, 0xE2,
+		0x8F, 0x58, 0x0E, 0x23, 0xF5, 0xD1, 0x0D, 0x21, 0xDF, 0x54, 0x0E, 0x28,
+		0xF5, 0xA0, 0xF1
+	};
+	
+	// Usage: Copy the 3 commented lines to your code, removing the comments.
+	//#include "XFont.h"
+	//XFont xFont;
+	//#include "Avenir_64_4b.h"
+	
+	// Leave the next 3 lines here, as is.
+	DataStream_P	dataStream(glyphData, sizeof(glyphData));
+	XFont4BitDataStream xFontDataStream(&xFont, &dataStream);
+	XFont::Font font(&fontHeader, charcodeRun, glyphDataOffset, &xFontDataStream);
+	
+	// The display needs to be set before using xFont.  This only needs
+	// to be done once at the beginning of the program.
+	// Use xFont.SetDisplay(&display, &Avenir_64_4b::font); to do this.
+	// To change to this font anywhere after setting the display,
+	// use: xFont.SetFont(&Avenir_64_4b::font);
+}
+
+#endif // Avenir_64_4b_h
+
@@ -89,6 +89,35 @@ namespace Config
 	const pin_t		kMotorEnablePin		= PD2;
 
 	const uint8_t	kDisplayRotation	= 3;	// 270
+	/*
+	*	Size of the off-screen strip buffer used to composite frequently
+	*	updated value fields before sending them to the display.  A field is
+	*	only composited when all of it fits (width x font rows), so this is
+	*	the widest, 70 x 20 for UI20ptFont (2800 bytes).
+	*/
+	const uint16_t	kStripBufferPixels	= 70*20;
+	/*
+	*	Size of the XFont glyph cache used to redraw recently drawn glyphs
+	*	without unpacking them again (8192 bytes.)
+	*/
+	const uint16_t	kGlyphCachePixels	= 4096;
+	/*
+	*	Size of the XFont line buffer used to compose a line of text before
+	*	sending it to the display.  This is 5 full display rows (4800 bytes),
+	*	at least one glyph of the largest font (UI64ptFont, 49 rows.)
+	*/
+	const uint16_t	kLineBufferPixels	= 480*5;
+	/*
+	*	Size of the buffer used to stream the pre-rendered static layers of
+	*	the dialogs from the SD card.  This is a single line of 4 sectors.
+	*	The layer is only faster than drawing the dialog when the card is read
+	*	at the SPI clock below.  At 4MHz reading the Cut Key dialog layer
+	*	alone (155KB) takes over 300ms.
+	*/
+	const uint16_t	kDialogLayerBufferSize	= 2048;
+	const uint8_t	kDialogLayerSDMHz	= 18;
+	// Buffer of the SdFatDataStream used to read the KeySpecCatalog (2 lines)
+	const uint16_t	kKeySpecCatalogBufferSize	= 1024;
 	
 	const uint32_t	kXMinEndstopMask 	= _BV(0); //digitalPinToBitMask(PC0);
 	const uint32_t	kXMaxEndstopMask 	= _BV(1); //digitalPinToBitMask(PC1);
@@ -196,6 +225,36 @@ namespace Config
 		uint16_t	pinCountMenuItemTag;
 		int32_t		pinDepths[8];
 	};
+	
+	/*
+	*	The preferences above are mirrored in RAM by AT24CPreferences.  The
+	*	mirror is EEPROM pages 0 to 5 (SCutKeyDialogPrefs ends in page 5.)
+	*/
+	const uint16_t	kPreferencesMirrorSize	= 192;
+	
+	/*
+	*	The cut history is an AT24CJournal in the remainder of the EEPROM,
+	*	page 8 to the end (124 64 byte slots.)  Each record also holds the
+	*	lifetime counters as of the cut.  The total number of cuts is the
+	*	journal's Appended().
+	*/
+	const uint16_t	kCutJournalAddr			= 256;	// EEPROM Page 8
+	const uint16_t	kCutJournalLength		= 8192 - kCutJournalAddr;
+	struct SCutRecord
+	{
+		uint32_t	time;				// UnixTime when the cut ended
+		uint32_t	completedCuts;		// Lifetime counters including this cut
+		uint32_t	abortedCuts;
+		uint16_t	keywayMenuItemTag;
+		uint8_t		pinCount;
+		uint8_t		result;				// One of ECutResult
+		int32_t		pinDepths[8];
+	};
+	enum ECutResult
+	{
+		eCutCompleted,
+		eCutAborted
+	};
 }
 
 #endif // Config_h
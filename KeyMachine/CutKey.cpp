@@ -144,6 +144,10 @@ bool CutKey::IsDone(void)
 		{
 			mExitState = eExitNormal;
 			done = true;
+			if (mCallback)
+			{
+				mCallback(this, mExitState);
+			}
 		}
 	}
 #endif
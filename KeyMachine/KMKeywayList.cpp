@@ -0,0 +1,349 @@
+/*
+*	KMKeywayList.cpp, Copyright Jonathan Mackey 2023
+*	The items of the virtual keyway menu filtered by a name prefix.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KMKeywayList.h"
+#include <ctype.h>
+#include <string.h>
+
+/******************************** KMKeywayList ********************************/
+/*
+*	inBuiltInCount can't be greater than 8.
+*/
+KMKeywayList::KMKeywayList(
+	KeySpecCatalog*		inCatalog,
+	XMenuItem* const*	inBuiltInItems,
+	uint8_t				inBuiltInCount)
+	: mCatalog(inCatalog), mMenu(nullptr), mBuiltInItems(inBuiltInItems),
+	  mBuiltInCount(inBuiltInCount)
+{
+	Reset();
+}
+
+/********************************** AttachTo **********************************/
+void KMKeywayList::AttachTo(
+	XMenu*	inMenu)
+{
+	mMenu = inMenu;
+	inMenu->SetDataSource(this, mMenuItems, kMenuItems);
+}
+
+/*********************************** Reset ************************************/
+void KMKeywayList::Reset(void)
+{
+	mPrefixLength = 0;
+	mPrefix[0] = 0;
+	mBuiltInMatches[0] = (1 << mBuiltInCount) - 1;
+	mStart[0] = 0;
+	mEnd[0] = mCatalog->Count();
+	mPriorSelectionID = kNoID;
+}
+
+/******************************* SetPrefixChar ********************************/
+bool KMKeywayList::SetPrefixChar(
+	uint8_t	inPosition,
+	char	inChar)
+{
+	if (inPosition <= mPrefixLength)
+	{
+		mPriorSelectionID = mMenu ? GetItemID(mMenu->GetSelectedIndex()) : kNoID;
+		if (inChar &&
+			inPosition < kMaxPrefixLength)
+		{
+			inChar = tolower((uint8_t)inChar);
+			uint8_t	nextLength = inPosition + 1;
+			uint8_t	matches = 0;
+			for (uint8_t i = 0; i < mBuiltInCount; i++)
+			{
+				if ((mBuiltInMatches[inPosition] & (1 << i)) &&
+					BuiltInChar(i, inPosition) == inChar)
+				{
+					matches |= (1 << i);
+				}
+			}
+			mBuiltInMatches[nextLength] = matches;
+			mStart[nextLength] = mStart[inPosition];
+			mEnd[nextLength] = mEnd[inPosition];
+			/*
+			*	If the name index can't be read THEN
+			*	only the built in keyways are listed.
+			*/
+			if (!mCatalog->NarrowByChar(inPosition, inChar,
+							mStart[nextLength], mEnd[nextLength]))
+			{
+				mEnd[nextLength] = mStart[nextLength];
+			}
+			mPrefix[inPosition] = inChar;
+			mPrefixLength = nextLength;
+		} else
+		{
+			mPrefixLength = inPosition;
+		}
+		mPrefix[mPrefixLength] = 0;
+	}
+	return(GetItemCount() != 0);
+}
+
+/******************************* NextPrefixChar *******************************/
+/*
+*	The next character is the closest of the catalog's next character and the
+*	next character of the matching built in keyways.
+*/
+char KMKeywayList::NextPrefixChar(
+	uint8_t	inPosition,
+	char	inChar,
+	bool	inForward)
+{
+	char	nextChar = 0;
+	if (inPosition <= mPrefixLength &&
+		inPosition < kMaxPrefixLength)
+	{
+		inChar = tolower((uint8_t)inChar);
+		nextChar = mCatalog->NextChar(inPosition, inChar, inForward,
+							mStart[inPosition], mEnd[inPosition]);
+		for (uint8_t i = 0; i < mBuiltInCount; i++)
+		{
+			if (mBuiltInMatches[inPosition] & (1 << i))
+			{
+				uint8_t	thisChar = BuiltInChar(i, inPosition);
+				if (thisChar == 0)
+				{
+					continue;
+				}
+				if (inForward)
+				{
+					if (thisChar > (uint8_t)inChar &&
+						(nextChar == 0 || thisChar < (uint8_t)nextChar))
+					{
+						nextChar = thisChar;
+					}
+				} else if ((inChar == 0 || thisChar < (uint8_t)inChar) &&
+					thisChar > (uint8_t)nextChar)
+				{
+					nextChar = thisChar;
+				}
+			}
+		}
+	}
+	return(nextChar);
+}
+
+/******************************** BuiltInChar *********************************/
+/*
+*	Returns the lower case character at inPosition of the built in keyway's
+*	name.  The caller ensures that the name has at least inPosition characters.
+*/
+char KMKeywayList::BuiltInChar(
+	uint8_t	inBuiltIn,
+	uint8_t	inPosition) const
+{
+	return(tolower((uint8_t)mBuiltInItems[inBuiltIn]->GetString()[inPosition]));
+}
+
+/***************************** BuiltInMatchCount ******************************/
+uint8_t KMKeywayList::BuiltInMatchCount(void) const
+{
+	uint8_t	count = 0;
+	for (uint8_t i = 0; i < mBuiltInCount; i++)
+	{
+		if (mBuiltInMatches[mPrefixLength] & (1 << i))
+		{
+			count++;
+		}
+	}
+	return(count);
+}
+
+/********************************* BuiltInAt **********************************/
+/*
+*	Returns the index into mBuiltInItems of the inIndex'th matching built in
+*	keyway.
+*/
+uint8_t KMKeywayList::BuiltInAt(
+	uint16_t	inIndex) const
+{
+	uint8_t	i = 0;
+	for (; i < mBuiltInCount; i++)
+	{
+		if (mBuiltInMatches[mPrefixLength] & (1 << i))
+		{
+			if (inIndex == 0)
+			{
+				break;
+			}
+			inIndex--;
+		}
+	}
+	return(i);
+}
+
+/******************************** GetItemCount ********************************/
+uint16_t KMKeywayList::GetItemCount(void) const
+{
+	return(BuiltInMatchCount() + mEnd[mPrefixLength] - mStart[mPrefixLength]);
+}
+
+/********************************* GetItemID **********************************/
+/*
+*	Returns the ID of the listed item at inIndex or kNoID.
+*/
+uint16_t KMKeywayList::GetItemID(
+	uint16_t	inIndex) const
+{
+	uint16_t	id = kNoID;
+	uint8_t		builtInMatchCount = BuiltInMatchCount();
+	if (inIndex < builtInMatchCount)
+	{
+		id = kBuiltInID + BuiltInAt(inIndex);
+	} else if (inIndex < GetItemCount())
+	{
+		id = mStart[mPrefixLength] + inIndex - builtInMatchCount;
+	}
+	return(id);
+}
+
+/*************************** GetPriorSelectionIndex ***************************/
+/*
+*	A built in keyway is listed if its bit is set in the matches, its index
+*	is the number of matching built in keyways before it.  A catalog keyway
+*	is listed if its name index position is within [mStart, mEnd).
+*/
+uint16_t KMKeywayList::GetPriorSelectionIndex(void) const
+{
+	uint16_t	index = 0;
+	if (mPriorSelectionID != kNoID)
+	{
+		if (mPriorSelectionID >= kBuiltInID)
+		{
+			uint8_t	builtIn = mPriorSelectionID - kBuiltInID;
+			uint8_t	matches = mBuiltInMatches[mPrefixLength];
+			if (matches & (1 << builtIn))
+			{
+				for (uint8_t i = 0; i < builtIn; i++)
+				{
+					if (matches & (1 << i))
+					{
+						index++;
+					}
+				}
+			}
+		} else if (mPriorSelectionID >= mStart[mPrefixLength] &&
+			mPriorSelectionID < mEnd[mPrefixLength])
+		{
+			index = BuiltInMatchCount() + mPriorSelectionID - mStart[mPrefixLength];
+		}
+	}
+	return(index);
+}
+
+/****************************** GetMenuItemCount ******************************/
+/*
+*	GetMenuItemCount, LoadMenuItem and FindMenuItemIndex are members of the
+*	XMenuDataSource mixin class.  They supply the items of the virtual
+*	keyway menu.  The catalog is only loaded while the Cut Key dialog is
+*	shown, the matching built in keyways are always listed.
+*/
+uint16_t KMKeywayList::GetMenuItemCount(
+	XMenu*)
+{
+	return(GetItemCount());
+}
+
+/******************************** LoadMenuItem ********************************/
+/*
+*	The catalog's items are read from its name index, so only the names of the
+*	visible rows are in RAM.  Each XMenuItem has its own string buffer.  The
+*	items are recycled, so the state is always set (enabled, off), not only
+*	when the read fails.
+*/
+void KMKeywayList::LoadMenuItem(
+	XMenu*,
+	uint16_t	inIndex,
+	XMenuItem*	ioItem)
+{
+	uint8_t	builtInMatchCount = BuiltInMatchCount();
+	if (inIndex < builtInMatchCount)
+	{
+		XMenuItem*	builtInItem = mBuiltInItems[BuiltInAt(inIndex)];
+		ioItem->SetTag(builtInItem->Tag());
+		ioItem->SetString(builtInItem->GetString());
+		ioItem->SetState(XMenuItem::eOff);
+	} else
+	{
+		char*	itemStr = mMenuItemStrs[ioItem - mMenuItems];
+		SKeySpecCatalogNameEntry	entry;
+		if (mCatalog->GetNameEntry(
+				mStart[mPrefixLength] + inIndex - builtInMatchCount, entry))
+		{
+			memcpy(itemStr, entry.name, sizeof(SKeySpec::name));
+			itemStr[sizeof(SKeySpec::name)-1] = 0;
+			ioItem->SetTag(entry.tag);
+			ioItem->SetState(XMenuItem::eOff);
+		/*
+		*	Else the card was removed or the read failed.
+		*/
+		} else
+		{
+			itemStr[0] = '?';
+			itemStr[1] = 0;
+			ioItem->SetTag(0);
+			ioItem->SetState(XMenuItem::eDisabled);
+		}
+		ioItem->SetString(itemStr);
+	}
+}
+
+/***************************** FindMenuItemIndex ******************************/
+/*
+*	The matching range of the catalog's name index is searched sequentially.
+*	This is only done when an item is selected by tag, not while scrolling.
+*/
+uint16_t KMKeywayList::FindMenuItemIndex(
+	XMenu*,
+	uint16_t	inTag)
+{
+	uint16_t	index = 0;
+	uint8_t		builtInMatchCount = BuiltInMatchCount();
+	while (index < builtInMatchCount &&
+		mBuiltInItems[BuiltInAt(index)]->Tag() != inTag)
+	{
+		index++;
+	}
+	if (index == builtInMatchCount)
+	{
+		uint16_t	itemCount = GetItemCount();
+		uint16_t	nameIndex = mStart[mPrefixLength];
+		SKeySpecCatalogNameEntry	entry;
+		for (; index < itemCount; index++, nameIndex++)
+		{
+			if (!mCatalog->GetNameEntry(nameIndex, entry))
+			{
+				index = itemCount;
+				break;
+			}
+			if (entry.tag == inTag)
+			{
+				break;
+			}
+		}
+	}
+	return(index);
+}
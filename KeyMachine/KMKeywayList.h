@@ -0,0 +1,133 @@
+/*
+*	KMKeywayList.h, Copyright Jonathan Mackey 2023
+*	The items of the virtual keyway menu filtered by a name prefix.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMKeywayList_h
+#define KMKeywayList_h
+
+#include "XMenu.h"
+#include "XMenuItem.h"
+#include "KeySpecCatalog.h"
+
+/*
+*	KMKeywayList lists the built in keyways followed by the names of the
+*	KeySpecCatalog that start with the prefix.  The prefix is entered one
+*	character at a time.  Because the catalog's name index is sorted, the
+*	matching names are a range of the index.  Each character narrows the range
+*	of the previous prefix length by a binary search, so a character costs
+*	O(log n) name entry reads rather than a scan of the catalog.  The range of
+*	each prefix length is kept so that removing a character costs nothing.
+*	Characters are compared as lower case.
+*/
+class KMKeywayList : public XMenuDataSource
+{
+public:
+	static const uint8_t	kMaxPrefixLength = 4;
+	static const uint16_t	kMenuItems = 11;	// The selected item + 10 rows
+							KMKeywayList(
+								KeySpecCatalog*			inCatalog,
+								XMenuItem* const*		inBuiltInItems,
+								uint8_t					inBuiltInCount);
+	void					AttachTo(
+								XMenu*					inMenu);
+	/*
+	*	Reset: Clears the prefix.  Call whenever the catalog is loaded or
+	*	unloaded.
+	*/
+	void					Reset(void);
+	const char*				GetPrefix(void) const
+								{return(mPrefix);}
+	uint8_t					GetPrefixLength(void) const
+								{return(mPrefixLength);}
+	/*
+	*	SetPrefixChar: Sets the prefix character at inPosition and removes any
+	*	characters after it.  inChar 0 removes the characters from inPosition
+	*	on.  inPosition can't be greater than the prefix length.  Returns true
+	*	if any keyway starts with the resulting prefix.
+	*/
+	bool					SetPrefixChar(
+								uint8_t					inPosition,
+								char					inChar);
+	/*
+	*	NextPrefixChar: Returns the next (inForward) or previous character
+	*	after inChar that can be entered at inPosition, i.e. only characters
+	*	that some keyway name has at inPosition.  inChar 0 returns the first
+	*	or last character.  Returns 0 if there isn't one.
+	*/
+	char					NextPrefixChar(
+								uint8_t					inPosition,
+								char					inChar,
+								bool					inForward);
+	uint16_t				GetItemCount(void) const;
+	/*
+	*	GetPriorSelectionIndex: Returns the index of the item that was selected
+	*	in the attached menu before the prefix last changed if it's still
+	*	listed, otherwise 0 (the first match.)  The catalog isn't read.
+	*/
+	uint16_t				GetPriorSelectionIndex(void) const;
+
+	// XMenuDataSource
+	virtual uint16_t		GetMenuItemCount(
+								XMenu*					inMenu);
+	virtual void			LoadMenuItem(
+								XMenu*					inMenu,
+								uint16_t				inIndex,
+								XMenuItem*				ioItem);
+	virtual uint16_t		FindMenuItemIndex(
+								XMenu*					inMenu,
+								uint16_t				inTag);
+protected:
+	/*
+	*	An item ID identifies a listed item independent of the prefix.  It's
+	*	either kBuiltInID plus the index into mBuiltInItems, or the position
+	*	in the catalog's name index.
+	*/
+	static const uint16_t	kBuiltInID = 0x8000;
+	static const uint16_t	kNoID = 0xFFFF;
+	KeySpecCatalog*		mCatalog;
+	XMenu*				mMenu;
+	XMenuItem* const*	mBuiltInItems;
+	uint8_t				mBuiltInCount;
+	uint8_t				mPrefixLength;
+	char				mPrefix[kMaxPrefixLength+1];
+	/*
+	*	Indexed by prefix length.  mBuiltInMatches has a bit for each built in
+	*	keyway that matches.  [mStart, mEnd) is the range of the name index
+	*	that matches.
+	*/
+	uint8_t				mBuiltInMatches[kMaxPrefixLength+1];
+	uint16_t			mStart[kMaxPrefixLength+1];
+	uint16_t			mEnd[kMaxPrefixLength+1];
+	uint16_t			mPriorSelectionID;
+	XMenuItem			mMenuItems[kMenuItems];
+	char				mMenuItemStrs[kMenuItems][sizeof(SKeySpec::name)];
+
+	char					BuiltInChar(
+								uint8_t					inBuiltIn,
+								uint8_t					inPosition) const;
+	uint8_t					BuiltInMatchCount(void) const;
+	uint8_t					BuiltInAt(
+								uint16_t				inIndex) const;
+	uint16_t				GetItemID(
+								uint16_t				inIndex) const;
+};
+
+#endif // KMKeywayList_h
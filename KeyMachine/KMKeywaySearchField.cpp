@@ -0,0 +1,267 @@
+/*
+*	KMKeywaySearchField.cpp, Copyright Jonathan Mackey 2023
+*	The keyway name prefix field that can be associated with a stepper.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KMKeywaySearchField.h"
+#include "DisplayController.h"
+#include <ctype.h>
+
+const char kNextCellStr[] = "-";
+const uint16_t	kDarkBlueColor = 0xFB00; // Dark blue
+
+/**************************** KMKeywaySearchField *****************************/
+KMKeywaySearchField::KMKeywaySearchField(
+	int16_t			inX,		// Not used when aligned to stepper
+	int16_t			inY,		// Not used when aligned to stepper
+	uint16_t		inWidth,
+	uint16_t		inTag,
+	XView*			inNextView,
+	XFont::Font*	inFont,
+	uint16_t		inFGColor,
+	uint16_t		inBGColor)
+	: XValueField(inX, inY, inWidth, inTag, inNextView, inFont, 0, inFGColor, inBGColor),
+	  mKeywayList(nullptr), mActiveCell(0), mDirtyCells(0), mCellStrs{}
+{
+	XFont*	xFont = MakeFontCurrent();
+	if (xFont)
+	{
+		/*
+		*	Each cell is wide enough for the widest upper case character.
+		*/
+		xFont->LoadGlyph('W');
+		mCellWidth = xFont->Glyph().advanceX;
+		xFont->LoadGlyph(' ');
+		uint16_t	spaceWidth = xFont->Glyph().advanceX;
+
+		uint16_t	cellX = spaceWidth; // gap
+		for (uint16_t i = 0; i < kNumCells; i++)
+		{
+			mCellX[i] = cellX;
+			cellX += mCellWidth;
+		}
+		cellX += spaceWidth; // gap
+		mWidth = cellX;
+	}
+	UpdateStringForValue();
+}
+
+/******************************* PrefixChanged ********************************/
+void KMKeywaySearchField::PrefixChanged(
+	bool	inUpdate)
+{
+	if (mKeywayList &&
+		mActiveCell > mKeywayList->GetPrefixLength())
+	{
+		mActiveCell = mKeywayList->GetPrefixLength();
+		mDirtyCells = (1 << kNumCells) - 1;
+	}
+	if (!SetValue(ValueFromPrefix(), inUpdate) &&
+		inUpdate && mDirtyCells)
+	{
+		DrawCells();
+	}
+}
+
+/********************************** DrawSelf **********************************/
+void KMKeywaySearchField::DrawSelf(void)
+{
+	mDirtyCells = (1 << kNumCells) - 1;	// Draw all cells
+	DrawCells();
+}
+
+/********************************* DrawCells **********************************/
+void KMKeywaySearchField::DrawCells(void)
+{
+	XFont*	xFont = MakeFontCurrent();
+	if (xFont)
+	{
+		DisplayController*	display = xFont->GetDisplay();
+		display->SetFGColor(kDarkBlueColor);
+		display->SetBGColor(mBGColor);
+		int16_t	x = 0;
+		int16_t	y = 0;
+		// Note: if mY's global value is zero, FillRect and
+		// DrawRoundedRect will fail.
+		LocalToGlobal(x, y);
+		uint8_t	mask = 1;
+		for (uint8_t i = 0; i < kNumCells; i++, mask <<= 1)
+		{
+			if (mDirtyCells & mask)
+			{
+				if (i == mActiveCell)
+				{
+					xFont->SetTextColor(XFont::eWhite);
+					xFont->SetBGTextColor(kDarkBlueColor);
+					display->DrawRoundedRect(x+mCellX[i], y-3, mCellWidth, mHeight+4, 3);
+				} else
+				{
+					xFont->SetTextColor(mCellStrs[i][0] == kNextCellStr[0] ?
+											(uint16_t)XFont::eGray : kDarkBlueColor);
+					xFont->SetBGTextColor(mBGColor);
+					display->FillRect(x+mCellX[i], y-3, mCellWidth, mHeight+4, mBGColor);
+				}
+				xFont->DrawAligned(mCellStrs[i], x+mCellX[i], y, mCellWidth,
+														XFont::eAlignCenter, false);
+			}
+		}
+		mDirtyCells = 0;
+	}
+}
+
+/********************************* MouseDown **********************************/
+void KMKeywaySearchField::MouseDown(
+	int16_t	inGlobalX,
+	int16_t	inGlobalY)
+{
+	if (mKeywayList)
+	{
+		int16_t	x = inGlobalX;
+		int16_t	y = inGlobalY;
+		GlobalToLocal(x, y);
+		uint8_t	lastCell = mKeywayList->GetPrefixLength();
+		if (lastCell >= kNumCells)
+		{
+			lastCell = kNumCells - 1;
+		}
+		uint8_t	i = 0;
+		for (; i <= lastCell; i++)
+		{
+			if (x < mCellX[i] || x >= mCellX[i]+mCellWidth)
+			{
+				continue;
+			}
+			break;
+		}
+		/*
+		*	If a cell that can be entered was selected AND
+		*	it's not already selected
+		*/
+		if (i <= lastCell &&
+			i != mActiveCell)
+		{
+			mDirtyCells |= ((1 << mActiveCell) | (1 << i));
+			mActiveCell = i;
+			DrawCells();
+		}
+	}
+}
+
+/******************************** ValueIsValid ********************************/
+bool KMKeywaySearchField::ValueIsValid(
+	int32_t)
+{
+	return(true);
+}
+
+/******************************* IncrementValue *******************************/
+bool KMKeywaySearchField::IncrementValue(void)
+{
+	return(StepActiveCell(true));
+}
+
+/******************************* DecrementValue *******************************/
+bool KMKeywaySearchField::DecrementValue(void)
+{
+	return(StepActiveCell(false));
+}
+
+/******************************* StepActiveCell *******************************/
+/*
+*	Steps the active cell to the next or previous character that a listed
+*	keyway has at that position.  After the last character the cell is blank,
+*	which removes it and any cells following it from the prefix.
+*/
+bool KMKeywaySearchField::StepActiveCell(
+	bool	inForward)
+{
+	bool	valueChanged = false;
+	if (mKeywayList &&
+		mActiveCell <= mKeywayList->GetPrefixLength())
+	{
+		char	thisChar = mKeywayList->GetPrefix()[mActiveCell];
+		char	nextChar = mKeywayList->NextPrefixChar(mActiveCell, thisChar, inForward);
+		if (nextChar != thisChar)
+		{
+			mKeywayList->SetPrefixChar(mActiveCell, nextChar);
+			valueChanged = SetValue(ValueFromPrefix(), true);
+		}
+	}
+	return(valueChanged);
+}
+
+/******************************** ValueChanged ********************************/
+void KMKeywaySearchField::ValueChanged(
+	bool	inUpdate)
+{
+	UpdateStringForValue();
+	
+	if (inUpdate)
+	{
+		DrawCells();
+	}
+}
+
+/**************************** UpdateStringForValue ****************************/
+/*
+*	The prefix characters are shown in upper case followed by kNextCellStr
+*	in the cell that can be entered next.  Only the cells whose string changed
+*	are marked dirty.
+*/
+void KMKeywaySearchField::UpdateStringForValue(void)
+{
+	bool	ended = false;
+	for (uint8_t i = 0; i < kNumCells; i++)
+	{
+		char	thisChar = (mValue >> (i * 8)) & 0xFF;
+		char	cellChar = 0;
+		if (!ended)
+		{
+			if (thisChar)
+			{
+				cellChar = toupper((uint8_t)thisChar);
+			} else
+			{
+				cellChar = kNextCellStr[0];
+				ended = true;
+			}
+		}
+		if (mCellStrs[i][0] != cellChar)
+		{
+			mCellStrs[i][0] = cellChar;
+			mDirtyCells |= (1 << i);
+		}
+	}
+}
+
+/****************************** ValueFromPrefix *******************************/
+int32_t KMKeywaySearchField::ValueFromPrefix(void) const
+{
+	uint32_t	value = 0;
+	if (mKeywayList)
+	{
+		const char*	prefix = mKeywayList->GetPrefix();
+		for (uint8_t i = 0; prefix[i]; i++)
+		{
+			value |= ((uint32_t)(uint8_t)prefix[i] << (i * 8));
+		}
+	}
+	return((int32_t)value);
+}
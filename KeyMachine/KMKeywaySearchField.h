@@ -0,0 +1,83 @@
+/*
+*	KMKeywaySearchField.h, Copyright Jonathan Mackey 2023
+*	The keyway name prefix field that can be associated with a stepper.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMKeywaySearchField_h
+#define KMKeywaySearchField_h
+
+#include "XValueField.h"
+#include "KMKeywayList.h"
+
+/*
+*	Each cell of the field is a character of the KMKeywayList prefix.  A cell
+*	is made active by tapping it.  Only the cells of the prefix and the cell
+*	following it can be active.  The stepper steps the active cell through the
+*	characters that the keyway names have at that position, then blank.
+*	Changing a cell removes the cells following it.  mValue holds the prefix
+*	characters, one per byte.
+*/
+class KMKeywaySearchField : public XValueField
+{
+public:
+							KMKeywaySearchField(
+								int16_t					inX,
+								int16_t					inY,
+								uint16_t				inWidth,
+								uint16_t				inTag,
+								XView*					inNextView = nullptr,
+								XFont::Font*			inFont = nullptr,
+								uint16_t				inFGColor = XFont::eWhite,
+								uint16_t				inBGColor =  XFont::eBlack);
+	virtual void			DrawSelf(void);
+	virtual void			MouseDown(
+								int16_t					inGlobalX,
+								int16_t					inGlobalY);
+	void					SetKeywayList(
+								KMKeywayList*			inKeywayList)
+								{mKeywayList = inKeywayList;}
+	/*
+	*	PrefixChanged: Call after the KMKeywayList prefix is changed by other
+	*	than this field, e.g. KMKeywayList::Reset.
+	*/
+	void					PrefixChanged(
+								bool					inUpdate = true);
+	virtual bool			IncrementValue(void);
+	virtual bool			DecrementValue(void);
+	virtual void			ValueChanged(
+								bool					inUpdate = true);
+protected:
+	static const uint8_t	kNumCells = KMKeywayList::kMaxPrefixLength;
+	KMKeywayList*	mKeywayList;
+	uint8_t			mActiveCell;
+	uint8_t			mDirtyCells;
+	uint16_t		mCellX[kNumCells];
+	uint16_t		mCellWidth;
+	char			mCellStrs[kNumCells][2];
+
+	virtual bool			ValueIsValid(
+								int32_t					inValue);
+	virtual void			UpdateStringForValue(void);
+	int32_t					ValueFromPrefix(void) const;
+	bool					StepActiveCell(
+								bool					inForward);
+	void					DrawCells(void);
+};
+#endif // KMKeywaySearchField_h
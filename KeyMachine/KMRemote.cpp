@@ -0,0 +1,154 @@
+/*
+*	KMRemote.cpp, Copyright Jonathan Mackey 2023
+*	The KeyMachine side of the binary serial protocol.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KMRemote.h"
+#include <string.h>
+
+/********************************** KMRemote **********************************/
+KMRemote::KMRemote(
+	KMRemoteDelegate*	inDelegate)
+	: mDelegate(inDelegate), mTelemetrySeq(0), mHasLastRequest(false),
+	  mLastRequestSeq(0), mLastRequestCRC(0), mLastResponseLength(0)
+{
+}
+
+/********************************** Receive ***********************************/
+bool KMRemote::Receive(
+	uint8_t	inByte)
+{
+	SerialFrame::EReceiveState	state = mFrame.Receive(inByte);
+	if (state == SerialFrame::eFrameReceived)
+	{
+		/*
+		*	Responses and reports are only sent by the KeyMachine.  If this is
+		*	a request...
+		*/
+		if ((mFrame.Type() & (kKMRemoteResponse | kKMRemoteTelemetry)) == 0)
+		{
+			/*
+			*	If this is a resend of the last request THEN
+			*	resend the last response.  The host resends the identical
+			*	frame, so the CRC matches as well.
+			*/
+			if (mHasLastRequest &&
+				mFrame.Seq() == mLastRequestSeq &&
+				mFrame.FrameCRC() == mLastRequestCRC)
+			{
+				mDelegate->WriteRemote(mLastResponse, mLastResponseLength);
+			} else
+			{
+				mHasLastRequest = true;
+				mLastRequestSeq = mFrame.Seq();
+				mLastRequestCRC = mFrame.FrameCRC();
+				HandleRequest();
+			}
+		}
+	}
+	return(state != SerialFrame::eIgnored);
+}
+
+/******************************* HandleRequest ********************************/
+void KMRemote::HandleRequest(void)
+{
+	bool	badRequest = false;
+	uint8_t	payloadLength = mFrame.PayloadLength();
+	switch (mFrame.Type())
+	{
+		case kKMRemoteQueueCut:
+			if (payloadLength == sizeof(SKMRemoteCutJob))
+			{
+				SKMRemoteCutJob			job;
+				SKMRemoteCutResponse	response = {0};
+				memcpy(&job, mFrame.Payload(), sizeof(SKMRemoteCutJob));
+				response.status = mDelegate->QueueRemoteCut(job, response);
+				SendResponse(&response, sizeof(SKMRemoteCutResponse));
+			} else
+			{
+				badRequest = true;
+			}
+			break;
+		case kKMRemoteGetQueueState:
+			if (payloadLength == 0)
+			{
+				SKMRemoteQueueState	state = {0};
+				mDelegate->GetRemoteQueueState(state);
+				SendResponse(&state, sizeof(SKMRemoteQueueState));
+			} else
+			{
+				badRequest = true;
+			}
+			break;
+		case kKMRemoteSetTelemetry:
+			if (payloadLength == sizeof(SKMRemoteTelemetryRequest))
+			{
+				SKMRemoteTelemetryRequest	request;
+				SKMRemoteStatus				response = {eKMRemoteOK};
+				memcpy(&request, mFrame.Payload(), sizeof(SKMRemoteTelemetryRequest));
+				if (request.periodMS &&
+					request.periodMS < kKMRemoteMinTelemetryPeriod)
+				{
+					request.periodMS = kKMRemoteMinTelemetryPeriod;
+				}
+				mTelemetryPeriod.Set(request.periodMS);
+				mTelemetryPeriod.Start();
+				SendResponse(&response, sizeof(SKMRemoteStatus));
+			} else
+			{
+				badRequest = true;
+			}
+			break;
+		default:
+			badRequest = true;
+			break;
+	}
+	if (badRequest)
+	{
+		SKMRemoteStatus	response = {eKMRemoteBadRequest};
+		SendResponse(&response, sizeof(SKMRemoteStatus));
+	}
+}
+
+/******************************** SendResponse ********************************/
+void KMRemote::SendResponse(
+	const void*	inPayload,
+	uint8_t		inLength)
+{
+	mLastResponseLength = SerialFrame::Encode(mFrame.Seq(),
+							mFrame.Type() | kKMRemoteResponse,
+							inPayload, inLength, mLastResponse);
+	mDelegate->WriteRemote(mLastResponse, mLastResponseLength);
+}
+
+/*********************************** Update ***********************************/
+void KMRemote::Update(void)
+{
+	if (mTelemetryPeriod.Passed())
+	{
+		mTelemetryPeriod.Start();
+		SKMRemoteTelemetry	telemetry = {0};
+		mDelegate->GetRemoteTelemetry(telemetry);
+		uint8_t	frame[SerialFrame::kMaxFrameSize];
+		mDelegate->WriteRemote(frame, SerialFrame::Encode(mTelemetrySeq++,
+							kKMRemoteTelemetry, &telemetry,
+							sizeof(SKMRemoteTelemetry), frame));
+	}
+}
@@ -0,0 +1,88 @@
+/*
+*	KMRemote.h, Copyright Jonathan Mackey 2023
+*	The KeyMachine side of the binary serial protocol.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMRemote_h
+#define KMRemote_h
+
+#include "SerialFrame.h"
+#include "MSPeriod.h"
+#include "KMRemoteProtocol.h"
+
+/*
+*	KMRemoteDelegate is a mixin class.  The delegate carries out the requests
+*	and writes the encoded frames to the serial line.
+*/
+class KMRemoteDelegate
+{
+public:
+	virtual uint8_t			QueueRemoteCut(
+								const SKMRemoteCutJob&	inJob,
+								SKMRemoteCutResponse&	outResponse) = 0;
+	virtual void			GetRemoteQueueState(
+								SKMRemoteQueueState&	outState) = 0;
+	virtual void			GetRemoteTelemetry(
+								SKMRemoteTelemetry&		outTelemetry) = 0;
+	virtual void			WriteRemote(
+								const uint8_t*			inData,
+								uint16_t				inLength) = 0;
+};
+
+/*
+*	KMRemote decodes the requests (see KMRemoteProtocol.h), passes them to the
+*	delegate, and sends the responses and telemetry reports.  The last
+*	response is kept so that it can be resent when the host resends the same
+*	request.
+*/
+class KMRemote
+{
+public:
+							KMRemote(
+								KMRemoteDelegate*		inDelegate);
+	/*
+	*	Receive: Returns false if inByte isn't part of a frame.
+	*/
+	bool					Receive(
+								uint8_t					inByte);
+	/*
+	*	Update: Sends a telemetry report when one is due.  Call from loop().
+	*/
+	void					Update(void);
+	uint16_t				DroppedFrames(void) const
+								{return(mFrame.DroppedFrames());}
+protected:
+	KMRemoteDelegate*	mDelegate;
+	SerialFrame			mFrame;
+	MSPeriod			mTelemetryPeriod;
+	uint8_t				mTelemetrySeq;
+	bool				mHasLastRequest;
+	uint8_t				mLastRequestSeq;
+	uint16_t			mLastRequestCRC;
+	uint16_t			mLastResponseLength;
+	uint8_t				mLastResponse[SerialFrame::kMaxFrameSize];
+
+	void					HandleRequest(void);
+	void					SendResponse(
+								const void*				inPayload,
+								uint8_t					inLength);
+};
+
+#endif // KMRemote_h
@@ -0,0 +1,127 @@
+/*
+*	KMRemoteProtocol.h, Copyright Jonathan Mackey 2023
+*	Messages of the KeyMachine's binary serial protocol.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMRemoteProtocol_h
+#define KMRemoteProtocol_h
+
+#include <inttypes.h>
+
+/*
+*	The messages are sent as SerialFrames.  The structures are little endian
+*	with natural alignment, the same on the KeyMachine and the host.  This file
+*	is shared by the KeyMachine (KMRemote) and the host client
+*	(HostTools/KMRemoteClient).
+*
+*	Requests are sent by the host.  Each new request has the next sequence
+*	number.  The response has the same sequence number and the request's type
+*	OR kKMRemoteResponse.  The first byte of every response is an
+*	EKMRemoteStatus.  If the response is lost the host resends the identical
+*	request.  The KeyMachine recognizes the duplicate and resends its response
+*	without acting on the request again, so a cut is never queued twice.
+*
+*	Telemetry reports are sent by the KeyMachine at the period requested by
+*	kKMRemoteSetTelemetry.  Their sequence number is the KeyMachine's report
+*	count so that the host can detect lost reports.
+*/
+static const uint8_t	kKMRemoteQueueCut		= 0x01;	// SKMRemoteCutJob
+static const uint8_t	kKMRemoteGetQueueState	= 0x02;	// No payload
+static const uint8_t	kKMRemoteSetTelemetry	= 0x03;	// SKMRemoteTelemetryRequest
+static const uint8_t	kKMRemoteTelemetry		= 0x40;	// SKMRemoteTelemetry
+static const uint8_t	kKMRemoteResponse		= 0x80;
+
+enum EKMRemoteStatus
+{
+	eKMRemoteOK,
+	eKMRemoteBadRequest,	// Unknown type or wrong payload length
+	eKMRemoteBusy,			// The steppers are busy or actions are queued
+	eKMRemoteUnknownKeyway,
+	eKMRemoteBadPinCount,	// Not supported by the keyway
+	eKMRemoteBadPins,		// See SKMRemoteCutResponse errorCode & errorPin
+	eKMRemoteNoOrigin		// The key holder origin hasn't been setup
+};
+
+static const uint8_t	kKMRemoteMaxPins = 6;		// SKeySpec::eMaxPinCount
+static const uint8_t	kKMRemoteActionNameSize = 16;
+
+// kKMRemoteQueueCut request
+struct SKMRemoteCutJob
+{
+	uint16_t	keywayTag;		// Built in keyway or KeySpecCatalog tag
+	uint8_t		pinCount;
+	uint8_t		pins[kKMRemoteMaxPins];	// Depth index of each pin, 0 to 9
+	uint8_t		unused;
+	int32_t		customDepths[kKMRemoteMaxPins];	// Dec22mm, 0 to use pins[n]
+};
+
+// kKMRemoteQueueCut response
+struct SKMRemoteCutResponse
+{
+	uint8_t		status;			// EKMRemoteStatus
+	uint8_t		errorCode;		// SKeySpec::EErrorCode when eKMRemoteBadPins
+	uint8_t		errorPin;
+	uint8_t		unused;
+};
+
+// kKMRemoteGetQueueState response
+struct SKMRemoteQueueState
+{
+	uint8_t		status;			// EKMRemoteStatus
+	uint8_t		queueState;		// KMActionQueue::EActionQueueState
+	uint8_t		queuedActions;	// Including the current action
+	uint8_t		cutInProgress;
+	uint32_t	exitState;		// Of the current action
+	uint32_t	completedCuts;	// Lifetime counters from the cut journal
+	uint32_t	abortedCuts;
+	char		currentAction[kKMRemoteActionNameSize];	// Empty if none
+};
+
+/*
+*	kKMRemoteSetTelemetry request
+*	At 19200 baud a report takes about 20ms to send.  Shorter periods than
+*	kKMRemoteMinTelemetryPeriod are raised to it so that the reports never
+*	fill the serial transmit buffer and stall the loop.
+*/
+static const uint16_t	kKMRemoteMinTelemetryPeriod = 50;
+struct SKMRemoteTelemetryRequest
+{
+	uint16_t	periodMS;		// 0 stops the reports
+};
+
+// kKMRemoteSetTelemetry response
+struct SKMRemoteStatus
+{
+	uint8_t		status;			// EKMRemoteStatus
+};
+
+// kKMRemoteTelemetry report
+struct SKMRemoteTelemetry
+{
+	int32_t		x;				// Stepper positions in steps
+	int32_t		z;
+	uint8_t		queueState;		// KMActionQueue::EActionQueueState
+	uint8_t		motorRunning;
+	uint8_t		cutInProgress;
+	uint8_t		unused;
+	char		currentAction[kKMRemoteActionNameSize];	// Empty if none
+};
+
+#endif // KMRemoteProtocol_h
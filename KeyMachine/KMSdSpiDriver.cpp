@@ -0,0 +1,87 @@
+/*
+*	KMSdSpiDriver.cpp, Copyright Jonathan Mackey 2023
+*	SdFat SPI driver that uses SPIBus transactions.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KMSdSpiDriver.h"
+
+/********************************** activate **********************************/
+void KMSdSpiDriver::activate(void)
+{
+	SPIBus::BeginTransaction(mSPISettings);
+}
+
+/*********************************** begin ************************************/
+void KMSdSpiDriver::begin(
+	SdSpiConfig	inConfig)
+{
+	(void)inConfig;
+	SPI.begin();
+}
+
+/********************************* deactivate *********************************/
+void KMSdSpiDriver::deactivate(void)
+{
+	SPIBus::EndTransaction();
+}
+
+/********************************** receive ***********************************/
+uint8_t KMSdSpiDriver::receive(void)
+{
+	return(SPI.transfer(0xFF));
+}
+
+/********************************** receive ***********************************/
+/*
+*	Returns 0 (no error.)
+*/
+uint8_t KMSdSpiDriver::receive(
+	uint8_t*	outBuf,
+	size_t		inCount)
+{
+	memset(outBuf, 0xFF, inCount);
+	SPI.transfer(outBuf, inCount);
+	return(0);
+}
+
+/************************************ send ************************************/
+void KMSdSpiDriver::send(
+	uint8_t	inData)
+{
+	SPI.transfer(inData);
+}
+
+/************************************ send ************************************/
+void KMSdSpiDriver::send(
+	const uint8_t*	inBuf,
+	size_t			inCount)
+{
+	for (size_t i = 0; i < inCount; i++)
+	{
+		SPI.transfer(inBuf[i]);
+	}
+}
+
+/******************************** setSckSpeed *********************************/
+void KMSdSpiDriver::setSckSpeed(
+	uint32_t	inMaxSck)
+{
+	mSPISettings = SPISettings(inMaxSck, MSBFIRST, SPI_MODE0);
+}
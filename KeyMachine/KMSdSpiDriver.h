@@ -0,0 +1,60 @@
+/*
+*	KMSdSpiDriver.h, Copyright Jonathan Mackey 2023
+*	SdFat SPI driver that uses SPIBus transactions.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMSdSpiDriver_h
+#define KMSdSpiDriver_h
+
+#include "SdFat.h"
+#include "SPIBus.h"
+
+/*
+*	The touch screen is sampled by a timer ISR on the same SPI bus as the
+*	SD card.  SdFat's built in drivers call SPI.beginTransaction directly, so
+*	this driver is used instead.  Every SdFat transaction then masks the
+*	sample ISR from activate to deactivate, chip select included.
+*
+*	Requires SPI_DRIVER_SELECT 3 (see build_opt.h.)  Every SdFat::begin must
+*	pass an SdSpiConfig that references the driver:
+*		sd.begin(SdSpiConfig(csPin, SHARED_SPI, SD_SCK_MHZ(n), &driver))
+*/
+class KMSdSpiDriver : public SdSpiBaseClass
+{
+public:
+	virtual void			activate(void) override;
+	virtual void			begin(
+								SdSpiConfig				inConfig) override;
+	virtual void			deactivate(void) override;
+	virtual uint8_t			receive(void) override;
+	virtual uint8_t			receive(
+								uint8_t*				outBuf,
+								size_t					inCount) override;
+	virtual void			send(
+								uint8_t					inData) override;
+	virtual void			send(
+								const uint8_t*			inBuf,
+								size_t					inCount) override;
+	virtual void			setSckSpeed(
+								uint32_t				inMaxSck) override;
+protected:
+	SPISettings	mSPISettings;
+};
+#endif // KMSdSpiDriver_h
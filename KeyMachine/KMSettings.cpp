@@ -29,12 +29,11 @@
 *
 */
 #include "KMSettings.h"
+#include "KMTextFile.h"
+#include <string.h>
 #ifndef __MACH__
 #include <Arduino.h>
-#include "SdFat.h"
-#include "sdios.h"
 #else
-#include <string>
 #define _BV(bit) (1 << (bit))
 #endif
 #include "UnixTime.h"
@@ -82,7 +81,6 @@ static const uint32_t kNumericKeysMask =
 
 /********************************* KMSettings **********************************/
 KMSettings::KMSettings(void)
-: mFile(nullptr)
 {
 }
 
@@ -98,91 +96,44 @@ bool KMSettings::ReadFile(
 {
 	mSettings = {0};
 	uint8_t	requiredKeyValues = 0;
-#ifndef __MACH__
-	SdFile file;
-	bool	fileOpened = file.open(inPath, O_RDONLY);
-	mFile = &file;
-#else
-	mFile = fopen(inPath, "r+");
-	bool	fileOpened = mFile != nullptr;
-#endif
-	if (fileOpened)
+	KMTextFile	file;
+	if (file.Open(inPath))
 	{
-		char	thisChar = NextChar();
-		while (thisChar)
+		char*	keyStr;
+		char*	valueStr;
+		while (file.NextKeyValue(keyStr, valueStr))
 		{
-			thisChar = SkipWhitespaceAndHashComments(thisChar);
-			if (thisChar)
+			uint8_t keyIndex = FindKeyIndex(keyStr);
+			if (keyIndex)
 			{
-				char keyStr[32];
-				keyStr[0] = thisChar;
-				thisChar = ReadStr('=', 31, &keyStr[1]);
-				while (thisChar)
+				requiredKeyValues++;
+				if (kNumericKeysMask & (_BV(keyIndex)))
 				{
-					uint8_t keyIndex = FindKeyIndex(keyStr);
-					if (keyIndex)
+					uint32_t	value = KMTextFile::ToUInt32(valueStr);
+					switch (keyIndex)
 					{
-						requiredKeyValues++;
-						if (kNumericKeysMask & (_BV(keyIndex)))
-						{
-							uint32_t	value;
-							thisChar = ReadUInt32Number(value);
-							switch (keyIndex)
-							{
-								case eCurrentView:
-									mSettings.currentView = value;
-									break;
-								case eHourFormat24:
-									mSettings.hourFormat = value;
-									break;
-								case eTsXMax:
-									mSettings.tsMinMax[1] = value;
-									break;
-								case eTsXMin:
-									mSettings.tsMinMax[0] = value;
-									break;
-								case eTsYMax:
-									mSettings.tsMinMax[3] = value;
-									break;
-								case eTsYMin:
-									mSettings.tsMinMax[2] = value;
-									break;
-							}
-/*						} else
-						{
-							char valueStr[10];
-							thisChar = ReadStr('\n', sizeof(valueStr), valueStr);
-							bool	isTrue = valueStr[0] == 't';
-							switch (keyIndex)
-							{
-								case eBinMotorEnabled:
-									mSettings.binMotorEnabled = isTrue;
-									break;
-								case eDisplayPressure:
-									mSettings.displayPressure = isTrue;
-									break;
-								case ePressureUnit:
-									mSettings.pressureUnit_hPa = isTrue;
-									break;
-								case eTemperatureUnit:
-									mSettings.temperatureUnitCelsius = isTrue;
-									break;
-							}
-*/						}
-					} else
-					{
-						thisChar = SkipToNextLine();
+						case eCurrentView:
+							mSettings.currentView = value;
+							break;
+						case eHourFormat24:
+							mSettings.hourFormat = value;
+							break;
+						case eTsXMax:
+							mSettings.tsMinMax[1] = value;
+							break;
+						case eTsXMin:
+							mSettings.tsMinMax[0] = value;
+							break;
+						case eTsYMax:
+							mSettings.tsMinMax[3] = value;
+							break;
+						case eTsYMin:
+							mSettings.tsMinMax[2] = value;
+							break;
 					}
-					break;
 				}
 			}
 		}
-	#ifndef __MACH__
-		mFile->close();
-	#else
-		fclose(mFile);
-	#endif
-		mFile = nullptr;
 	}
 	return(requiredKeyValues == eTsYMin);
 }
@@ -193,22 +144,17 @@ bool KMSettings::WriteFile(
 	const SKMSettings&	inSettings)
 {
 #ifndef __MACH__
-	SdFile file;
 	SdFile::dateTimeCallback(UnixTime::SDFatDateTimeCB);
-	bool	fileOpened = file.open(inPath, O_WRONLY | O_TRUNC | O_CREAT);
-	mFile = &file;
-#else
-	mFile = fopen(inPath, "w");
-	bool	fileOpened = mFile != nullptr;
 #endif
-	if (fileOpened)
+	KMTextFile	file;
+	bool	success = file.Open(inPath, true);
+	if (success)
 	{
-		
 		for (uint8_t keyIndex = 1; keyIndex < eKeyCount; keyIndex++)
 		{
 			
-			WriteStr(kSettingsKeys[keyIndex-1]);
-			WriteChar('=');
+			file.Write(kSettingsKeys[keyIndex-1]);
+			file.Write('=');
 			if (kNumericKeysMask & (_BV(keyIndex)))
 			{
 				int32_t	value = 0;
@@ -235,7 +181,7 @@ bool KMSettings::WriteFile(
 				}
 				char valueStr[15];
 				Int32ToString(value, valueStr);
-				WriteStr(valueStr);
+				file.Write(valueStr);
 /*			} else
 			{
 				bool	isTrue = false;;
@@ -254,36 +200,13 @@ bool KMSettings::WriteFile(
 						isTrue = inSettings.temperatureUnitCelsius;
 						break;
 				}
-				WriteStr(isTrue ? "true":"false");
+				file.Write(isTrue ? "true":"false");
 */			}
-			WriteChar('\n');
+			file.Write('\n');
 		}
-	#ifndef __MACH__
-		mFile->close();
-	#else
-		fclose(mFile);
-	#endif
-	}
-	return(fileOpened);
-}
-
-/********************************** NextChar **********************************/
-char KMSettings::NextChar(void)
-{
-	char	thisChar;
-#ifdef __MACH__
-	thisChar = getc(mFile);
-	if (thisChar == -1)
-	{
-		thisChar = 0;
-	}
-#else
-	if (mFile->read(&thisChar,1) != 1)
-	{
-		thisChar = 0;
+		success = file.Close();
 	}
-#endif
-	return(thisChar);
+	return(success);
 }
 
 /******************************** FindKeyIndex ********************************/
@@ -315,63 +238,6 @@ uint8_t KMSettings::FindKeyIndex(
 	return(0);
 }
 
-/******************************* SkipWhitespace *******************************/
-char KMSettings::SkipWhitespace(
-	char	inCurrChar)
-{
-	char	thisChar = inCurrChar;
-	for (; thisChar != 0; thisChar = NextChar())
-	{
-		if (isspace(thisChar))
-		{
-			continue;
-		}
-		break;
-	}
-	return(thisChar);
-}
-
-/*********************** SkipWhitespaceAndHashComments ************************/
-char KMSettings::SkipWhitespaceAndHashComments(
-	char	inCurrChar)
-{
-	char	thisChar = inCurrChar;
-	while (thisChar)
-	{
-		if (isspace(thisChar))
-		{
-			thisChar = NextChar();
-			continue;
-		} else if (thisChar == '#')
-		{
-			thisChar = SkipToNextLine();
-			continue;
-		}
-		break;
-	}
-	return(thisChar);
-}
-
-/******************************* SkipToNextLine *******************************/
-/*
-*	Returns the character following the newline (if any).
-*	Does not support Windows CRLF line endings.
-*/
-char KMSettings::SkipToNextLine(void)
-{
-	char thisChar = NextChar();
-	for (; thisChar; thisChar = NextChar())
-	{
-		if (thisChar != '\n')
-		{
-			continue;
-		}
-		thisChar = NextChar();
-		break;
-	}
-	return(thisChar);
-}
-
 /******************************** Int32ToString *******************************/
 void KMSettings::Int32ToString(
 	int32_t	inValue,
@@ -390,126 +256,3 @@ void KMSettings::Int32ToString(
 		inValue /= 10;
 	} while (inValue);
 }
-
-/****************************** ReadUInt32Number ******************************/
-char KMSettings::ReadUInt32Number(
-	uint32_t&	outValue)
-{
-	bool		bitwiseNot = false;
-	bool 		isHex = false;
-	uint32_t	value = 0;
-	char		thisChar = SkipWhitespaceAndHashComments(NextChar());
-	if (thisChar)
-	{
-		bitwiseNot = thisChar == '~';
-		/*
-		*	If notted THEN
-		*	get the next char after the not.
-		*/
-		if (bitwiseNot)
-		{
-			thisChar = SkipWhitespaceAndHashComments(NextChar());
-		}
-		if (thisChar == '0')
-		{
-			thisChar = NextChar();	// Get the character following the leading zero.
-			isHex = thisChar == 'x';
-			/*
-			*	If this is a hex prefix THEN
-			*	get the character following it.
-			*/
-			if (isHex)
-			{
-				thisChar = NextChar();
-			}
-		}
-		// Now just consume characters till a non valid numeric char is hit.
-		if (isHex)
-		{
-			for (; isxdigit(thisChar); thisChar = NextChar())
-			{
-				thisChar -= '0';
-				if (thisChar > 9)
-				{
-					thisChar -= 7;
-					if (thisChar > 15)
-					{
-						thisChar -= 32;
-					}
-				}
-				value = (value << 4) + thisChar;
-			}
-		} else
-		{
-			for (; isdigit(thisChar); thisChar = NextChar())
-			{
-				value = (value * 10) + (thisChar - '0');
-			}
-		}
-		thisChar = SkipWhitespaceAndHashComments(thisChar);
-	}
-	if (bitwiseNot)
-	{
-		value = ~value;
-	}
-	outValue = value;
-	return(thisChar);
-}
-
-/********************************** ReadStr ***********************************/
-/*
-*	Reads the string till the delimiter is hit.
-*	Once the string is full (inMaxStrLen), characters are ignored till the
-*	delimiter is hit.
-*	Hash (#) comments are not allowed because the strings aren't quoted.
-*/
-char KMSettings::ReadStr(
-	char	inDelimiter,
-	uint8_t	inMaxStrLen,
-	char*	outStr)
-{
-	char		thisChar;
-	char*		endOfStrPtr = &outStr[inMaxStrLen -1];
-
-	while((thisChar = NextChar()) != 0)
-	{
-		if (thisChar != inDelimiter)
-		{
-			/*
-			*	If outStr isn't full THEN
-			*	append thisChar to it.
-			*/
-			if (outStr < endOfStrPtr)
-			{
-				*(outStr++) = thisChar;
-			} // else discard the character, the outStr is full
-			continue;
-		}
-		break;
-	}
-	*outStr = 0;	// Terminate the string
-	return(thisChar);
-}
-
-/********************************** WriteStr **********************************/
-void KMSettings::WriteStr(
-	const char*	inStr)
-{
-#ifdef __MACH__
-	fwrite(inStr, strlen(inStr), 1, mFile);
-#else
-	mFile->write(inStr ,strlen(inStr));
-#endif
-}
-
-/********************************** WriteChar *********************************/
-void KMSettings::WriteChar(
-	char	inChar)
-{
-#ifdef __MACH__
-	putc(inChar, mFile);
-#else
-	mFile->write(&inChar ,1);
-#endif
-}
-
@@ -26,13 +26,6 @@
 
 #include <inttypes.h>
 
-#ifdef __MACH__
-#include <stdio.h>
-#define SdFile	FILE
-#else
-class SdFile;
-#endif
-
 struct SKMSettings
 {
 	uint8_t		hourFormat;
@@ -52,30 +45,13 @@ public:
 	const SKMSettings&		Settings(void) const
 								{return(mSettings);}
 protected:
-	SdFile*		mFile;
 	SKMSettings	mSettings;
 	
-	char					NextChar(void);
 	uint8_t					FindKeyIndex(
 								const char*				inKey);
-	char					SkipWhitespace(
-								char					inCurrChar);
-	char					SkipWhitespaceAndHashComments(
-								char					inCurrChar);
-	char					SkipToNextLine(void);
 	void					Int32ToString(
 								int32_t					inValue,
 								char*					outString);
-	char					ReadUInt32Number(
-								uint32_t&				outValue);
-	char					ReadStr(
-								char					inDelimiter,
-								uint8_t					inMaxStrLen,
-								char*					outStr);
-	void					WriteStr(
-								const char*				inStr);
-	void					WriteChar(
-								char					inChar);
 };
 
 #endif /* KMSettings_h */
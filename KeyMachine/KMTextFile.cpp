@@ -0,0 +1,298 @@
+/*
+*	KMTextFile.cpp, Copyright Jonathan Mackey 2023
+*	Sector buffered reader/writer of key = value text files.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KMTextFile.h"
+#include <ctype.h>
+#include <string.h>
+
+#ifdef __MACH__
+uint32_t	KMTextFile::sFileReads;
+uint32_t	KMTextFile::sFileWrites;
+#endif
+
+/********************************* KMTextFile *********************************/
+KMTextFile::KMTextFile(void)
+	: mNext(mBuffer), mEnd(mBuffer), mIsOpen(false), mWriting(false),
+	  mAtEOF(false), mWriteFailed(false)
+{
+#ifdef __MACH__
+	mFile = nullptr;
+#endif
+}
+
+/******************************** ~KMTextFile *********************************/
+KMTextFile::~KMTextFile(void)
+{
+	Close();
+}
+
+/************************************ Open ************************************/
+bool KMTextFile::Open(
+	const char*	inPath,
+	bool		inWrite)
+{
+	Close();
+#ifdef __MACH__
+	mFile = fopen(inPath, inWrite ? "wb" : "rb");
+	mIsOpen = mFile != nullptr;
+#else
+	mIsOpen = mFile.open(inPath, inWrite ? (O_WRONLY | O_TRUNC | O_CREAT) : O_RDONLY);
+#endif
+	mWriting = inWrite;
+	mAtEOF = false;
+	mWriteFailed = false;
+	mNext = mEnd = mBuffer;
+	return(mIsOpen);
+}
+
+/*********************************** Close ************************************/
+bool KMTextFile::Close(void)
+{
+	bool	success = true;
+	if (mIsOpen)
+	{
+		if (mWriting)
+		{
+			Flush();
+			success = !mWriteFailed;
+		}
+	#ifdef __MACH__
+		fclose(mFile);
+		mFile = nullptr;
+	#else
+		mFile.close();
+	#endif
+		mIsOpen = false;
+	}
+	return(success);
+}
+
+/************************************ Fill ************************************/
+/*
+*	Moves the unread data to the start of the buffer and fills the rest of the
+*	buffer from the file.  Returns false if nothing was read.
+*/
+bool KMTextFile::Fill(void)
+{
+	uint16_t	unread = mEnd - mNext;
+	if (unread &&
+		mNext != mBuffer)
+	{
+		memmove(mBuffer, mNext, unread);
+	}
+	mNext = mBuffer;
+	mEnd = &mBuffer[unread];
+	int32_t	bytesRead = 0;
+	if (!mAtEOF &&
+		unread < kBufferSize)
+	{
+	#ifdef __MACH__
+		bytesRead = fread(mEnd, 1, kBufferSize - unread, mFile);
+		sFileReads++;
+	#else
+		bytesRead = mFile.read(mEnd, kBufferSize - unread);
+	#endif
+		if (bytesRead > 0)
+		{
+			mEnd += bytesRead;
+		} else
+		{
+			bytesRead = 0;
+			mAtEOF = true;
+		}
+	}
+	return(bytesRead != 0);
+}
+
+/******************************** NextKeyValue ********************************/
+/*
+*	Returns false when there are no more key values.
+*/
+bool KMTextFile::NextKeyValue(
+	char*&	outKey,
+	char*&	outValue)
+{
+	bool	skipLine = false;	// Skipping the rest of a line that's too long
+	while (mIsOpen &&
+		!mWriting)
+	{
+		char*	lineEnd = (char*)memchr(mNext, '\n', mEnd - mNext);
+		/*
+		*	If the rest of the line isn't in the buffer THEN
+		*	read more of the file.
+		*/
+		if (!lineEnd)
+		{
+			if (Fill())
+			{
+				continue;
+			}
+			/*
+			*	If the buffer is full THEN
+			*	the line is too long, skip it.
+			*/
+			if (mNext == mBuffer &&
+				mEnd == &mBuffer[kBufferSize])
+			{
+				mNext = mEnd;
+				skipLine = true;
+				continue;
+			}
+			// Else it's the last line of the file (no newline)
+			if (mNext == mEnd)
+			{
+				break;
+			}
+			lineEnd = mEnd;
+		}
+		char*	line = mNext;
+		mNext = lineEnd < mEnd ? lineEnd + 1 : mEnd;
+		if (skipLine)
+		{
+			skipLine = false;
+			continue;
+		}
+		*lineEnd = 0;
+		line = Trim(line, lineEnd);
+		if (*line == 0 ||
+			*line == '#')
+		{
+			continue;
+		}
+		char*	equals = strchr(line, '=');
+		if (!equals)
+		{
+			continue;
+		}
+		*equals = 0;
+		outKey = Trim(line, equals);
+		outValue = Trim(equals + 1, lineEnd);
+		return(true);
+	}
+	return(false);
+}
+
+/************************************ Trim ************************************/
+/*
+*	Strips the leading and trailing whitespace of the string from inStart to
+*	inEnd.  Returns the start of the null terminated string.
+*/
+char* KMTextFile::Trim(
+	char*	inStart,
+	char*	inEnd)
+{
+	while (inStart < inEnd && isspace(*inStart))
+	{
+		inStart++;
+	}
+	while (inEnd > inStart && isspace(inEnd[-1]))
+	{
+		inEnd--;
+	}
+	*inEnd = 0;
+	return(inStart);
+}
+
+/*********************************** Write ************************************/
+void KMTextFile::Write(
+	const char*	inString)
+{
+	while (*inString)
+	{
+		Write(*(inString++));
+	}
+}
+
+/*********************************** Write ************************************/
+void KMTextFile::Write(
+	char	inChar)
+{
+	if (mEnd == &mBuffer[kBufferSize])
+	{
+		Flush();
+	}
+	*(mEnd++) = inChar;
+}
+
+/*********************************** Flush ************************************/
+void KMTextFile::Flush(void)
+{
+	size_t	length = mEnd - mBuffer;
+	if (length)
+	{
+	#ifdef __MACH__
+		size_t	bytesWritten = fwrite(mBuffer, 1, length, mFile);
+		sFileWrites++;
+	#else
+		size_t	bytesWritten = mFile.write(mBuffer, length);
+	#endif
+		if (bytesWritten != length)
+		{
+			mWriteFailed = true;
+		}
+		mEnd = mBuffer;
+	}
+}
+
+/********************************** ToUInt32 **********************************/
+uint32_t KMTextFile::ToUInt32(
+	const char*	inString)
+{
+	bool		bitwiseNot = *inString == '~';
+	uint32_t	value = 0;
+	if (bitwiseNot)
+	{
+		inString++;
+		while (isspace(*inString))
+		{
+			inString++;
+		}
+	}
+	if (inString[0] == '0' &&
+		inString[1] == 'x')
+	{
+		for (inString += 2; isxdigit(*inString); inString++)
+		{
+			char	thisChar = *inString - '0';
+			if (thisChar > 9)
+			{
+				thisChar -= 7;
+				if (thisChar > 15)
+				{
+					thisChar -= 32;
+				}
+			}
+			value = (value << 4) + thisChar;
+		}
+	} else
+	{
+		for (; isdigit(*inString); inString++)
+		{
+			value = (value * 10) + (*inString - '0');
+		}
+	}
+	if (bitwiseNot)
+	{
+		value = ~value;
+	}
+	return(value);
+}
@@ -0,0 +1,110 @@
+/*
+*	KMTextFile.h, Copyright Jonathan Mackey 2023
+*	Sector buffered reader/writer of key = value text files.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KMTextFile_h
+#define KMTextFile_h
+
+#include <inttypes.h>
+#ifdef __MACH__
+#include <stdio.h>
+#else
+#include "SdFat.h"
+#endif
+
+/*
+*	KMTextFile reads and writes the text files used by KeySpec and
+*	KMSettings a sector at a time rather than a character at a time.
+*
+*	NextKeyValue is a zero copy tokenizer.  The key and value are returned as
+*	pointers into the buffer.  Each is null terminated in place with its
+*	leading and trailing whitespace stripped, so they can be passed directly
+*	to strcmp, strtof, etc.  They're valid until the next call.
+*
+*	File format:
+*		# Comment line
+*		key = value
+*	Blank lines, comment lines, and lines without an = are skipped.  Lines
+*	longer than the buffer are skipped.  Both LF and CRLF line endings are
+*	supported.  A # following a value isn't removed from the value, numeric
+*	values simply stop at the #.
+*
+*	It's assumed SdFat.begin was successfully called prior to calling Open.
+*/
+class KMTextFile
+{
+public:
+							KMTextFile(void);
+							~KMTextFile(void);
+	bool					Open(
+								const char*				inPath,
+								bool					inWrite = false);
+	/*
+	*	Close: Writes any buffered data.  Returns false if any write failed.
+	*/
+	bool					Close(void);
+	bool					NextKeyValue(
+								char*&					outKey,
+								char*&					outValue);
+	void					Write(
+								const char*				inString);
+	void					Write(
+								char					inChar);
+	/*
+	*	ToUInt32: Decimal or hex (0x prefix) optionally preceded by ~ (bitwise
+	*	not.)  Conversion stops at the first character that isn't a digit.
+	*/
+	static uint32_t			ToUInt32(
+								const char*				inString);
+#ifdef __MACH__
+	// The number of file reads and writes (for benchmarking)
+	static uint32_t			FileReads(void)
+								{return(sFileReads);}
+	static uint32_t			FileWrites(void)
+								{return(sFileWrites);}
+	static void				ResetStats(void)
+								{sFileReads = 0; sFileWrites = 0;}
+#endif
+protected:
+	static const uint16_t	kBufferSize = 512;	// One sector
+#ifdef __MACH__
+	FILE*		mFile;
+	static uint32_t	sFileReads;
+	static uint32_t	sFileWrites;
+#else
+	SdFile		mFile;
+#endif
+	char*		mNext;
+	char*		mEnd;
+	bool		mIsOpen;
+	bool		mWriting;
+	bool		mAtEOF;
+	bool		mWriteFailed;
+	char		mBuffer[kBufferSize+1];	// +1 to terminate the last line
+
+	bool					Fill(void);
+	void					Flush(void);
+	static char*			Trim(
+								char*					inStart,
+								char*					inEnd);
+};
+
+#endif // KMTextFile_h
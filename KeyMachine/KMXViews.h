@@ -40,6 +40,7 @@
 #include "XRootView.h"
 #include "XStepper.h"
 #include "KMPinsValueField.h"
+#include "KMKeywaySearchField.h"
 
 static const char kVerticalEllipsisStr[] = ".";
 static const char kOKStr[] = "OK";
@@ -70,6 +71,12 @@ static const char kKeyHolderOriginUndefinedStr[] = "Key holder origin not define
 										"Use Setup Origin to define.";
 static const char kUnableToReadPrefsStr[] = "Unable to read preferences";
 
+// Pre-rendered static layers of the dialogs on the SD card.
+// See HostTools/KMDialogLayers.
+static const char kSetupZeroLayerPath[] = "KMSetupZeroDialog.bin";
+static const char kAdjustOriginLayerPath[] = "KMAdjustOriginDialog.bin";
+static const char kCutKeyLayerPath[] = "KMCutKeyDialog.bin";
+
 // Setup Key Holder Zero dialog (also used by adjust origin dialog)
 static const char kIncrementStr[] = "Increment:";
 static const char kUpStr[] = "Up";
@@ -93,6 +100,7 @@ static const char kBowStr[] = "bow";
 static const char kTipStr[] = "tip";
 static const char kPinDepthStr[] = "Pin Depth:";
 static const char kMMStr[] = "mm";
+static const char kFindStr[] = "Find:";
 static const char kCutStr[] = "Cut";
 static const char kResetStr[] = "Reset";
 static const char kDepthErrMessageStr[] = "Cut too deep.";		// Should never happen
@@ -188,6 +196,9 @@ static const uint16_t	kPinDepthValueFieldTag = 1411;
 static const uint16_t	kPinValueStepperTag = 1412;
 static const uint16_t	kMMLabelTag = 1413;
 static const uint16_t	kResetBtnTag = 1414;
+static const uint16_t	kKeywaySearchLabelTag = 1415;
+static const uint16_t	kKeywaySearchFieldTag = 1416;
+static const uint16_t	kKeywaySearchStepperTag = 1417;
 
 static const uint16_t	kAdjustOriginDialogTag = 1500;
 static const uint16_t	kAdjustOrginInstLabelTag = 1501;
@@ -258,7 +269,7 @@ XMenuButton mainMenuBtn(480-30, 0, 27, 0,
 				kVerticalEllipsisStr, &UI20ptFont);
 
 XAnimatedFontIcon kmStatusIcon(480-32-2, 320-32-2, 32, 32,
-				kKMStatusIconTag, &mainMenuBtn, 'A', 'B', &KM_Icons::font);
+				kKMStatusIconTag, &mainMenuBtn, 'A', 'B', &UIIconsFont);
 
 
 //	Increment menu used in setup zero dialog
@@ -371,6 +382,10 @@ XDialogBox	setupKeyHolderOriginDialog(&incrementPopUp,
 				kSetStr, kCancelStr, kSetupZeroStr,
 				&UI20ptFont,
 				nullptr, kDialogBGColor);
+// The views drawn over the static layer, see XDialogBox::SetStaticLayer
+XView* const	setupKeyHolderOriginDynamicViews[] = {&currentXValueField,
+				&currentZValueField, &zeroXOffsetValueField,
+				&zeroZOffsetValueField, &incrementPopUp, nullptr};
 
 // Adjust origin dialog
 XLabel		adjustOrginInstLabel(0, 0, 170, 52,
@@ -413,6 +428,8 @@ XDialogBox	adjustOriginDialog(&deltaMMLabel,
 				kSetStr, kCancelStr, kAdjustOriginStr,
 				&UI20ptFont,
 				nullptr, kDialogBGColor);
+XView* const	adjustOriginDynamicViews[] = {&deltaXValueField,
+				&deltaZValueField, nullptr};
 
 //	Pin count menu used in cut key dialog
 static const char k6PinStr[] = "6 Pin";
@@ -482,8 +499,17 @@ XLabel		mmLabel(159, kLabelYAdj + (kRowHeight*2), 34, 26,
 				kMMLabelTag, &pinValueStepper, kMMStr,
 				&UI20ptFont, nullptr,
 				XFont::eBlack, kDialogBGColor, XFont::eAlignRight);
+XLabel		keywaySearchLabel(193+kSpaceBetween, kLabelYAdj + (kRowHeight*2), 45, 26,
+				kKeywaySearchLabelTag, &mmLabel, kFindStr,
+				&UI20ptFont, nullptr,
+				XFont::eBlack, kDialogBGColor, XFont::eAlignRight);
+KMKeywaySearchField keywaySearchField(0, 0, 0,
+				kKeywaySearchFieldTag, &keywaySearchLabel,
+				&UI20ptFont, XFont::eBlack, kDialogBGColor);
+XStepper	keywaySearchStepper(342, kRowHeight*2, 0, 0,
+				kKeywaySearchStepperTag, &keywaySearchField);
 XPushButton resetBtn(0, (kRowHeight*2), 80, 0,
-				kResetBtnTag, &mmLabel, kResetStr,
+				kResetBtnTag, &keywaySearchStepper, kResetStr,
 				&UI20ptFont,
 				XFont::eWhite, kDialogBGColor);
 
@@ -492,6 +518,8 @@ XDialogBox	cutKeyDialog(&resetBtn,
 				kCutStr, kCancelStr, kCutKeyStr,
 				&UI20ptFont,
 				nullptr, kDialogBGColor);
+XView* const	cutKeyDynamicViews[] = {&keywayPopUp, &pinCountPopUp,
+				&pinsValueField, &pinDepthValueField, &keywaySearchField, nullptr};
 
 // Utilities dialog
 XLabel		motorSpeedLabel(0, kLabelYAdj, 172, 26,
@@ -0,0 +1,123 @@
+// Converted to 4 bit by XFont4BitConverter from KM_Icons.h
+// Subset font representing icons used in the project.
+// The icons correspond to characters starting with the glyph 'A'.
+// A = first icon, B = second, etc.
+
+#ifndef KM_Icons_4b_h
+#define KM_Icons_4b_h
+
+#include "XFontGlyph.h"
+#include "XFont4BitDataStream.h"
+
+namespace KM_Icons_4b
+{
+	const FontHeader	fontHeader PROGMEM =
+	{
+		1,		// version, currently version = 1
+		0,		// oneBit, 1 = 1 bit per pixel, 0 = 8 bit (antialiased)
+		0,		// rotated, glyph data is rotated (applies to 1 bit only)
+		0,		// wideOffsets, 1 = 32 bit, 0 = 16 bit glyph data offsets
+		0,		// monospaced, fixed width font (for this subset)
+		32,		// ascent, font in pixels
+		0,		// descent, font in pixels
+		32,		// height, font height (ascent+descent+leading) in pixels
+		32,		// width, widest glyph advanceX within subset in pixels
+		2,		// numCharcodeRuns
+		2		// numCharCodes
+	};
+	
+	// 'A' = Saw 0
+	// 'B' = Saw 90
+	const CharcodeRun	charcodeRun[] PROGMEM = // {start, entryIndex}, ...
+	{
+		{0x0041, 0}, {0xFFFF, 2}
+	};
+	
+	const uint16_t	glyphDataOffset[] PROGMEM =
+	{
+		0x0000, 0x0166, 0x02CC
+	};
+
+	const uint8_t	glyphData[] PROGMEM =
+	{
+		0x20, 0x00, 0x00, 0x20, 0x20, 0x06, 0x10, 0x21, 0x10, 0x02, 0xB6, 0x00,
+		0x10, 0x41, 0x0D, 0x1E, 0x01, 0x41, 0x01, 0x5F, 0x18, 0x01, 0x12, 0x45,
+		0xE0, 0x1E, 0xC1, 0x8F, 0x03, 0x00, 0x6F, 0x0D, 0xF0, 0x73, 0x7C, 0xF2,
+		0x4E, 0x91, 0x11, 0x10, 0x03, 0xF1, 0x75, 0xF0, 0xDF, 0x5D, 0xF0, 0x80,
+		0x31, 0x10, 0x41, 0x01, 0xE0, 0x8F, 0x0D, 0xF1, 0xDF, 0x3D, 0xDE, 0x17,
+		0x32, 0x10, 0x21, 0x02, 0x10, 0x02, 0x20, 0x02, 0xF0, 0xDF, 0x0D, 0xDF,
+		0xC1, 0xD8, 0x51, 0x00, 0x1E, 0x28, 0xF0, 0x25, 0xE1, 0xFB, 0x1D, 0xDD,
+		0xF2, 0x8E, 0x20, 0x01, 0xAF, 0x1C, 0xF9, 0x2D, 0xF0, 0x82, 0xE1, 0x1E,
+		0x0B, 0xFE, 0x22, 0x00, 0x1E, 0x3A, 0xF0, 0xDF, 0x6D, 0xDD, 0xDD, 0xDF,
+		0x81, 0x50, 0x11, 0x01, 0x19, 0xE6, 0xDF, 0x5D, 0xF8, 0x18, 0x10, 0x01,
+		0x20, 0x07, 0xE5, 0xDF, 0x0A, 0x43, 0x34, 0xAF, 0x0D, 0xF6, 0xDF, 0x09,
+		0x17, 0xF0, 0x8A, 0xF5, 0xDF, 0x07, 0x10, 0x31, 0x7F, 0x0D, 0xF8, 0x17,
+		0x5F, 0x7D, 0xF0, 0xA1, 0x00, 0x49, 0x94, 0x00, 0x1A, 0xF0, 0xDF, 0x57,
+		0x62, 0x1D, 0xDE, 0x64, 0x00, 0x4F, 0x34, 0x00, 0x4E, 0x4D, 0xF0, 0x30,
+		0x26, 0xF0, 0xDE, 0x52, 0x00, 0x9F, 0x0D, 0xDF, 0x09, 0x00, 0x2E, 0x4F,
+		0x1D, 0x10, 0x11, 0xDF, 0x5E, 0x92, 0xDF, 0x06, 0x02, 0x3F, 0x0D, 0xE4,
+		0x40, 0x05, 0xF3, 0x50, 0x04, 0xE5, 0xF0, 0xDD, 0x12, 0x67, 0xF5, 0xE0,
+		0xA1, 0x00, 0x49, 0x94, 0x00, 0x1A, 0xE6, 0xF1, 0x57, 0xF8, 0x1D, 0xF0,
+		0x71, 0x03, 0x17, 0xF0, 0xDF, 0x5A, 0x8F, 0x07, 0x19, 0xF0, 0xDF, 0x6D,
+		0xF0, 0xA4, 0x22, 0x4A, 0xF0, 0xDF, 0x4D, 0xF0, 0x70, 0x02, 0x10, 0x01,
+		0x7F, 0x81, 0xDF, 0x5D, 0xF5, 0xE0, 0x91, 0x01, 0x10, 0x15, 0xF8, 0x1D,
+		0xDD, 0xDD, 0xDF, 0x6E, 0x0A, 0xE0, 0x10, 0x01, 0x10, 0x02, 0xFE, 0x2B,
+		0xE3, 0x00, 0x28, 0xF0, 0xDF, 0x92, 0xCF, 0x1A, 0xE0, 0x01, 0xE0, 0x8F,
+		0x2D, 0xDD, 0xFC, 0x1D, 0xF0, 0x52, 0xF0, 0x80, 0x01, 0xE2, 0x15, 0x8D,
+		0xFC, 0x1D, 0xDE, 0x12, 0x00, 0x21, 0xE2, 0x00, 0x10, 0x21, 0x23, 0x7F,
+		0x0D, 0xF0, 0xDD, 0xF3, 0xDF, 0x1D, 0xF0, 0x80, 0x01, 0x01, 0x10, 0x41,
+		0x10, 0x38, 0xE1, 0xF4, 0xDF, 0x05, 0x7F, 0x13, 0xE0, 0x11, 0x08, 0x11,
+		0x00, 0x4F, 0x2C, 0x73, 0x7F, 0x0D, 0xF0, 0x60, 0x03, 0xF0, 0x80, 0x01,
+		0x0B, 0x1E, 0x01, 0x54, 0x21, 0x01, 0x8F, 0x15, 0x01, 0x14, 0x1E, 0xC1,
+		0x00, 0x10, 0x41, 0x00, 0x6B, 0x20, 0x01, 0x10, 0x21, 0x05, 0x20, 0x00,
+		0x00, 0x20, 0x20, 0x08, 0x11, 0x00, 0x17, 0x20, 0x21, 0x57, 0x10, 0x01,
+		0x10, 0xD1, 0x11, 0x1E, 0x19, 0xF0, 0x60, 0x01, 0x6D, 0xF1, 0x20, 0x31,
+		0x10, 0x81, 0x10, 0x2E, 0x08, 0xF1, 0x73, 0xDF, 0x0E, 0x08, 0x00, 0x11,
+		0x11, 0x01, 0x10, 0x61, 0x00, 0x18, 0x20, 0x05, 0xF0, 0xDF, 0x3D, 0xF1,
+		0xA7, 0x9A, 0xBA, 0x81, 0x00, 0x1E, 0x65, 0xF0, 0x82, 0xF4, 0xDF, 0xA1,
+		0x2E, 0x60, 0x18, 0xFD, 0x1D, 0xDD, 0xF1, 0x20, 0x01, 0xE3, 0x11, 0x00,
+		0x1D, 0xF0, 0xDF, 0xF1, 0xC5, 0x20, 0x11, 0x10, 0x01, 0x02, 0x2F, 0x0D,
+		0xFB, 0x28, 0x30, 0x11, 0x00, 0x14, 0x00, 0x3E, 0xA2, 0xDD, 0xF1, 0x81,
+		0x01, 0x5F, 0x08, 0x7E, 0x6D, 0xDD, 0xDD, 0xDF, 0x7D, 0xF1, 0x40, 0x14,
+		0xF9, 0x1D, 0xF5, 0xDF, 0x5D, 0xF0, 0x73, 0x10, 0x12, 0xF0, 0xDD, 0xF5,
+		0xDF, 0x0A, 0x42, 0x24, 0xAF, 0x0D, 0xE5, 0x50, 0x11, 0x00, 0x1C, 0xF6,
+		0xDF, 0x07, 0x10, 0x31, 0x7F, 0x0D, 0xF4, 0xDF, 0x06, 0xE0, 0x10, 0x07,
+		0xF0, 0xDF, 0x3D, 0xF0, 0xA1, 0x00, 0x49, 0x95, 0x00, 0x1A, 0xF0, 0xDF,
+		0x4D, 0xF0, 0x50, 0x23, 0xE6, 0x40, 0x04, 0xF3, 0x40, 0x04, 0xE5, 0xF0,
+		0xDF, 0x02, 0x68, 0x7F, 0x5E, 0x03, 0x00, 0x9F, 0x0D, 0xDF, 0x09, 0x00,
+		0x2E, 0x6F, 0x1B, 0xBF, 0x7E, 0xA2, 0x78, 0x62, 0xF0, 0xDE, 0x64, 0x00,
+		0x4F, 0x34, 0x00, 0x4E, 0x4D, 0xF0, 0x30, 0x25, 0xF0, 0xDE, 0x5A, 0x10,
+		0x04, 0x99, 0x50, 0x01, 0xAE, 0x67, 0x00, 0x11, 0x00, 0x6F, 0x0D, 0xF4,
+		0xDF, 0x07, 0x10, 0x31, 0x7F, 0x0D, 0xF6, 0xC1, 0x00, 0xE0, 0x00, 0x5F,
+		0x0D, 0xF4, 0xDF, 0x0A, 0x42, 0x24, 0xAF, 0x0D, 0xF5, 0xDD, 0xF0, 0x20,
+		0x11, 0x37, 0xE5, 0xF0, 0xDF, 0x5D, 0xF9, 0x14, 0x01, 0x4F, 0x1D, 0xF7,
+		0xDD, 0xDD, 0xDD, 0xF5, 0xDF, 0x07, 0x8F, 0x05, 0x01, 0x18, 0xF1, 0xDD,
+		0xF9, 0x2E, 0x03, 0x00, 0x41, 0x00, 0x10, 0x13, 0x8F, 0xB2, 0xE0, 0x20,
+		0x21, 0x00, 0x11, 0x01, 0x25, 0xCF, 0xF1, 0xDF, 0x0D, 0x10, 0x01, 0x10,
+		0x31, 0x10, 0x02, 0xF1, 0xDD, 0xDF, 0xD1, 0x80, 0x71, 0x00, 0x2F, 0xA1,
+		0xDF, 0x42, 0x8F, 0x05, 0x00, 0x1E, 0x78, 0xAB, 0xA9, 0x7A, 0xF1, 0xDF,
+		0x3D, 0xF0, 0x50, 0x02, 0x81, 0xE6, 0x00, 0x10, 0x11, 0x11, 0x10, 0x08,
+		0xF0, 0xDF, 0x0D, 0x37, 0xF1, 0x70, 0x01, 0x02, 0x10, 0x81, 0x11, 0x03,
+		0x2F, 0x1D, 0x61, 0x00, 0x6F, 0x09, 0x1E, 0x01, 0x11, 0x0C, 0x11, 0x10,
+		0x01, 0x75, 0x10, 0x22, 0x71, 0x00, 0x10, 0x70
+	};
+	
+	// Usage: Copy the 3 commented lines to your code, removing the comments.
+	//#include "XFont.h"
+	//XFont xFont;
+	//#include "KM_Icons_4b.h"
+	
+	// Leave the next 3 lines here, as is.
+	DataStream_P	dataStream(glyphData, sizeof(glyphData));
+	XFont4BitDataStream xFontDataStream(&xFont, &dataStream);
+	XFont::Font font(&fontHeader, charcodeRun, glyphDataOffset, &xFontDataStream);
+	
+	// The display needs to be set before using xFont.  This only needs
+	// to be done once at the beginning of the program.
+	// Use xFont.SetDisplay(&display, &KM_Icons_4b::font); to do this.
+	// To change to this font anywhere after setting the display,
+	// use: xFont.SetFont(&KM_Icons_4b::font);
+}
+
+#endif // KM_Icons_4b_h
+
@@ -23,6 +23,7 @@
 #include <Wire.h>
 
 #include "KeyMachineSTM32.h"
+#include "DMALog.h"
 
 KeyMachineSTM32	keyMachine;
 /*
@@ -45,13 +46,18 @@ KeyMachineSTM32	keyMachine;
 void setup(void)
 {
 	Serial.begin(BAUD_RATE);
-	Serial.printf("Starting...\n");
+	// From here on all output goes through dmaLog.  See DMALog.h
+	dmaLog.begin();
+	LOG_INFO("Starting...\n");
 
 	SPI.begin();
 	
 	// Note that in order for the correct override of STM32's version of
 	// Wire.begin to be called, SDAPin and SCLPin must be defined as uint32_t
 	Wire.begin(Config::kSDAPin, Config::kSCLPin);	// Using SDA2/SCL2
+	// Both the AT24C64 and the MCP4531 support 400KHz.  This shortens each
+	// transaction done by KeyMachineSTM32's I2CQueue.
+	Wire.setClock(400000);
 	keyMachine.begin();
 }
 
@@ -22,6 +22,7 @@
 #include <Arduino.h>
 #include "KeyMachineSTM32.h"
 #include "SdFat.h"
+#include "DMALog.h"
 #include <Wire.h>
 
 XFont	xFont;
@@ -32,39 +33,65 @@ XFont	xFont;
 #include "MyriadPro-Regular_20_1b.h"
 #define UI64ptFont	Avenir_64_1b::font
 #include "Avenir_64_1b.h"
-#else
+#elif 0
 // 8-bit fonts (antialiased)
 #define UI20ptFont	MyriadPro_Regular_20::font
 #include "MyriadPro-Regular_20.h"
 #define UI64ptFont	Avenir_64::font
 #include "Avenir_64.h"
+#else
+// 4-bit fonts (antialiased) save about 9.5KB over 8-bit (MyriadPro 5.2KB +
+// Avenir 4.1KB).  See XFont4BitDataStream.h
+#define UI20ptFont	MyriadPro_Regular_20_4b::font
+#include "MyriadPro-Regular_20_4b.h"
+#define UI64ptFont	Avenir_64_4b::font
+#include "Avenir_64_4b.h"
 #endif
-#include "KM_Icons.h"
+// 4-bit icons save about 1KB over 8-bit.
+#define UIIconsFont	KM_Icons_4b::font
+#include "KM_Icons_4b.h"
 #include "KMSettings.h"
 #include "KMXViews.h"
 
 static const char kKMSettingsPath[] = "KMSettings.txt";
+static const char kKeySpecCatalogPath[] = "KMKeySpecs.bin";
 /*
-*	The SKeySpecs are hardcoded.  The KeySpec can load a SKeySpec from a text
-*	file on SD.  This code has been debugged.  If SKeySpecs are loaded
-*	dynamically changes would have to be made to create XMenuItems dynamically.
-*	In addition, support for scrolling would have to be added to XMenu.
+*	The Schlage and Kwikset SKeySpecs are hardcoded.  Any other SKeySpecs are
+*	read from the KeySpecCatalog (kKeySpecCatalogPath) on SD by tag.  The
+*	catalog is compiled from KeySpec text files by HostTools/KMKeySpecCatalog.
+*	The keyway menu is virtual.  It lists kBuiltInKeywayItems followed by the
+*	catalog's name index, filtered by the prefix entered in the Cut Key
+*	dialog's keywaySearchField.  See KMKeywayList.
 */
 SKeySpec	schlageKeySpec = {"Schlage", 0.83909963117, 0.015, 0.200, 0.343, 0.031, 0.1562, 0.231, 7, 0, 9, false, true, kSchlageSC1MenuItem, SKeySpec::e6PinMask | SKeySpec::e5PinMask};
 SKeySpec	kwiksetKeySpec = {"Kwikset", 1, 0.023, 0.191, 0.335, 0.084, 0.150, 0.247, 4, 1, 7, false, true, kKwiksetKW1MenuItem, SKeySpec::e6PinMask | SKeySpec::e5PinMask};
+static XMenuItem* const	kBuiltInKeywayItems[] = {&schlageMenuItem, &kwikseteMenuItem};
+static const uint16_t	kBuiltInKeywayCount = sizeof(kBuiltInKeywayItems)/sizeof(XMenuItem*);
 
 /***************************** KeyMachineSTM32 *****************************/
 KeyMachineSTM32::KeyMachineSTM32(void)
   : mDisplay(Config::kDispDCPin, Config::kDispResetPin,
 						Config::kDispCSPin, Config::kBacklightPin),
-	mPreferences(Config::kAT24CDeviceAddr, Config::kAT24CDeviceCapacity),
+	mStrip(mStripBuffer, Config::kStripBufferPixels),
+	mGlyphCache(mGlyphCacheBuffer, Config::kGlyphCachePixels),
+	mDialogLayer(mDialogLayerBuffer, Config::kDialogLayerBufferSize, 1),
+	mCatalogStream(mCatalogBuffer, Config::kKeySpecCatalogBufferSize, 2),
+	mCatalog(&mCatalogStream),
+	mKeywayList(&mCatalog, kBuiltInKeywayItems, kBuiltInKeywayCount),
+	mSDBegun(false),
+	mEEPROM(&mI2CQueue, Config::kAT24CDeviceAddr, Config::kAT24CDeviceCapacity),
+	mPreferences(&mEEPROM, mPreferencesBuffer, Config::kPreferencesMirrorSize),
+	mCutJournal(&mEEPROM, Config::kCutJournalAddr, Config::kCutJournalLength,
+						sizeof(Config::SCutRecord)),
+	mCutInProgress(false),
+	mRemote(this),
     mTouchScreen(Config::kTouchCSPin, Config::kTouchIRQPin,
 			Config::kDisplayHeight, Config::kDisplayWidth,
 			0, 0, 0, 0, Config::kInvertTouchX),
 	mMotorIsRunning(false),
 	mButtonDebouncePeriod(DEBOUNCE_DELAY), mButtonPressed(false),
 	mEmergencyButtonDebouncePeriod(DEBOUNCE_DELAY), mEmergencyBtnPressed(false),
-	mPOT(Config::kMCP45X1DeviceAddr),
+	mPOT(&mI2CQueue, Config::kMCP45X1DeviceAddr),
 	mStepperX(Config::kXStepPin, Config::kXDirPin),
 	mStepperZ(Config::kZStepPin, Config::kZDirPin),
 	mXMinEndstop(Config::kXMinEndstopPin),
@@ -151,6 +178,7 @@ void KeyMachineSTM32::begin(void)
 	pinMode(Config::kSDSelectPin, OUTPUT);
 	digitalWrite(Config::kSDSelectPin, HIGH);	// Deselect the SD card.
 	
+	memset(&mCutRecord, 0, sizeof(Config::SCutRecord));
 	{
 		Wire.beginTransmission(Config::kAT24CDeviceAddr);
 		bool	at24C64IsResp = Wire.endTransmission(true) == 0;
@@ -161,6 +189,7 @@ void KeyMachineSTM32::begin(void)
 		*/
 		if (at24C64IsResp)
 		{
+			mPreferences.Load();
 			Config::SKMPreferences	prefs;
 			bool	prefsRead = mPreferences.Read(0, sizeof(Config::SKMPreferences), &prefs.unused[0]);
 			if (prefsRead)
@@ -178,9 +207,19 @@ void KeyMachineSTM32::begin(void)
 					//	prefs.tsMinMax[0], prefs.tsMinMax[1], prefs.tsMinMax[2], prefs.tsMinMax[3]);
 				}
 			}
+			/*
+			*	Load the cut history.  The lifetime counters continue from the
+			*	last cut.
+			*/
+			if (mCutJournal.Load())
+			{
+				mCutJournal.ReadRecent(0, &mCutRecord);
+			}
+			//Serial.printf("Cuts: %d, completed %d, aborted %d\n", mCutJournal.Appended(),
+			//	mCutRecord.completedCuts, mCutRecord.abortedCuts);
 		} else
 		{
-			Serial.printf("AT24C64 is not responding.\n");
+			LOG_ERROR("AT24C64 is not responding.\n");
 		}
 	}
 	//Serial.printf("MCU Frequency = %d\n", F_CPU);
@@ -218,6 +257,7 @@ void KeyMachineSTM32::begin(void)
 			mZMaxEndstop.begin(std::bind(&KeyMachineSTM32::EndstopChangedISR, this, _1, _2));
 			
 			mHomeXEndstop.SetCallback(std::bind(&KeyMachineSTM32::EndstopsHomed, this, _1, _2));
+			mCutKey.SetCallback(std::bind(&KeyMachineSTM32::KeyCut, this, _1, _2));
 			
 			mStartMotor.SetCallback(std::bind(&KeyMachineSTM32::StartKMMotor, this, _1, _2));
 			mStartMotor.SetWaitPeriod(0, 5000);	// Wait after starting
@@ -235,7 +275,7 @@ void KeyMachineSTM32::begin(void)
 		{
 			motorSpeedValueField.Enable(false, false);
 			motorSpeedStepper.Enable(false, false);
-			Serial.printf("MCP45X1 is not responding.\n");
+			LOG_ERROR("MCP45X1 is not responding.\n");
 		}
 	}
 	
@@ -243,15 +283,30 @@ void KeyMachineSTM32::begin(void)
 	*	Setup the display...
 	*/
 	mTouchScreen.begin(Config::kDisplayRotation);
+	{
+		/*
+		*	The touch screen is sampled by a timer while the pen is down.  The
+		*	timer can be any hardware timer so it's allocated after the stepper
+		*	timers above.  The display and SD card share the SPI bus, their
+		*	transactions go through SPIBus (TFT_ST77XX and mSDSpi) which masks
+		*	the sample timer's IRQ.
+		*/
+		mTouchScreen.BeginSampling(STMTimers::AllocateNextAvailable());
+	}
 	mDisplay.begin(Config::kDisplayRotation);	// Init TFT
 	
 	rootView.SetSize(Config::kDisplayHeight, Config::kDisplayWidth);
 	rootView.SetDisplay(&mDisplay);
+	rootView.SetStrip(&mStrip);
 	rootView.SetModalView(&mainMenuBtn);
 	rootView.SetViewChangedDelegate(this);
 	warningDialog.SetViewChangedDelegate(this);
 	warningDialog.SetMinDialogSize();
+	UI20ptFont.SetGlyphIndex(&mUI20ptGlyphIndex);
+	UI64ptFont.SetGlyphIndex(&mUI64ptGlyphIndex);
 	xFont.SetDisplay(&mDisplay, &UI20ptFont);	// To initialize mDisplay of xFont
+	xFont.SetGlyphCache(&mGlyphCache);
+	xFont.SetLineBuffer(mLineBuffer, Config::kLineBufferPixels);
 
 	/*
 	*	Move the Reset button within the Cut Key dialog...
@@ -264,6 +319,15 @@ void KeyMachineSTM32::begin(void)
 	*/
 	cutKeyDialog.AutoSize();
 	resetBtn.SetOrigin(resetBtn.X(), cutKeyDialog.GetOKButton()->Y());
+	mKeywayList.AttachTo(&keywayMenu);
+	keywaySearchField.SetKeywayList(&mKeywayList);
+	/*
+	*	The dialogs with pre-rendered static layers on the SD card only draw
+	*	their dynamic views over the layer.  See ShowLayeredDialog.
+	*/
+	setupKeyHolderOriginDialog.SetStaticLayer(&mDialogLayer, setupKeyHolderOriginDynamicViews);
+	adjustOriginDialog.SetStaticLayer(&mDialogLayer, adjustOriginDynamicViews);
+	cutKeyDialog.SetStaticLayer(&mDialogLayer, cutKeyDynamicViews);
 	
 	ShowInfoView();
 }
@@ -280,39 +344,75 @@ bool KeyMachineSTM32::NoModalDialogDisplayed(void) const
 */
 bool KeyMachineSTM32::Update(void)
 {
-	if (mTouchScreen.PenStateChanged())
+	/*
+	*	The touch events are queued by the touch screen's sample timer.
+	*	MouseUp gets the MouseDown position, as it did when only the pen
+	*	down was sampled, so releasing after a small drift still hits the
+	*	view pressed.
+	*/
+	XPT2046::STouchEvent	touchEvent;
+	while (mTouchScreen.GetEvent(touchEvent))
 	{
-		if (mTouchScreen.PenIsDown())
+		switch (touchEvent.type)
 		{
-			if (!mDisplaySleeping)
-			{
-				//Serial.printf("D\n");
-				UnixTime::ResetSleepTime();
-				uint16_t	z;
-				mTouchScreen.Read(mX, mY, z);
-				mHitView = rootView.HitTest(mX, mY);
+			case XPT2046::ePenDown:
+				if (!mDisplaySleeping)
+				{
+					UnixTime::ResetSleepTime();
+					mX = touchEvent.x;
+					mY = touchEvent.y;
+					mHitView = rootView.HitTest(mX, mY);
+					if (mHitView)
+					{
+						mHitView->MouseDown(mX,mY);
+					}
+				} else
+				{
+					WakeUp();
+				}
+				break;
+			case XPT2046::ePenMoved:
 				if (mHitView)
 				{
-					mHitView->MouseDown(mX,mY);
+					UnixTime::ResetSleepTime();
+					mHitView->MouseDragged(touchEvent.x, touchEvent.y);
 				}
-			} else
-			{
-				WakeUp();
-			}
-		} else	// Else, pen is up
-		{
-			//Serial.printf("U\n");
-			if (mHitView)
-			{
-				mHitView->MouseUp(mX, mY);
-				mHitView = nullptr;
-			}
+				break;
+			case XPT2046::ePenUp:
+				if (mHitView)
+				{
+					mHitView->MouseUp(mX, mY);
+					mHitView = nullptr;
+				}
+				break;
 		}
 	}
 
 	CheckButtons();	// Buttons are used to setup the touchscreen.
 	UpdateEndstops();
 	GiveTimeToActions();
+	/*
+	*	Changed preferences are written to the EEPROM while the steppers are
+	*	idle.  See AT24CPreferences.
+	*/
+	if (mActionQueue.IsEmpty())
+	{
+		/*
+		*	If a cut was queued and the queue emptied without the cut
+		*	finishing THEN
+		*	the cut was aborted (stop button, failed homing, etc.)
+		*/
+		if (mCutInProgress)
+		{
+			AppendCutRecord(Config::eCutAborted);
+		}
+		mPreferences.Update();
+	}
+	/*
+	*	Do the next queued I2C transaction, if any (e.g. an EEPROM write or a
+	*	spindle speed change.)
+	*/
+	mI2CQueue.Update();
 	
 	/*
 	*	If the display isn't sleeping...
@@ -361,21 +461,29 @@ bool KeyMachineSTM32::Update(void)
 #if 1
 	/*
 	*	Serial commands
+	*	Frames of the binary protocol are handled by mRemote.  Any other byte
+	*	is a single character command.
 	*/
-	if (Serial.available())
+	while (Serial.available())
 	{
-		switch (Serial.read())
+		uint8_t	thisByte = Serial.read();
+		if (!mRemote.Receive(thisByte))
 		{
-			case '>':
-				Serial.printf(">\n");
-				// Set the time.  A hexadecimal ASCII UNIX time follows
-						// Use >65920071 for all-fields-change test (15s delay)
-				UnixTime::SetUnixTimeFromSerial();
-				STM32UnixRTC::SyncRTCToTime();
-				break;
+			switch (thisByte)
+			{
+				case '>':
+					dmaLog.Write(">\n", 2);
+					// Set the time.  A hexadecimal ASCII UNIX time follows
+							// Use >65920071 for all-fields-change test (15s delay)
+					UnixTime::SetUnixTimeFromSerial();
+					STM32UnixRTC::SyncRTCToTime();
+					break;
+			}
 		}
 	}
+	mRemote.Update();
 #endif	
+	dmaLog.Update();
 
 	return(false);
 }
@@ -416,43 +524,25 @@ void KeyMachineSTM32::GiveTimeToActions(void)
 	if (mLastActionQueueState != queueState)
 	{
 		mLastActionQueueState = queueState;
-	#if 0
 		switch(queueState)
 		{
 			case KMActionQueue::eQueueEmpty:
-			{
-				Serial.printf("Action Queue Empty\n");
+				LOG_DEBUG("Action Queue Empty\n");
 				break;
-			}
 			case KMActionQueue::eActionPending:
-			{
-				Serial.printf("Action Pending\n");
+				LOG_DEBUG("Action Pending\n");
 				break;
-			}
 			case KMActionQueue::eActionExecuting:
-			{
-				Serial.printf("Action \"%s\" Executing\n",
+				LOG_DEBUG("Action \"%s\" Executing\n",
 								mActionQueue.Current()->Name());
 				break;
-			}
 			case KMActionQueue::eActionFailed:
-			{
-				Serial.printf("Action \"%s\" Failed, exit = %d\n",
+				LOG_ERROR("Action \"%s\" Failed, exit = %d\n",
 								mActionQueue.Current()->Name(),
-								mActionQueue.Current()->ExitState());
+								(int)mActionQueue.Current()->ExitState());
 				mActionQueue.Clear();
 				break;
-			}
 		}
-	#else
-		if (queueState == KMActionQueue::eActionFailed)
-		{
-			Serial.printf("Action \"%s\" Failed, exit = %d\n",
-							mActionQueue.Current()->Name(),
-							mActionQueue.Current()->ExitState());
-			mActionQueue.Clear();
-		}
-	#endif
 	}
 }
 
@@ -461,23 +551,20 @@ void KeyMachineSTM32::UpdateEndstops(void)
 {
 	if (mEndstopChanged)
 	{
-	#if 0
-		/*
-		*	Whenever an endstop is tripped, stop the respective stepper.
-		*/
+	#if DMALOG_LEVEL >= DMALOG_LEVEL_DEBUG
 		switch (mEndstopChanged->GetPortPinMask())
 		{
 			case Config::kXMinEndstopMask:
-				Serial.printf("XMin endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
+				LOG_DEBUG("XMin endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
 				break;
 			case Config::kXMaxEndstopMask:
-				Serial.printf("XMax endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
+				LOG_DEBUG("XMax endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
 				break;
 			case Config::kZMinEndstopMask:
-				Serial.printf("ZMin endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
+				LOG_DEBUG("ZMin endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
 				break;
 			case Config::kZMaxEndstopMask:
-				Serial.printf("ZMax endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
+				LOG_DEBUG("ZMax endstop %s\n", mEndstopChanged->AtEndstop() ? "AT":"OFF");
 				break;
 		}
 	#endif
@@ -559,7 +646,7 @@ void KeyMachineSTM32::CheckButtons(void)
 	{
 		mEmergencyBtnPressed = false;
 		mActionQueue.Clear();
-		Serial.printf("EmergencyStopISR\n");
+		LOG_WARN("EmergencyStopISR\n");
 	}
 
 }
@@ -688,9 +775,7 @@ void KeyMachineSTM32::HandleViewChange(
 {
 	if (inView)
 	{
-	#if 0
-		Serial.printf("Change: Tag = %hd, Action = %hd\n", inView->Tag(), inAction);
-	#endif
+		LOG_DEBUG("Change: Tag = %hu, Action = %hu\n", inView->Tag(), inAction);
 		switch (inView->Tag())
 		{
 			case kMainMenuTag:
@@ -828,6 +913,12 @@ void KeyMachineSTM32::HandleViewChange(
 			case kKeywayMenuTag:
 				LoadKeySpecByTag(inAction);
 				break;
+			case kKeywaySearchStepperTag:
+				if (inAction == 0)
+				{
+					KeywaySearchChanged();
+				}
+				break;
 			case kPinCountMenuTag:
 				if (pinsValueField.GetPinCount() != inAction)
 				{
@@ -954,6 +1045,78 @@ void KeyMachineSTM32::ShowInfoView(void)
 	}
 }
 
+/***************************** ShowLayeredDialog ******************************/
+/*
+*	Shows a dialog that has a static layer.  The layer file is only open while
+*	the dialog is drawn.  If there's no SD card or the layer file doesn't
+*	exist, the dialog is drawn from its views.  The layer files are created by
+*	HostTools/KMDialogLayers.
+*/
+void KeyMachineSTM32::ShowLayeredDialog(
+	XDialogBox&	inDialog,
+	const char*	inLayerPath)
+{
+	if (BeginSD())
+	{
+		mDialogLayer.Open(inLayerPath);
+	}
+	inDialog.Show();
+	mDialogLayer.Close();
+}
+
+/********************************** BeginSD ***********************************/
+/*
+*	Begins the SD card if it's present and hasn't been begun.  Returns true if
+*	the card is ready.
+*/
+bool KeyMachineSTM32::BeginSD(void)
+{
+	if (digitalRead(Config::kSDDetectPin) == LOW)
+	{
+		if (!mSDBegun)
+		{
+			mSDBegun = mSD.begin(SdSpiConfig(Config::kSDSelectPin, SHARED_SPI,
+								SD_SCK_MHZ(Config::kDialogLayerSDMHz), &mSDSpi));
+		}
+		if (mSDBegun)
+		{
+			/*
+			*	The settings are saved and loaded using a local SdFat so make
+			*	mSD the current volume before opening a file.
+			*/
+			mSD.chvol();
+		}
+	/*
+	*	Else the card isn't present THEN
+	*	begin it again when it's inserted.  The catalog may be different.
+	*/
+	} else
+	{
+		mSDBegun = false;
+		mCatalog.Unload();
+		mCatalogStream.Close();
+		mKeywayList.Reset();
+	}
+	return(mSDBegun);
+}
+
+/***************************** LoadKeySpecCatalog *****************************/
+/*
+*	The catalog is compiled by HostTools/KMKeySpecCatalog.  Only its header is
+*	read here.  The specs are read as needed by FindKeySpecByTag.
+*/
+void KeyMachineSTM32::LoadKeySpecCatalog(void)
+{
+	if (BeginSD() &&
+		!mCatalog.IsLoaded() &&
+		mCatalogStream.Open(kKeySpecCatalogPath) &&
+		!mCatalog.Load())
+	{
+		mCatalogStream.Close();
+	}
+	mKeywayList.Reset();
+}
+
 /**************************** ShowUtilitiesDialog *****************************/
 void KeyMachineSTM32::ShowUtilitiesDialog(void)
 {
@@ -997,7 +1160,7 @@ void KeyMachineSTM32::ShowAdjustOriginDialog(void)
 		{
 			deltaXValueField.SetValue(0, false);
 			deltaZValueField.SetValue(0, false);
-			adjustOriginDialog.Show();
+			ShowLayeredDialog(adjustOriginDialog, kAdjustOriginLayerPath);
 		} else
 		{
 			warningDialog.DoMessage(kKeyHolderOriginUndefinedStr);
@@ -1096,7 +1259,7 @@ void KeyMachineSTM32::ShowSetupZeroDialog(void)
 				zeroXOffsetValueField.SetIncrement(prefs.incMenuItemTag);
 				zeroZOffsetValueField.SetIncrement(prefs.incMenuItemTag);
 				incrementPopUp.SelectMenuItem(prefs.incMenuItemTag);
-				setupKeyHolderOriginDialog.Show();
+				ShowLayeredDialog(setupKeyHolderOriginDialog, kSetupZeroLayerPath);
 			} else
 			{
 				warningDialog.DoMessage(kUnableToReadPrefsStr);
@@ -1217,6 +1380,7 @@ void KeyMachineSTM32::ShowCutKeyDialog(void)
 		*/
 		if (GetKeyHolderOrigin(keyHolderOriginX, keyHolderOriginZ))
 		{
+			LoadKeySpecCatalog();
 			/*
 			*	Load the dialog prefs from EEPROM
 			*/
@@ -1238,12 +1402,13 @@ void KeyMachineSTM32::ShowCutKeyDialog(void)
 					prefs.keywayMenuItemTag = kSchlageSC1MenuItem;
 					prefs.pinCountMenuItemTag = k5PinMenuItem;
 				}
+				keywaySearchField.PrefixChanged(false);
 				keywayPopUp.SelectMenuItem(prefs.keywayMenuItemTag);
 				pinCountPopUp.SelectMenuItem(prefs.pinCountMenuItemTag);
 				pinsValueField.SetPinCount(prefs.pinCountMenuItemTag, false);
 				LoadKeySpecByTag(prefs.keywayMenuItemTag, false);
 				pinsValueField.SetPinDepthsDec22mm(prefs.pinDepths);
-				cutKeyDialog.Show();
+				ShowLayeredDialog(cutKeyDialog, kCutKeyLayerPath);
 			} else
 			{
 				warningDialog.DoMessage(kUnableToReadPrefsStr);
@@ -1258,6 +1423,39 @@ void KeyMachineSTM32::ShowCutKeyDialog(void)
 	}
 }
 
+/**************************** KeywaySearchChanged *****************************/
+/*
+*	Called after the keyway search prefix was changed using the stepper.  The
+*	keyway menu now only lists the keyways that start with the prefix.  If the
+*	selected keyway is still listed it remains selected, otherwise the first
+*	listed keyway is selected.
+*/
+void KeyMachineSTM32::KeywaySearchChanged(void)
+{
+	/*
+	*	The stepper only offers characters that some keyway has, so the list
+	*	can only be empty if the catalog couldn't be read.  If empty THEN
+	*	clear the prefix so that at least the built in keyways are listed.
+	*/
+	if (mKeywayList.GetItemCount() == 0)
+	{
+		mKeywayList.Reset();
+		keywaySearchField.PrefixChanged();
+	}
+	/*
+	*	The item is selected by index, so only the selected item's name entry
+	*	is read.  A tag 0 item is one that couldn't be read.
+	*/
+	keywayPopUp.SelectMenuItemAtIndex(mKeywayList.GetPriorSelectionIndex());
+	keywayPopUp.DrawSelf();
+	XMenuItem*	keywayItem = keywayMenu.GetSelectedItem();
+	if (keywayItem &&
+		keywayItem->Tag())
+	{
+		LoadKeySpecByTag(keywayItem->Tag());
+	}
+}
+
 /****************************** LoadKeySpecByTag ******************************/
 /*
 *	Loads the SKeySpec into the Cut Key dialog.
@@ -1323,11 +1521,11 @@ void KeyMachineSTM32::LoadKeySpecByTag(
 
 /****************************** FindKeySpecByTag ******************************/
 /*
-*	Currently the SKeySpecs are hard coded.  This bottleneck could be modified
-*	when SKeySpecs are loaded dynamically from either SD or EEPROM.
+*	The Schlage and Kwikset SKeySpecs are hard coded.  All others are read from
+*	the KeySpecCatalog on the SD card, if any.  Only the spec found is read.
 */
 const SKeySpec* KeyMachineSTM32::FindKeySpecByTag(
-	uint16_t	inTag) const
+	uint16_t	inTag)
 {
 	SKeySpec*	keySpec = nullptr;
 	switch (inTag)
@@ -1338,6 +1536,13 @@ const SKeySpec* KeyMachineSTM32::FindKeySpecByTag(
 		case kSchlageSC1MenuItem:
 			keySpec = &schlageKeySpec;
 			break;
+		default:
+			if (mCatalog.IsLoaded() &&
+				mCatalog.FindByTag(inTag, mCatalogSpec))
+			{
+				keySpec = &mCatalogSpec;
+			}
+			break;
 	}
 	return(keySpec);
 }
@@ -1362,48 +1567,180 @@ void KeyMachineSTM32::DoCutKey(void)
 		SKeySpec& spec = pinsValueField.GetKeySpec();
 		//Serial.printf("CutKey = %s, pin count = %hd\n", spec.name, prefs.pinCountMenuItemTag);
 
-		uint32_t	keyHolderOriginX = 0;
-		uint32_t	keyHolderOriginZ = 0;
 		/*
-		*	If the key holder origin has been defined AND
-		*	the cutter head isn't busy THEN
-		*	move the cutter head to 0.5mm to the right of the key shoulder and
-		*	10mm above the bottom of the key holder slot.
+		*	If the cut can't be queued...
+		*	Unable to read prefs or there is something in the action queue.
+		*	THis should never happen so no error is displayed.
+		*/
+		QueueCutKey(spec, prefs.keywayMenuItemTag, prefs.pinCountMenuItemTag, prefs.pinDepths);
+#if 1
+	} else
+	{
+		LOG_ERROR("errorCode = %d, pin = %d\n", (int)errorCode, (int)errorPin);
+#endif
+	}
+}
+
+/******************************** QueueCutKey *********************************/
+/*
+*	Queues the actions that cut a key.  Used by the Cut Key dialog and by the
+*	serial protocol (QueueRemoteCut).  Returns false if the key holder origin
+*	isn't defined or the cutter head is busy.
+*/
+bool KeyMachineSTM32::QueueCutKey(
+	const SKeySpec&	inSpec,
+	uint16_t		inKeywayTag,
+	uint32_t		inPinCount,
+	int32_t			inPinDepths[])
+{
+	uint32_t	keyHolderOriginX = 0;
+	uint32_t	keyHolderOriginZ = 0;
+	/*
+	*	If the key holder origin has been defined AND
+	*	the cutter head isn't busy THEN
+	*	move the cutter head to 0.5mm to the right of the key shoulder and
+	*	10mm above the bottom of the key holder slot.
+	*/
+	bool	cutQueued = GetKeyHolderOrigin(keyHolderOriginX, keyHolderOriginZ) &&
+				HomeAndMoveCutterHeadTo(keyHolderOriginX+50,
+										keyHolderOriginZ-1000);
+	if (cutQueued)
+	{
+		// Turn on cutter...
+		mActionQueue.AppendAction(&mStartMotor);
+		// cut the key
+		mCutKey.Setup(&inSpec, inPinCount, keyHolderOriginX, keyHolderOriginZ, inPinDepths);
+		mActionQueue.AppendAction(&mCutKey);
+		mCutRecord.keywayMenuItemTag = inKeywayTag;
+		mCutRecord.pinCount = inPinCount;
+		memset(mCutRecord.pinDepths, 0, sizeof(mCutRecord.pinDepths));
+		memcpy(mCutRecord.pinDepths, inPinDepths, sizeof(int32_t) * inPinCount);
+		mCutInProgress = true;
+		// Turn off cutter...
+		mActionQueue.AppendAction(&mStopMotor);
+		// move cutter head out of the way.
+		mFastMoveZTo[1].SetSteps(100, false);	// Move to 1mm below endstop
+		mActionQueue.AppendAction(&mFastMoveZTo[1]);
+		mFastMoveXTo[1].SetSteps(1500, false);	// Move to 15mm before endstop
+		mActionQueue.AppendAction(&mFastMoveXTo[1]);
+	}
+	return(cutQueued);
+}
+
+/******************************* QueueRemoteCut *******************************/
+/*
+*	QueueRemoteCut, GetRemoteQueueState, GetRemoteTelemetry and WriteRemote
+*	are members of the KMRemoteDelegate mixin class.  The cut job is validated
+*	the same as the Cut Key dialog's values.  The job doesn't change the Cut
+*	Key dialog prefs.
+*/
+uint8_t KeyMachineSTM32::QueueRemoteCut(
+	const SKMRemoteCutJob&	inJob,
+	SKMRemoteCutResponse&	outResponse)
+{
+	uint8_t	status = eKMRemoteOK;
+	if (!mActionQueue.IsEmpty() ||
+		mController.isRunning())
+	{
+		status = eKMRemoteBusy;
+	} else
+	{
+		/*
+		*	If the catalog is already loaded THEN
+		*	look up the spec without touching the keyway list, the Cut Key
+		*	dialog may be showing the operator's search.
 		*/
-		if (GetKeyHolderOrigin(keyHolderOriginX, keyHolderOriginZ) &&
-			HomeAndMoveCutterHeadTo(keyHolderOriginX+50,
-									keyHolderOriginZ-1000))
+		if (!mCatalog.IsLoaded())
 		{
-			// Turn on cutter...
-			mActionQueue.AppendAction(&mStartMotor);
-			// cut the key
-			mCutKey.Setup(&spec, prefs.pinCountMenuItemTag, keyHolderOriginX, keyHolderOriginZ, prefs.pinDepths);
-			mActionQueue.AppendAction(&mCutKey);
-			// Turn off cutter...
-			mActionQueue.AppendAction(&mStopMotor);
-			// move cutter head out of the way.
-			mFastMoveZTo[1].SetSteps(100, false);	// Move to 1mm below endstop
-			mActionQueue.AppendAction(&mFastMoveZTo[1]);
-			mFastMoveXTo[1].SetSteps(1500, false);	// Move to 15mm before endstop
-			mActionQueue.AppendAction(&mFastMoveXTo[1]);
-		
-	//	} else
-	//	{
-	// Unable to read prefs or there is something in the action queue.
-	// THis should never happen so no error is displayed.
+			LoadKeySpecCatalog();
 		}
-		
-		
+		const SKeySpec*	spec = FindKeySpecByTag(inJob.keywayTag);
+		if (!spec)
+		{
+			status = eKMRemoteUnknownKeyway;
+		} else if (!spec->PinCountSupported(inJob.pinCount))
+		{
+			status = eKMRemoteBadPinCount;
+		} else
+		{
+			uint32_t	pinCode = 0;
+			uint32_t	errorPin = 0;
+			int32_t		pinDepths[SKeySpec::eMaxPinCount];
+			SKeySpec::EErrorCode	errorCode = SKeySpec::eNoErr;
+			for (uint32_t i = 0; i < inJob.pinCount; i++)
+			{
+				if (inJob.pins[i] > 9)
+				{
+					errorCode = SKeySpec::ePinIndexErr;
+					errorPin = i;
+					break;
+				}
+				pinCode = (pinCode * 10) + inJob.pins[i];
+			}
+			if (errorCode == SKeySpec::eNoErr)
+			{
+				errorCode = spec->PinCodeToDec22mm(pinCode, inJob.pinCount,
+									inJob.customDepths, pinDepths, &errorPin);
+			}
+			if (errorCode != SKeySpec::eNoErr)
+			{
+				status = eKMRemoteBadPins;
+				outResponse.errorCode = errorCode;
+				outResponse.errorPin = errorPin;
+			} else if (!QueueCutKey(*spec, inJob.keywayTag, inJob.pinCount, pinDepths))
+			{
+				status = eKMRemoteNoOrigin;
+			}
+		}
+	}
+	return(status);
+}
 
+/**************************** GetRemoteQueueState *****************************/
+void KeyMachineSTM32::GetRemoteQueueState(
+	SKMRemoteQueueState&	outState)
+{
+	outState.status = eKMRemoteOK;
+	outState.queueState = mActionQueue.State();
+	for (KMAction* action = mActionQueue.Head(); action; action = action->Next())
+	{
+		outState.queuedActions++;
+	}
+	outState.cutInProgress = mCutInProgress;
+	if (mActionQueue.Current())
+	{
+		outState.exitState = mActionQueue.Current()->ExitState();
+		strncpy(outState.currentAction, mActionQueue.Current()->Name(),
+							kKMRemoteActionNameSize-1);
+	}
+	outState.completedCuts = mCutRecord.completedCuts;
+	outState.abortedCuts = mCutRecord.abortedCuts;
+}
 
-#if 1
-	} else
+/***************************** GetRemoteTelemetry *****************************/
+void KeyMachineSTM32::GetRemoteTelemetry(
+	SKMRemoteTelemetry&	outTelemetry)
+{
+	outTelemetry.x = TO_STEPS(mStepperX.getPosition());
+	outTelemetry.z = TO_STEPS(mStepperZ.getPosition());
+	outTelemetry.queueState = mActionQueue.State();
+	outTelemetry.motorRunning = mMotorIsRunning;
+	outTelemetry.cutInProgress = mCutInProgress;
+	if (mActionQueue.Current())
 	{
-		Serial.printf("errorCode = %d, pin = %d\n", (uint32_t)errorCode, errorPin);
-#endif
+		strncpy(outTelemetry.currentAction, mActionQueue.Current()->Name(),
+							kKMRemoteActionNameSize-1);
 	}
 }
 
+/******************************** WriteRemote *********************************/
+void KeyMachineSTM32::WriteRemote(
+	const uint8_t*	inData,
+	uint16_t		inLength)
+{
+	dmaLog.Write(inData, inLength);
+}
+
 /****************************** DisableSteppers *******************************/
 void KeyMachineSTM32::DisableSteppers(void)
 {
@@ -1437,6 +1774,39 @@ void KeyMachineSTM32::EndstopsHomed(
 	mSteppersHomed = inExitState == KMAction::eExitNormal;
 }
 
+/*********************************** KeyCut ***********************************/
+/*
+*	Called when mCutKey finishes.
+*/
+void KeyMachineSTM32::KeyCut(
+	KMAction*	inAction,
+	uint32_t	inExitState)
+{
+	AppendCutRecord(inExitState == KMAction::eExitNormal ?
+						Config::eCutCompleted : Config::eCutAborted);
+}
+
+/******************************* AppendCutRecord ******************************/
+/*
+*	Appends the cut in progress to the cut history.  The EEPROM write is done
+*	by mI2CQueue.
+*/
+void KeyMachineSTM32::AppendCutRecord(
+	uint8_t	inResult)
+{
+	mCutInProgress = false;
+	mCutRecord.time = UnixTime::Time();
+	mCutRecord.result = inResult;
+	if (inResult == Config::eCutCompleted)
+	{
+		mCutRecord.completedCuts++;
+	} else
+	{
+		mCutRecord.abortedCuts++;
+	}
+	mCutJournal.Append(&mCutRecord);
+}
+
 /***************************** SaveKMSettingsToSD *****************************/
 void KeyMachineSTM32::SaveKMSettingsToSD(void)
 {
@@ -1449,7 +1819,8 @@ void KeyMachineSTM32::SaveKMSettingsToSD(void)
 		mTouchScreen.GetMinMax(settings.tsMinMax);
 
 		SdFat sd;
-		bool	success = sd.begin(Config::kSDSelectPin, SD_SCK_MHZ(4));
+		bool	success = sd.begin(SdSpiConfig(Config::kSDSelectPin,
+								SHARED_SPI, SD_SCK_MHZ(4), &mSDSpi));
 		if (success)
 		{
 			success = kmSettings.WriteFile(kKMSettingsPath, settings);
@@ -1471,7 +1842,8 @@ void KeyMachineSTM32::LoadKMSettingsFromSD(void)
 	{
 		SdFat sd;
 		KMSettings	kmSettings;
-		bool	success = sd.begin(Config::kSDSelectPin, SD_SCK_MHZ(4));
+		bool	success = sd.begin(SdSpiConfig(Config::kSDSelectPin,
+								SHARED_SPI, SD_SCK_MHZ(4), &mSDSpi));
 		if (success)
 		{
 			success = kmSettings.ReadFile(kKMSettingsPath);
@@ -1486,9 +1858,11 @@ void KeyMachineSTM32::LoadKMSettingsFromSD(void)
 			prefs.clockFormat = settings.hourFormat == 12;
 			memcpy(prefs.tsMinMax, settings.tsMinMax, sizeof(prefs.tsMinMax));
 			mPreferences.Write(0, sizeof(Config::SKMPreferences), &prefs.unused[0]);
+			mPreferences.Flush();
 			/*
 			*	Restart the board.
 			*/
+			dmaLog.Flush();
 			HAL_NVIC_SystemReset();
 		} else
 		{
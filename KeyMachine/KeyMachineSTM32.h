@@ -25,10 +25,18 @@
 #define KeyMachineSTM32_h
 
 #include "Config.h"
+#include "I2CQueue.h"
 #include "AT24C.h"
+#include "AT24CPreferences.h"
+#include "AT24CJournal.h"
 #include "TFT_ILI9488.h"
+#include "StripDisplayController.h"
+#include "XGlyphCache.h"
+#include "XGlyphIndex.h"
 #include "XPT2046.h"
 #include "XDialogBox.h"
+#include "SdFatDataStream.h"
+#include "KMSdSpiDriver.h"
 #include "MSPeriod.h"
 //#include "USPeriod.h"
 #include "STM32UnixRTC.h"
@@ -38,11 +46,15 @@
 #include "HomeEndstop.h"
 #include "FastMoveTo.h"
 #include "CutKey.h"
+#include "KeySpecCatalog.h"
+#include "KMKeywayList.h"
 #include "CallbackAction.h"
 #include "KMActionQueue.h"
+#include "KMRemote.h"
 
 class KeyMachineSTM32 : public XViewChangedDelegate,
-								public XValidatorDelegate
+								public XValidatorDelegate,
+								public KMRemoteDelegate
 {
 public:
 							KeyMachineSTM32(void);
@@ -55,12 +67,45 @@ public:
 								uint16_t				inAction);
 	virtual bool			ValuesAreValid(
 								XDialogBox*				inDialog);
+	virtual uint8_t			QueueRemoteCut(
+								const SKMRemoteCutJob&	inJob,
+								SKMRemoteCutResponse&	outResponse);
+	virtual void			GetRemoteQueueState(
+								SKMRemoteQueueState&	outState);
+	virtual void			GetRemoteTelemetry(
+								SKMRemoteTelemetry&		outTelemetry);
+	virtual void			WriteRemote(
+								const uint8_t*			inData,
+								uint16_t				inLength);
 								
 protected:
 	XView*			mHitView;
 	TFT_ILI9488		mDisplay;
+	StripDisplayController	mStrip;
+	uint16_t		mStripBuffer[Config::kStripBufferPixels];
+	XGlyphCache		mGlyphCache;
+	uint16_t		mGlyphCacheBuffer[Config::kGlyphCachePixels];
+	uint16_t		mLineBuffer[Config::kLineBufferPixels];
+	XGlyphIndex		mUI20ptGlyphIndex;
+	XGlyphIndex		mUI64ptGlyphIndex;
+	KMSdSpiDriver	mSDSpi;
+	SdFat			mSD;
+	SdFatPixelStream	mDialogLayer;
+	uint8_t			mDialogLayerBuffer[Config::kDialogLayerBufferSize];
+	SdFatDataStream	mCatalogStream;
+	uint8_t			mCatalogBuffer[Config::kKeySpecCatalogBufferSize];
+	KeySpecCatalog	mCatalog;
+	SKeySpec		mCatalogSpec;	// Last spec found in mCatalog
+	KMKeywayList	mKeywayList;
 	XPT2046			mTouchScreen;
-	AT24C			mPreferences;
+	I2CQueue		mI2CQueue;
+	AT24C			mEEPROM;
+	AT24CPreferences	mPreferences;
+	uint8_t			mPreferencesBuffer[Config::kPreferencesMirrorSize];
+	AT24CJournal	mCutJournal;
+	Config::SCutRecord	mCutRecord;		// The cut in progress or the last cut
+	bool			mCutInProgress;
+	KMRemote		mRemote;
 	MCP45X1			mPOT;
 	StepControl		mController;
 	Stepper			mStepperX;
@@ -85,6 +130,7 @@ protected:
 	bool			mButtonPressed;
 	bool			mEmergencyBtnPressed;
 	bool			mMCP45X1Exists;
+	bool			mSDBegun;
 	MSPeriod		mButtonDebouncePeriod;
 	MSPeriod		mEmergencyButtonDebouncePeriod;
 	uint32_t		mButtonPinState;
@@ -95,6 +141,11 @@ protected:
 	void					UpdateEndstops(void);
 	bool					NoModalDialogDisplayed(void) const;
 	void					ShowInfoView(void);
+	bool					BeginSD(void);
+	void					LoadKeySpecCatalog(void);
+	void					ShowLayeredDialog(
+								XDialogBox&				inDialog,
+								const char*				inLayerPath);
 	void					ShowUtilitiesDialog(void);
 	void					ShowAdjustOriginDialog(void);
 	void					SaveAdjustOriginDialogChanges(void);
@@ -110,9 +161,15 @@ protected:
 	void					LoadKeySpecByTag(
 								uint16_t				inTag,
 								bool					inUpdate = true);
+	void					KeywaySearchChanged(void);
 	const SKeySpec*			FindKeySpecByTag(
-								uint16_t				inTag) const;
+								uint16_t				inTag);
 	void					DoCutKey(void);
+	bool					QueueCutKey(
+								const SKeySpec&			inSpec,
+								uint16_t				inKeywayTag,
+								uint32_t				inPinCount,
+								int32_t					inPinDepths[]);
 	void					SaveKMSettingsToSD(void);
 	void					LoadKMSettingsFromSD(void);
 	void					UpdateInfoView(void);
@@ -124,6 +181,11 @@ protected:
 	void					EndstopsHomed(
 								KMAction*				inAction,
 								uint32_t				inExitState);
+	void					KeyCut(
+								KMAction*				inAction,
+								uint32_t				inExitState);
+	void					AppendCutRecord(
+								uint8_t					inResult);
 	void					EmergencyStopISR(void);
 	void					ButtonPressedISR(void);
 	void					CheckButtons(void);
@@ -29,13 +29,14 @@
 *
 */
 #include "KeySpec.h"
+#include "KMTextFile.h"
+#include <stdlib.h>
+#include <string.h>
 #ifndef __MACH__
 #include <Arduino.h>
-#include "SdFat.h"
-#include "sdios.h"
 #include "Config.h"
 #else
-#include <string>
+#include <cmath>
 #define _BV(bit) (1 << (bit))
 namespace Config
 {
@@ -124,7 +125,6 @@ static const uint32_t kBoolKeysMask =
 
 /********************************* KeySpec **********************************/
 KeySpec::KeySpec(void)
-: mFile(nullptr)
 {
 }
 
@@ -140,136 +140,87 @@ bool KeySpec::ReadFile(
 {
 	mSpec = {0};
 	uint8_t	requiredKeyValues = 0;
-#ifndef __MACH__
-	SdFile file;
-	bool	fileOpened = file.open(inPath, O_RDONLY);
-	mFile = &file;
-#else
-	mFile = fopen(inPath, "r+");
-	bool	fileOpened = mFile != nullptr;
-#endif
-	if (fileOpened)
+	KMTextFile	file;
+	if (file.Open(inPath))
 	{
-		char	thisChar = NextChar();
-		while (thisChar)
+		char*	keyStr;
+		char*	valueStr;
+		while (file.NextKeyValue(keyStr, valueStr))
 		{
-			thisChar = SkipWhitespaceAndHashComments(thisChar);
-			if (thisChar)
+			uint8_t keyIndex = FindKeyIndex(keyStr);
+			if (keyIndex)
 			{
-				char keyStr[32];
-				keyStr[0] = thisChar;
-				thisChar = ReadStr('=', 31, &keyStr[1]);
-				while (thisChar)
+				requiredKeyValues++;
+				if (kUInt32KeysMask & (_BV(keyIndex)))
 				{
-					StripLeadingAndTrailingWhitespace(keyStr);
-					uint8_t keyIndex = FindKeyIndex(keyStr);
-					if (keyIndex)
+					uint32_t	value = KMTextFile::ToUInt32(valueStr);
+					switch (keyIndex)
 					{
-						requiredKeyValues++;
-						if (kUInt32KeysMask & (_BV(keyIndex)))
-						{
-							uint32_t	value;
-							thisChar = ReadUInt32Number(value);
-							switch (keyIndex)
-							{
-								case eDeepestCutIndex:
-									mSpec.deepestCutIndex = value;
-									break;
-								case eMACS:
-									mSpec.macs = value;
-									break;
-								case ePinsSupported:
-									mSpec.pinsSupported = value;
-									break;
-								case eShalowestCutIndex:
-									mSpec.shalowestCutIndex = value;
-									break;
-							}
-						} else if (kFloatKeysMask & (_BV(keyIndex)))
-						{
-							float	fValue;
-							thisChar = ReadFloatNumber(fValue);
-							switch (keyIndex)
-							{
-								case eBladeWidth:
-									mSpec.bladeWidth = fValue;
-									break;
-								case eCutAngle:
-									mSpec.cutAngle = fValue;
-									break;
-								case eDeepestCut:
-									mSpec.deepestCut = fValue;
-									break;
-								case eFirstPinCenter:
-									mSpec.firstPinCenter = fValue;
-									break;
-								case eFlatWidth:
-									mSpec.flatWidth = fValue;
-									break;
-								case ePinDepthInc:
-									mSpec.pinDepthInc = fValue;
-									break;
-								case ePinSpacing:
-									mSpec.pinSpacing = fValue;
-									break;
-							}
-						} else if (kBoolKeysMask & (_BV(keyIndex)))
-						{
-							char valueStr[10];
-							thisChar = ReadStr('\n', sizeof(valueStr), valueStr);
-							StripLeadingAndTrailingWhitespace(valueStr);
-							bool isTrue =  valueStr[0] == 't';
-							switch (keyIndex)
-							{
-								case eIncreasingDepths:
-									mSpec.increasingDepths = isTrue;
-									break;
-								case eIsMetric:
-									mSpec.isMetric = isTrue;
-									break;
-							}
-						} else if (keyIndex == eName)
-						{
-							thisChar = ReadStr('\n', sizeof(mSpec.name), mSpec.name);
-							StripLeadingAndTrailingWhitespace(mSpec.name);
-						}
-					} else
+						case eDeepestCutIndex:
+							mSpec.deepestCutIndex = value;
+							break;
+						case eMACS:
+							mSpec.macs = value;
+							break;
+						case ePinsSupported:
+							mSpec.pinsSupported = value;
+							break;
+						case eShalowestCutIndex:
+							mSpec.shalowestCutIndex = value;
+							break;
+						case eTag:
+							mSpec.tag = value;
+							break;
+					}
+				} else if (kFloatKeysMask & (_BV(keyIndex)))
+				{
+					float	fValue = strtof(valueStr, nullptr);
+					switch (keyIndex)
 					{
-						thisChar = SkipToNextLine();
+						case eBladeWidth:
+							mSpec.bladeWidth = fValue;
+							break;
+						case eCutAngle:
+							mSpec.cutAngle = fValue;
+							break;
+						case eDeepestCut:
+							mSpec.deepestCut = fValue;
+							break;
+						case eFirstPinCenter:
+							mSpec.firstPinCenter = fValue;
+							break;
+						case eFlatWidth:
+							mSpec.flatWidth = fValue;
+							break;
+						case ePinDepthInc:
+							mSpec.pinDepthInc = fValue;
+							break;
+						case ePinSpacing:
+							mSpec.pinSpacing = fValue;
+							break;
 					}
-					break;
+				} else if (kBoolKeysMask & (_BV(keyIndex)))
+				{
+					bool isTrue =  valueStr[0] == 't';
+					switch (keyIndex)
+					{
+						case eIncreasingDepths:
+							mSpec.increasingDepths = isTrue;
+							break;
+						case eIsMetric:
+							mSpec.isMetric = isTrue;
+							break;
+					}
+				} else if (keyIndex == eName)
+				{
+					strncpy(mSpec.name, valueStr, sizeof(mSpec.name) -1);
 				}
 			}
 		}
-	#ifndef __MACH__
-		mFile->close();
-	#else
-		fclose(mFile);
-	#endif
-		mFile = nullptr;
 	}
 	return(requiredKeyValues == (eKeyCount-1));
 }
 
-/********************************** NextChar **********************************/
-char KeySpec::NextChar(void)
-{
-	char	thisChar;
-#ifdef __MACH__
-	thisChar = getc(mFile);
-	if (thisChar == -1)
-	{
-		thisChar = 0;
-	}
-#else
-	if (mFile->read(&thisChar,1) != 1)
-	{
-		thisChar = 0;
-	}
-#endif
-	return(thisChar);
-}
-
 /******************************** FindKeyIndex ********************************/
 /*
 *	Returns the index of inKey within the array kSpecKeys + 1.
@@ -299,200 +250,6 @@ uint8_t KeySpec::FindKeyIndex(
 	return(0);
 }
 
-/********************** StripLeadingAndTrailingWhitespace *********************/
-void KeySpec::StripLeadingAndTrailingWhitespace(
-	char*	ioStr)
-{
-	char*	strPtr = ioStr;
-	char	thisChar;
-	/*
-	*	Strip any leading whitespace...
-	*/
-	for (thisChar = *(strPtr++); thisChar != 0; thisChar = *(strPtr++))
-	{
-		if (isspace(thisChar))
-		{
-			continue;
-		}
-		*(ioStr++) = thisChar;
-		break;
-	}
-	/*
-	*	Skip any trailing whitespace...
-	*/
-	char*	endWhitespace = nullptr;
-	for (thisChar = *(strPtr++); thisChar != 0; thisChar = *(strPtr++))
-	{
-		if (!isspace(thisChar))
-		{
-			endWhitespace = nullptr;
-		} else if (endWhitespace == nullptr)
-		{
-			endWhitespace = ioStr;
-		}
-		*(ioStr++) = thisChar;
-	}
-	if (endWhitespace == nullptr)
-	{
-		*ioStr = 0;
-	} else
-	{
-		*endWhitespace = 0;
-	}
-}
-
-/*********************** SkipWhitespaceAndHashComments ************************/
-char KeySpec::SkipWhitespaceAndHashComments(
-	char	inCurrChar)
-{
-	char	thisChar = inCurrChar;
-	while (thisChar)
-	{
-		if (isspace(thisChar))
-		{
-			thisChar = NextChar();
-			continue;
-		} else if (thisChar == '#')
-		{
-			thisChar = SkipToNextLine();
-			continue;
-		}
-		break;
-	}
-	return(thisChar);
-}
-
-/******************************* SkipToNextLine *******************************/
-/*
-*	Returns the character following the newline (if any).
-*	Does not support Windows CRLF line endings.
-*/
-char KeySpec::SkipToNextLine(void)
-{
-	char thisChar = NextChar();
-	for (; thisChar; thisChar = NextChar())
-	{
-		if (thisChar != '\n')
-		{
-			continue;
-		}
-		thisChar = NextChar();
-		break;
-	}
-	return(thisChar);
-}
-
-/****************************** ReadUInt32Number ******************************/
-char KeySpec::ReadUInt32Number(
-	uint32_t&	outValue)
-{
-	bool		bitwiseNot = false;
-	bool 		isHex = false;
-	uint32_t	value = 0;
-	char		thisChar = SkipWhitespaceAndHashComments(NextChar());
-	if (thisChar)
-	{
-		bitwiseNot = thisChar == '~';
-		/*
-		*	If notted THEN
-		*	get the next char after the not.
-		*/
-		if (bitwiseNot)
-		{
-			thisChar = SkipWhitespaceAndHashComments(NextChar());
-		}
-		if (thisChar == '0')
-		{
-			thisChar = NextChar();	// Get the character following the leading zero.
-			isHex = thisChar == 'x';
-			/*
-			*	If this is a hex prefix THEN
-			*	get the character following it.
-			*/
-			if (isHex)
-			{
-				thisChar = NextChar();
-			}
-		}
-		// Now just consume characters till a non valid numeric char is hit.
-		if (isHex)
-		{
-			for (; isxdigit(thisChar); thisChar = NextChar())
-			{
-				thisChar -= '0';
-				if (thisChar > 9)
-				{
-					thisChar -= 7;
-					if (thisChar > 15)
-					{
-						thisChar -= 32;
-					}
-				}
-				value = (value << 4) + thisChar;
-			}
-		} else
-		{
-			for (; isdigit(thisChar); thisChar = NextChar())
-			{
-				value = (value * 10) + (thisChar - '0');
-			}
-		}
-		thisChar = SkipWhitespaceAndHashComments(thisChar);
-	}
-	if (bitwiseNot)
-	{
-		value = ~value;
-	}
-	outValue = value;
-	return(thisChar);
-}
-
-/****************************** ReadFloatNumber *******************************/
-char KeySpec::ReadFloatNumber(
-	float&	outValue)
-{
-	char	numBuf[20];
-	char	thisChar = ReadStr('\n', sizeof(numBuf), numBuf);
-	sscanf(numBuf, "%f", &outValue);
-
-	return(thisChar);
-}
-
-/********************************** ReadStr ***********************************/
-/*
-*	Reads the string till the delimiter is hit.
-*	Once the string is full (inMaxStrLen), characters are ignored till the
-*	delimiter is hit.
-*	Hash (#) comments are not allowed because the strings aren't quoted.
-*/
-char KeySpec::ReadStr(
-	char	inDelimiter,
-	uint8_t	inMaxStrLen,
-	char*	outStr)
-{
-	char		thisChar;
-	char*		endOfStrPtr = &outStr[inMaxStrLen -1];
-
-	while((thisChar = NextChar()) != 0)
-	{
-		if (thisChar != inDelimiter)
-		{
-			/*
-			*	If outStr isn't full THEN
-			*	append thisChar to it.
-			*/
-			if (outStr < endOfStrPtr)
-			{
-				*(outStr++) = thisChar;
-			} // else discard the character, the outStr is full
-			continue;
-		}
-		break;
-	}
-	*outStr = 0;	// Terminate the string
-	return(thisChar);
-}
-
 /******************************** DepthAtIndex ********************************/
 /*
 *	Returns the cut depth, the distance from the bottom of the key blade to the
@@ -26,13 +26,6 @@
 
 #include <inttypes.h>
 
-#ifdef __MACH__
-#include <stdio.h>
-#define SdFile	FILE
-#else
-class SdFile;
-#endif
-
 struct SKeySpec
 {
 	char		name[20];
@@ -114,25 +107,10 @@ public:
 	const SKeySpec&			Spec(void) const
 								{return(mSpec);}
 protected:
-	SdFile*		mFile;
 	SKeySpec	mSpec;
 	
-	char					NextChar(void);
 	uint8_t					FindKeyIndex(
 								const char*				inKey);
-	void					StripLeadingAndTrailingWhitespace(
-								char*					ioStr);
-	char					SkipWhitespaceAndHashComments(
-								char					inCurrChar);
-	char					SkipToNextLine(void);
-	char					ReadUInt32Number(
-								uint32_t&				outValue);
-	char					ReadFloatNumber(
-								float&					outValue);
-	char					ReadStr(
-								char					inDelimiter,
-								uint8_t					inMaxStrLen,
-								char*					outStr);
 };
 
 #endif /* KeySpec_h */
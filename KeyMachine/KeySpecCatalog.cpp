@@ -0,0 +1,298 @@
+/*
+*	KeySpecCatalog.cpp, Copyright Jonathan Mackey 2023
+*	Indexed binary catalog of SKeySpecs.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "KeySpecCatalog.h"
+#include "DataStream.h"
+#include <ctype.h>
+
+/******************************* KeySpecCatalog *******************************/
+KeySpecCatalog::KeySpecCatalog(
+	DataStream*	inStream)
+	: mStream(inStream), mFirstCharCount(0)
+{
+	mHeader.count = 0;
+}
+
+/************************************ Load ************************************/
+bool KeySpecCatalog::Load(void)
+{
+	if (!ReadAt(0, sizeof(SKeySpecCatalogHeader), &mHeader) ||
+		mHeader.signature != kKeySpecCatalogSignature ||
+		mHeader.version != kKeySpecCatalogVersion ||
+		mHeader.specSize != sizeof(SKeySpec))
+	{
+		mHeader.count = 0;
+	}
+	BuildFirstChars();
+	return(mHeader.count != 0);
+}
+
+/****************************** BuildFirstChars *******************************/
+/*
+*	Reads the name index once to build the table of first characters.  Each
+*	entry is the first character of a run of names and the index of the first
+*	name in that run.
+*/
+void KeySpecCatalog::BuildFirstChars(void)
+{
+	uint8_t		count = 0;
+	uint16_t	index = 0;
+	mFirstCharCount = 0;
+	for (; index < mHeader.count; index++)
+	{
+		char	thisChar;
+		if (!ReadChar(index, 0, thisChar))
+		{
+			break;
+		}
+		if (count == 0 || thisChar != mFirstChars[count-1])
+		{
+			if (count == kMaxFirstChars)
+			{
+				break;
+			}
+			mFirstChars[count] = thisChar;
+			mFirstCharStart[count] = index;
+			count++;
+		}
+	}
+	/*
+	*	If the whole name index was read THEN use the table, otherwise the
+	*	first character is found by a binary search like any other.
+	*/
+	if (index == mHeader.count)
+	{
+		mFirstCharStart[count] = index;
+		mFirstCharCount = count;
+	}
+}
+
+/********************************* FindByTag **********************************/
+/*
+*	Binary search of the tag index.  Returns true if the spec was found and
+*	read into outSpec.
+*/
+bool KeySpecCatalog::FindByTag(
+	uint16_t	inTag,
+	SKeySpec&	outSpec)
+{
+	int32_t	leftIndex = 0;
+	int32_t	rightIndex = (int32_t)mHeader.count - 1;
+	while (leftIndex <= rightIndex)
+	{
+		int32_t	current = (leftIndex + rightIndex) / 2;
+		SKeySpecCatalogTagEntry	entry;
+		if (!ReadAt(mHeader.tagIndexOffset + (current * sizeof(SKeySpecCatalogTagEntry)),
+							sizeof(SKeySpecCatalogTagEntry), &entry))
+		{
+			break;
+		}
+		if (entry.tag == inTag)
+		{
+			return(entry.specIndex < mHeader.count &&
+				ReadAt(mHeader.specsOffset + (entry.specIndex * sizeof(SKeySpec)),
+							sizeof(SKeySpec), &outSpec));
+		} else if (inTag < entry.tag)
+		{
+			rightIndex = current - 1;
+		} else
+		{
+			leftIndex = current + 1;
+		}
+	}
+	return(false);
+}
+
+/******************************** GetNameEntry ********************************/
+bool KeySpecCatalog::GetNameEntry(
+	uint16_t					inIndex,
+	SKeySpecCatalogNameEntry&	outEntry)
+{
+	return(inIndex < mHeader.count &&
+		ReadAt(mHeader.nameIndexOffset + (inIndex * sizeof(SKeySpecCatalogNameEntry)),
+							sizeof(SKeySpecCatalogNameEntry), &outEntry));
+}
+
+/******************************** NarrowByChar ********************************/
+bool KeySpecCatalog::NarrowByChar(
+	uint8_t		inPosition,
+	char		inChar,
+	uint16_t&	ioStart,
+	uint16_t&	ioEnd)
+{
+	bool	success = true;
+	inChar = tolower((uint8_t)inChar);
+	if (UseFirstChars(inPosition, ioStart, ioEnd))
+	{
+		uint8_t	i = 0;
+		for (; i < mFirstCharCount && mFirstChars[i] != inChar; i++){}
+		if (i < mFirstCharCount)
+		{
+			ioStart = mFirstCharStart[i];
+			ioEnd = mFirstCharStart[i+1];
+		} else
+		{
+			ioEnd = ioStart;
+		}
+	} else
+	{
+		uint16_t	lowerBound;
+		uint16_t	upperBound;
+		success = FindBound(inPosition, inChar, false, ioStart, ioEnd, lowerBound) &&
+					FindBound(inPosition, inChar, true, lowerBound, ioEnd, upperBound);
+		if (success)
+		{
+			ioStart = lowerBound;
+			ioEnd = upperBound;
+		}
+	}
+	return(success);
+}
+
+/********************************** NextChar **********************************/
+char KeySpecCatalog::NextChar(
+	uint8_t		inPosition,
+	char		inChar,
+	bool		inForward,
+	uint16_t	inStart,
+	uint16_t	inEnd)
+{
+	char	nextChar = 0;
+	inChar = tolower((uint8_t)inChar);
+	if (inStart < inEnd)
+	{
+		if (UseFirstChars(inPosition, inStart, inEnd))
+		{
+			if (inForward)
+			{
+				for (uint8_t i = 0; i < mFirstCharCount; i++)
+				{
+					if ((uint8_t)mFirstChars[i] > (uint8_t)inChar)
+					{
+						nextChar = mFirstChars[i];
+						break;
+					}
+				}
+			} else
+			{
+				for (uint8_t i = mFirstCharCount; i > 0; i--)
+				{
+					if (inChar == 0 ||
+						(uint8_t)mFirstChars[i-1] < (uint8_t)inChar)
+					{
+						nextChar = mFirstChars[i-1];
+						break;
+					}
+				}
+			}
+		} else
+		{
+			uint16_t	index;
+			/*
+			*	Names that end before inPosition+1 have 0 at inPosition so
+			*	they sort first and are skipped when searching forward.
+			*/
+			if (inForward)
+			{
+				if (FindBound(inPosition, inChar, true, inStart, inEnd, index) &&
+					index < inEnd)
+				{
+					ReadChar(index, inPosition, nextChar);
+				}
+			} else if (inChar == 0)
+			{
+				ReadChar(inEnd-1, inPosition, nextChar);
+			} else if (FindBound(inPosition, inChar, false, inStart, inEnd, index) &&
+				index > inStart)
+			{
+				ReadChar(index-1, inPosition, nextChar);
+			}
+		}
+	}
+	return(nextChar);
+}
+
+/********************************* FindBound **********************************/
+/*
+*	Binary search of [inStart, inEnd) of the name index for the first name
+*	whose character at inPosition is greater than (inUpper) or greater than or
+*	equal to inChar.  outIndex is inEnd if there isn't one.
+*/
+bool KeySpecCatalog::FindBound(
+	uint8_t		inPosition,
+	char		inChar,
+	bool		inUpper,
+	uint16_t	inStart,
+	uint16_t	inEnd,
+	uint16_t&	outIndex)
+{
+	bool		success = true;
+	uint16_t	leftIndex = inStart;
+	uint16_t	rightIndex = inEnd;
+	while (leftIndex < rightIndex)
+	{
+		uint16_t	current = (leftIndex + rightIndex) / 2;
+		char		thisChar;
+		if (!ReadChar(current, inPosition, thisChar))
+		{
+			success = false;
+			break;
+		}
+		if ((uint8_t)thisChar < (uint8_t)inChar ||
+			(inUpper && thisChar == inChar))
+		{
+			leftIndex = current + 1;
+		} else
+		{
+			rightIndex = current;
+		}
+	}
+	outIndex = leftIndex;
+	return(success);
+}
+
+/********************************** ReadChar **********************************/
+/*
+*	Reads the lower case character at inPosition of the name at inIndex of the
+*	name index.
+*/
+bool KeySpecCatalog::ReadChar(
+	uint16_t	inIndex,
+	uint8_t		inPosition,
+	char&		outChar)
+{
+	SKeySpecCatalogNameEntry	entry;
+	bool	success = inPosition < sizeof(entry.name) &&
+						GetNameEntry(inIndex, entry);
+	outChar = success ? tolower((uint8_t)entry.name[inPosition]) : 0;
+	return(success);
+}
+
+/*********************************** ReadAt ***********************************/
+bool KeySpecCatalog::ReadAt(
+	uint32_t	inOffset,
+	uint32_t	inLength,
+	void*		outBuffer)
+{
+	return(mStream->Seek(inOffset, DataStream::eSeekSet) &&
+		mStream->Read(inLength, outBuffer) == inLength);
+}
@@ -0,0 +1,157 @@
+/*
+*	KeySpecCatalog.h, Copyright Jonathan Mackey 2023
+*	Indexed binary catalog of SKeySpecs.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef KeySpecCatalog_h
+#define KeySpecCatalog_h
+
+#include "KeySpec.h"
+class DataStream;
+
+/*
+*	The catalog is compiled from KeySpec text files by
+*	HostTools/KMKeySpecCatalog.  File layout (little endian):
+*
+*		SKeySpecCatalogHeader
+*		SKeySpec[count]					in file order
+*		SKeySpecCatalogTagEntry[count]	sorted by tag
+*		SKeySpecCatalogNameEntry[count]	sorted by name, case insensitive
+*
+*	A spec is found by a binary search of the tag index, then only that
+*	SKeySpec is read.  The name index holds each name with its tag so a menu
+*	can be populated in name order without reading any SKeySpecs.
+*
+*	Because the name index is sorted, the names that share a prefix are
+*	contiguous.  NarrowByChar and NextChar are binary searches of the name
+*	index that support an incremental prefix search.  When the catalog is
+*	loaded a table of the first characters of the names is built so that the
+*	first character of a prefix doesn't require reading the name index.
+*/
+struct SKeySpecCatalogHeader
+{
+	uint32_t	signature;			// kKeySpecCatalogSignature
+	uint16_t	version;			// kKeySpecCatalogVersion
+	uint16_t	count;
+	uint16_t	specSize;			// sizeof(SKeySpec)
+	uint16_t	unused;
+	uint32_t	specsOffset;
+	uint32_t	tagIndexOffset;
+	uint32_t	nameIndexOffset;
+};
+
+struct SKeySpecCatalogTagEntry
+{
+	uint16_t	tag;
+	uint16_t	specIndex;
+};
+
+struct SKeySpecCatalogNameEntry
+{
+	char		name[sizeof(SKeySpec::name)];
+	uint16_t	tag;
+};
+
+static const uint32_t	kKeySpecCatalogSignature = 0x4353504B;	// "KPSC"
+static const uint16_t	kKeySpecCatalogVersion = 1;
+
+class KeySpecCatalog
+{
+public:
+							KeySpecCatalog(
+								DataStream*				inStream);
+	/*
+	*	Load: Reads and validates the header and builds the table of first
+	*	characters.  The stream must be open.
+	*	Returns true if the stream contains a valid catalog.
+	*/
+	bool					Load(void);
+	void					Unload(void)
+								{mHeader.count = 0; mFirstCharCount = 0;}
+	bool					IsLoaded(void) const
+								{return(mHeader.count != 0);}
+	uint16_t				Count(void) const
+								{return(mHeader.count);}
+	bool					FindByTag(
+								uint16_t				inTag,
+								SKeySpec&				outSpec);
+	/*
+	*	GetNameEntry: inIndex is the position in name order.
+	*/
+	bool					GetNameEntry(
+								uint16_t				inIndex,
+								SKeySpecCatalogNameEntry&	outEntry);
+	/*
+	*	NarrowByChar: The names in [ioStart, ioEnd) must share their first
+	*	inPosition characters.  The range is narrowed to the names whose
+	*	character at inPosition is inChar.  Characters are compared as lower
+	*	case, the same as the name index sort.  The range may become empty.
+	*	Returns false if the name index couldn't be read.
+	*/
+	bool					NarrowByChar(
+								uint8_t					inPosition,
+								char					inChar,
+								uint16_t&				ioStart,
+								uint16_t&				ioEnd);
+	/*
+	*	NextChar: The names in [inStart, inEnd) must share their first
+	*	inPosition characters.  Returns the first character at inPosition
+	*	after (inForward) or before inChar, in lower case.  inChar 0 returns
+	*	the first or last character.  Returns 0 if there isn't one.
+	*/
+	char					NextChar(
+								uint8_t					inPosition,
+								char					inChar,
+								bool					inForward,
+								uint16_t				inStart,
+								uint16_t				inEnd);
+protected:
+	static const uint8_t	kMaxFirstChars = 40;
+	DataStream*				mStream;
+	SKeySpecCatalogHeader	mHeader;
+	uint8_t					mFirstCharCount;	// 0 when not used
+	char					mFirstChars[kMaxFirstChars];
+	uint16_t				mFirstCharStart[kMaxFirstChars+1];
+
+	bool					ReadAt(
+								uint32_t				inOffset,
+								uint32_t				inLength,
+								void*					outBuffer);
+	bool					ReadChar(
+								uint16_t				inIndex,
+								uint8_t					inPosition,
+								char&					outChar);
+	bool					FindBound(
+								uint8_t					inPosition,
+								char					inChar,
+								bool					inUpper,
+								uint16_t				inStart,
+								uint16_t				inEnd,
+								uint16_t&				outIndex);
+	bool					UseFirstChars(
+								uint8_t					inPosition,
+								uint16_t				inStart,
+								uint16_t				inEnd) const
+								{return(inPosition == 0 && mFirstCharCount &&
+									inStart == 0 && inEnd == mHeader.count);}
+	void					BuildFirstChars(void);
+};
+
+#endif // KeySpecCatalog_h
@@ -0,0 +1,438 @@
+// Converted to 4 bit by XFont4BitConverter from MyriadPro-Regular_20.h
+// Subset font created by SubsetFontCreator
+// For subset: " ~°°……" (Height minimized)
+
+#ifndef MyriadPro_Regular_20_4b_h
+#define MyriadPro_Regular_20_4b_h
+
+#include "XFontGlyph.h"
+#include "XFont4BitDataStream.h"
+
+namespace MyriadPro_Regular_20_4b
+{
+	const FontHeader	fontHeader PROGMEM =
+	{
+		1,		// version, currently version = 1
+		0,		// oneBit, 1 = 1 bit per pixel, 0 = 8 bit (antialiased)
+		0,		// rotated, glyph data is rotated (applies to 1 bit only)
+		0,		// horizontal, addressing for rotated data, else vertical
+		0,		// monospaced, fixed width font (for this subset)
+		15,		// ascent, font in pixels
+		-5,		// descent, font in pixels
+		20,		// height, font height (ascent+descent+leading) in pixels
+		20,		// width, widest glyph advanceX within subset in pixels
+		4,		// numCharcodeRuns
+		97		// numCharCodes
+	};
+	
+	const CharcodeRun	charcodeRun[] PROGMEM = // {start, entryIndex}, ...
+	{
+		{0x0020, 0}, {0x00B0, 95}, {0x2026, 96}, {0xFFFF, 97}
+	};
+	
+	const uint16_t	glyphDataOffset[] PROGMEM =
+	{
+		0x0000, 0x0005, 0x001C, 0x0031, 0x0071, 0x00AD, 0x010E, 0x0169,
+		0x0174, 0x01A1, 0x01D0, 0x01F6, 0x020E, 0x0222, 0x022C, 0x0237,
+		0x0260, 0x02A5, 0x02B6, 0x02E7, 0x0321, 0x034C, 0x037F, 0x03C3,
+		0x03ED, 0x0438, 0x047F, 0x0491, 0x04B0, 0x04D7, 0x04EF, 0x0517,
+		0x0543, 0x05AA, 0x05F4, 0x0631, 0x066B, 0x06AB, 0x06CB, 0x06E4,
+		0x0727, 0x073D, 0x0746, 0x075F, 0x079F, 0x07AF, 0x0818, 0x084D,
+		0x08A1, 0x08CF, 0x092A, 0x0965, 0x099E, 0x09B2, 0x09DC, 0x0A28,
+		0x0AA4, 0x0AF3, 0x0B23, 0x0B58, 0x0B69, 0x0B90, 0x0BA2, 0x0BD0,
+		0x0BD7, 0x0BE4, 0x0C16, 0x0C4C, 0x0C76, 0x0CAA, 0x0CDB, 0x0CFE,
+		0x0D44, 0x0D65, 0x0D74, 0x0D91, 0x0DBE, 0x0DC7, 0x0DF8, 0x0E18,
+		0x0E52, 0x0E8B, 0x0EC1, 0x0ED7, 0x0F02, 0x0F23, 0x0F45, 0x0F78,
+		0x0FD0, 0x1008, 0x1048, 0x106F, 0x109F, 0x10A8, 0x10D5, 0x10F1,
+		0x1108, 0x1121
+	};
+	
+	const uint8_t	glyphData[] PROGMEM =
+	{
+		0x04, 0x00, 0x0F, 0x00, 0x00, 0x05, 0x01, 0x01, 0x0E, 0x03, 0xAF, 0x03,
+		0x9E, 0x52, 0x8E, 0x21, 0x7E, 0x20, 0x06, 0xE0, 0x5D, 0x03, 0x25, 0x00,
+		0xCF, 0x05, 0x8D, 0x30, 0x07, 0x01, 0x01, 0x05, 0x05, 0xF0, 0xB0, 0x0F,
+		0x0A, 0xDA, 0x00, 0xD9, 0xC9, 0x00, 0xC8, 0xB7, 0x00, 0xB7, 0x95, 0x00,
+		0x95, 0x0A, 0x00, 0x02, 0x0D, 0x0A, 0x02, 0x6B, 0x00, 0x3F, 0x00, 0x49,
+		0x90, 0x05, 0xD0, 0x4B, 0x70, 0x07, 0xB0, 0x22, 0x3D, 0x73, 0xAA, 0x31,
+		0x00, 0xCF, 0x63, 0x01, 0x2F, 0x01, 0x00, 0xD5, 0x03, 0x4F, 0x00, 0x1F,
+		0x03, 0x01, 0x13, 0x8D, 0x34, 0xF0, 0x42, 0x00, 0x4F, 0x6B, 0x02, 0xA8,
+		0x00, 0x6C, 0x04, 0xC6, 0x00, 0x8A, 0x04, 0xF0, 0x40, 0x0A, 0x80, 0x31,
+		0xF0, 0x20, 0x0C, 0x60, 0x20, 0x0A, 0x01, 0x00, 0x12, 0x08, 0x02, 0x7A,
+		0x05, 0x7B, 0x03, 0x19, 0xDF, 0x0D, 0xA2, 0x00, 0xDF, 0x08, 0x68, 0xD1,
+		0x5F, 0x05, 0x04, 0x7F, 0x04, 0x04, 0x4F, 0x0C, 0x10, 0x4A, 0xF1, 0x81,
+		0x03, 0x6D, 0xF1, 0x50, 0x47, 0xF1, 0x30, 0x45, 0xF0, 0x90, 0x5F, 0x0B,
+		0x10, 0x34, 0xF0, 0x97, 0xD8, 0x68, 0xF0, 0xD2, 0x3A, 0xDF, 0x1A, 0x20,
+		0x3A, 0x90, 0x5E, 0x60, 0x40, 0x10, 0x00, 0x02, 0x0D, 0x10, 0x00, 0x1A,
+		0xF0, 0xD5, 0x03, 0x2D, 0x10, 0x3B, 0xB2, 0x6F, 0x03, 0x02, 0xB6, 0x03,
+		0x3F, 0x04, 0x01, 0xD9, 0x01, 0x5C, 0x04, 0x5F, 0x01, 0x01, 0xBB, 0x01,
+		0xD3, 0xE5, 0x20, 0x1C, 0x90, 0x07, 0xA0, 0x52, 0xF0, 0x50, 0x1F, 0x07,
+		0x2D, 0x15, 0xDD, 0xA1, 0x01, 0xAC, 0x28, 0xD1, 0xA7, 0x3F, 0x05, 0x3D,
+		0xA0, 0x11, 0xAF, 0x0C, 0x34, 0xD0, 0x0A, 0xA0, 0x17, 0xF0, 0x10, 0x5C,
+		0x40, 0x0D, 0x70, 0x14, 0xF0, 0x20, 0x46, 0xA0, 0x1E, 0x23, 0xE4, 0x1D,
+		0x20, 0x1B, 0xA0, 0x16, 0xF0, 0x04, 0x98, 0x02, 0x4F, 0x05, 0x2D, 0x80,
+		0x33, 0xD1, 0x03, 0x6D, 0xD8, 0x01, 0x0C, 0x00, 0x01, 0x0E, 0x0D, 0x02,
+		0x5C, 0xF0, 0xC4, 0x06, 0x4F, 0x09, 0x4A, 0xF0, 0x20, 0x5B, 0xF0, 0x01,
+		0x2F, 0x07, 0x05, 0xCC, 0xE9, 0x1A, 0xF0, 0x11, 0xBF, 0x02, 0x05, 0x3F,
+		0x0B, 0xDF, 0x04, 0x06, 0x2D, 0xF0, 0xC1, 0x02, 0x75, 0x01, 0x4D, 0xAA,
+		0xF0, 0x50, 0x11, 0xF0, 0x70, 0x01, 0xDB, 0x00, 0x1C, 0xF0, 0x30, 0x05,
+		0xF0, 0x40, 0x04, 0xF0, 0x60, 0x11, 0xDD, 0x2A, 0xD0, 0x15, 0xE2, 0x00,
+		0x2D, 0xDF, 0x06, 0x01, 0x2F, 0x0C, 0x03, 0x7F, 0x11, 0x02, 0x8F, 0x0C,
+		0x66, 0xAF, 0x0A, 0xF0, 0xA0, 0x36, 0xCF, 0x0D, 0xA3, 0x00, 0x7F, 0x09,
+		0x00, 0x04, 0x01, 0x01, 0x05, 0x02, 0xF0, 0xBD, 0xAC, 0x9B, 0x79, 0x50,
+		0x06, 0x01, 0x01, 0x11, 0x05, 0x01, 0x14, 0x10, 0x19, 0xB0, 0x13, 0xF0,
+		0x30, 0x1A, 0xB0, 0x11, 0xF0, 0x60, 0x15, 0xF0, 0x20, 0x18, 0xF0, 0x02,
+		0x9D, 0x02, 0xAC, 0xE6, 0x9D, 0x02, 0x7F, 0x00, 0x24, 0xF0, 0x30, 0x2F,
+		0x07, 0x02, 0x8D, 0x02, 0x2F, 0x05, 0x02, 0x7D, 0x10, 0x06, 0x00, 0x01,
+		0x11, 0x05, 0x24, 0x02, 0x2F, 0x04, 0x02, 0x8D, 0x02, 0x2F, 0x05, 0x02,
+		0xBA, 0x02, 0x7F, 0x00, 0x24, 0xF0, 0x30, 0x13, 0xF0, 0x40, 0x12, 0xF0,
+		0x5E, 0x53, 0xF0, 0x30, 0x15, 0xF0, 0x20, 0x19, 0xD0, 0x2D, 0x90, 0x14,
+		0xF0, 0x30, 0x1A, 0xB0, 0x14, 0xF0, 0x20, 0x10, 0x08, 0x00, 0x01, 0x08,
+		0x08, 0x00, 0x1A, 0x10, 0x0A, 0x20, 0x11, 0xD7, 0x3F, 0x03, 0x02, 0x4D,
+		0x97, 0x01, 0x5B, 0x9C, 0xD8, 0xA8, 0x36, 0x4C, 0xC5, 0x65, 0x01, 0x7A,
+		0x7B, 0x02, 0x2F, 0x03, 0x1F, 0x05, 0x02, 0x20, 0x12, 0x01, 0x0C, 0x00,
+		0x04, 0x0B, 0x0C, 0x04, 0x76, 0x09, 0x1A, 0x9E, 0xF4, 0x3F, 0x91, 0x21,
+		0x33, 0x33, 0xBA, 0x33, 0x33, 0x05, 0xA9, 0x09, 0x1E, 0xD3, 0x04, 0x00,
+		0x0D, 0x06, 0x04, 0x00, 0x6B, 0x40, 0x0B, 0xF0, 0x10, 0x0D, 0xA0, 0x03,
+		0xF0, 0x40, 0x07, 0xC0, 0x11, 0x02, 0x06, 0x00, 0x09, 0x02, 0x06, 0x6F,
+		0x38, 0x25, 0x55, 0x52, 0x04, 0x01, 0x0C, 0x03, 0x03, 0x36, 0x00, 0xDF,
+		0x04, 0x9D, 0x20, 0x07, 0xFF, 0x01, 0x0F, 0x08, 0x05, 0xAB, 0x04, 0x1F,
+		0x05, 0x04, 0x6D, 0x05, 0xC8, 0x04, 0x3F, 0x03, 0x04, 0x9C, 0x05, 0xD6,
+		0x04, 0x5F, 0x01, 0x04, 0xB9, 0x04, 0x2F, 0x04, 0x04, 0x7D, 0x05, 0xD7,
+		0x04, 0x4F, 0x02, 0x04, 0xAB, 0x05, 0x73, 0x04, 0x0A, 0x00, 0x02, 0x0D,
+		0x0A, 0x02, 0x8C, 0xDA, 0x30, 0x3B, 0xF0, 0x97, 0xDF, 0x03, 0x01, 0x6F,
+		0x06, 0x01, 0x2F, 0x0B, 0x01, 0xCD, 0x03, 0xAF, 0x02, 0x1F, 0x0A, 0x03,
+		0x6F, 0x05, 0x2F, 0x08, 0x03, 0x4F, 0x06, 0x4F, 0x07, 0xE4, 0x83, 0xF0,
+		0x8E, 0x46, 0x1F, 0x0A, 0x03, 0x6F, 0x04, 0x00, 0xDD, 0x03, 0xAF, 0x02,
+		0x00, 0x7F, 0x06, 0x01, 0x2F, 0x0A, 0x01, 0x1C, 0xF0, 0x87, 0xDD, 0x30,
+		0x21, 0x9D, 0xDA, 0x20, 0x10, 0x0A, 0x02, 0x02, 0x0D, 0x05, 0x00, 0x4C,
+		0xF0, 0x6A, 0xF0, 0xDE, 0x08, 0x44, 0xE0, 0x01, 0xEE, 0x50, 0x0A, 0x00,
+		0x02, 0x0D, 0x0A, 0x01, 0x6B, 0xDD, 0xA2, 0x02, 0x9F, 0x0A, 0x8A, 0xF1,
+		0x20, 0x13, 0x20, 0x25, 0xF0, 0x90, 0x7F, 0x0C, 0xE7, 0xB0, 0x64, 0xF0,
+		0x70, 0x6D, 0xD1, 0x05, 0xAF, 0x05, 0x05, 0x8F, 0x07, 0x05, 0x9F, 0x07,
+		0x05, 0x9F, 0x07, 0x05, 0xAF, 0x0C, 0x77, 0x77, 0x71, 0x2F, 0x73, 0x0A,
+		0x00, 0x02, 0x0D, 0x09, 0x00, 0x18, 0xCF, 0x0D, 0xA2, 0x01, 0x7D, 0x97,
+		0xAF, 0x0D, 0x10, 0x01, 0x10, 0x29, 0xF0, 0x50, 0x56, 0xF0, 0x60, 0x5B,
+		0xF0, 0x20, 0x11, 0x56, 0xCF, 0x05, 0x02, 0x3F, 0x29, 0x20, 0x41, 0x5D,
+		0xF0, 0x30, 0x52, 0xF0, 0xB0, 0x6D, 0xD0, 0x54, 0xF0, 0xA0, 0x0D, 0xA8,
+		0x7A, 0xF0, 0xD2, 0x00, 0x6B, 0xDF, 0x0C, 0x81, 0x00, 0x0A, 0x00, 0x02,
+		0x0D, 0x0A, 0x04, 0x4F, 0x10, 0x51, 0xDE, 0x6A, 0xDA, 0xE4, 0x6F, 0x04,
+		0xE4, 0x2F, 0x09, 0x00, 0xE4, 0xCD, 0x1E, 0x47, 0xF0, 0x30, 0x1E, 0x23,
+		0xF0, 0x60, 0x2E, 0x2A, 0xF7, 0xC4, 0x66, 0x66, 0x6C, 0xF0, 0x65, 0x05,
+		0xAF, 0x00, 0x7E, 0xC1, 0x0A, 0x00, 0x02, 0x0D, 0x09, 0x01, 0xAF, 0x4A,
+		0x01, 0xCC, 0x77, 0x77, 0x50, 0x1D, 0x80, 0x51, 0xF0, 0x60, 0x53, 0xF0,
+		0x75, 0x30, 0x35, 0xF3, 0xD4, 0x01, 0x11, 0x00, 0x27, 0xDF, 0x04, 0x05,
+		0x4F, 0x0B, 0x06, 0xF0, 0xDE, 0x6B, 0x05, 0x8F, 0x06, 0x00, 0xDA, 0x77,
+		0xBF, 0x0B, 0x01, 0x7C, 0xDD, 0xB6, 0x01, 0x0A, 0x00, 0x02, 0x0D, 0x0A,
+		0x03, 0x27, 0xBF, 0x05, 0x03, 0x6F, 0x1B, 0x82, 0x02, 0x8F, 0x0A, 0x10,
+		0x43, 0xF0, 0xA0, 0x6A, 0xF0, 0x11, 0x42, 0x02, 0x1F, 0x0A, 0x9F, 0x2C,
+		0x30, 0x03, 0xF1, 0x93, 0x16, 0xF0, 0xD1, 0x4F, 0x0A, 0x03, 0x7F, 0x06,
+		0x3F, 0x07, 0x03, 0x4F, 0x08, 0x1F, 0x09, 0x03, 0x5F, 0x07, 0x00, 0xAF,
+		0x02, 0x02, 0xAF, 0x02, 0x00, 0x2D, 0xD8, 0x6B, 0xF0, 0x70, 0x21, 0x9D,
+		0xF0, 0xB5, 0x01, 0x0A, 0x01, 0x02, 0x0D, 0x09, 0xDF, 0x65, 0x67, 0x77,
+		0x77, 0xCF, 0x03, 0x04, 0x1F, 0x0A, 0x05, 0x7F, 0x03, 0x04, 0x1D, 0xB0,
+		0x57, 0xF0, 0x40, 0x41, 0xDC, 0x05, 0x7F, 0x04, 0x05, 0xDC, 0x05, 0x6F,
+		0x05, 0x05, 0xDD, 0x05, 0x6F, 0x06, 0x05, 0xDD, 0x05, 0x0A, 0x00, 0x02,
+		0x0D, 0x0A, 0x01, 0x2A, 0xDF, 0x0C, 0x50, 0x22, 0xDD, 0x65, 0xAF, 0x07,
+		0x01, 0x9F, 0x02, 0x02, 0xDD, 0x01, 0xBF, 0x00, 0x3A, 0xF0, 0x01, 0x7F,
+		0x06, 0x01, 0x2F, 0x0A, 0x02, 0xAF, 0x0B, 0x9F, 0x0A, 0x10, 0x25, 0xF0,
+		0xDF, 0x19, 0xE1, 0x7F, 0x07, 0x00, 0x17, 0xF0, 0xC0, 0x01, 0xF0, 0xB0,
+		0x38, 0xF0, 0x53, 0xF0, 0x90, 0x35, 0xF0, 0x71, 0xF0, 0xD0, 0x39, 0xF0,
+		0x40, 0x07, 0xF0, 0xC6, 0x59, 0xF0, 0x90, 0x25, 0xBD, 0xF0, 0xC6, 0x01,
+		0x0A, 0x00, 0x02, 0x0E, 0x0A, 0x01, 0x19, 0xDF, 0x0B, 0x40, 0x22, 0xDD,
+		0x77, 0xCF, 0x05, 0x01, 0xAF, 0x02, 0x01, 0x1D, 0xD0, 0x1F, 0x0A, 0x03,
+		0x7F, 0x04, 0x2F, 0x09, 0x03, 0x4F, 0x06, 0x00, 0xF0, 0xC0, 0x36, 0xF0,
+		0x80, 0x09, 0xF0, 0x81, 0x26, 0xF1, 0x70, 0x01, 0xAF, 0x2D, 0x9F, 0x04,
+		0x02, 0x24, 0x20, 0x0B, 0xF0, 0x10, 0x55, 0xF0, 0x80, 0x55, 0xF0, 0xD1,
+		0x01, 0x17, 0x8C, 0xF0, 0xB2, 0x02, 0x1F, 0x0D, 0xA5, 0x0D, 0x10, 0x04,
+		0x01, 0x05, 0x0A, 0x03, 0x35, 0x00, 0xDF, 0x04, 0x9D, 0x20, 0xB1, 0x35,
+		0x00, 0xDF, 0x04, 0x9D, 0x20, 0x04, 0x00, 0x05, 0x0E, 0x04, 0x00, 0x26,
+		0x10, 0x0A, 0xF0, 0x70, 0x07, 0xD4, 0x08, 0x21, 0x32, 0x00, 0x9F, 0x03,
+		0x00, 0xCD, 0x01, 0xF0, 0x90, 0x03, 0xF0, 0x30, 0x07, 0xC0, 0x11, 0x02,
+		0x0C, 0x01, 0x04, 0x0B, 0x0A, 0x07, 0x24, 0x05, 0x18, 0xF0, 0x80, 0x31,
+		0x8F, 0x0C, 0x40, 0x21, 0x7F, 0x0C, 0x40, 0x21, 0x7D, 0xC5, 0x04, 0xAF,
+		0x05, 0x06, 0x4D, 0xD6, 0x07, 0x5D, 0xD6, 0x07, 0x6D, 0xD6, 0x07, 0x6D,
+		0xD5, 0x07, 0x78, 0x0C, 0x00, 0x07, 0x06, 0x0C, 0x3F, 0x91, 0x21, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x08, 0x33, 0xF9, 0x12, 0x13, 0x33, 0x33, 0x33,
+		0x33, 0x30, 0x00, 0x0C, 0x01, 0x04, 0x0B, 0x0A, 0x51, 0x07, 0x9F, 0x08,
+		0x10, 0x65, 0xDF, 0x07, 0x10, 0x65, 0xCD, 0x71, 0x06, 0x5C, 0xD7, 0x07,
+		0x6F, 0x09, 0x04, 0x17, 0xDC, 0x40, 0x21, 0x7D, 0xC5, 0x02, 0x17, 0xDD,
+		0x50, 0x36, 0xDD, 0x60, 0x59, 0x60, 0x70, 0x08, 0x01, 0x01, 0x0E, 0x07,
+		0x6C, 0xF0, 0xDA, 0x10, 0x0A, 0xA8, 0xCF, 0x0C, 0x04, 0xDF, 0x02, 0x03,
+		0xAE, 0x31, 0xF0, 0xC0, 0x3A, 0xF0, 0x30, 0x25, 0xF0, 0x70, 0x3D, 0xD0,
+		0x32, 0xF0, 0x70, 0x33, 0xF0, 0x50, 0xA1, 0x16, 0x10, 0x38, 0xF0, 0xA0,
+		0x34, 0xD6, 0x02, 0x0F, 0x00, 0x03, 0x0E, 0x0E, 0x03, 0x17, 0xBD, 0xDA,
+		0x71, 0x04, 0x3D, 0x94, 0x11, 0x49, 0xD3, 0x02, 0x4D, 0x30, 0x55, 0xD1,
+		0x01, 0xD4, 0x01, 0x6B, 0xF0, 0xD7, 0x00, 0xA8, 0x00, 0x7A, 0x01, 0xAD,
+		0x52, 0xB9, 0x00, 0x6B, 0x00, 0xC5, 0x00, 0x5F, 0x01, 0x01, 0xD6, 0x00,
+		0x3D, 0x00, 0xF0, 0x30, 0x0C, 0x80, 0x2F, 0x03, 0x00, 0x4D, 0x2F, 0x01,
+		0x00, 0xF0, 0x40, 0x14, 0xF0, 0x10, 0x06, 0xB1, 0xF0, 0x21, 0xE2, 0xAF,
+		0x00, 0x1B, 0x60, 0x0D, 0x40, 0x0D, 0xB3, 0x89, 0xF0, 0x26, 0xD1, 0x00,
+		0x9A, 0x00, 0x4D, 0xD8, 0x00, 0x8D, 0xA2, 0x01, 0x1D, 0x50, 0xB1, 0x4D,
+		0x93, 0x10, 0x01, 0x52, 0x05, 0x18, 0xBD, 0xDD, 0x8E, 0x20, 0x0C, 0x00,
+		0x01, 0x0E, 0x0C, 0x03, 0x1F, 0x15, 0x07, 0x6F, 0x1A, 0x07, 0xBC, 0xAF,
+		0x01, 0x05, 0x1F, 0x08, 0x5F, 0x05, 0x05, 0x6F, 0x03, 0x1F, 0x0A, 0x05,
+		0xBD, 0x01, 0xBF, 0x00, 0x41, 0xF0, 0x80, 0x16, 0xF0, 0x50, 0x36, 0xF0,
+		0x30, 0x11, 0xF0, 0xA0, 0x3B, 0xF6, 0x02, 0x1F, 0x0B, 0x66, 0x66, 0xAF,
+		0x04, 0x01, 0x5F, 0x05, 0x03, 0x3F, 0x09, 0x01, 0xAF, 0x01, 0x04, 0xDF,
+		0x00, 0x01, 0xF0, 0xB0, 0x58, 0xF0, 0x45, 0xF0, 0x70, 0x54, 0xF0, 0x90,
+		0x0B, 0x01, 0x01, 0x0E, 0x0A, 0x5D, 0xF1, 0xDC, 0x71, 0x01, 0x7F, 0x08,
+		0x56, 0xAF, 0x0C, 0xE2, 0x40, 0x29, 0xF0, 0x5E, 0x55, 0xF0, 0x7E, 0x57,
+		0xF0, 0x4E, 0x31, 0x6F, 0x09, 0x01, 0xE0, 0xF3, 0xA0, 0x2E, 0x07, 0x56,
+		0xAF, 0x0C, 0x1E, 0x14, 0x02, 0x6F, 0x09, 0xE5, 0x00, 0xF0, 0xDE, 0xF1,
+		0x6F, 0x0A, 0xE1, 0x86, 0x7A, 0xF0, 0xD2, 0x00, 0x6F, 0x2D, 0xB7, 0x10,
+		0x10, 0x0C, 0x00, 0x01, 0x0E, 0x0B, 0x03, 0x3A, 0xDF, 0x0D, 0xB4, 0x01,
+		0x19, 0xF0, 0xDA, 0x88, 0xAB, 0x01, 0xAF, 0x09, 0x10, 0x55, 0xF0, 0xA0,
+		0x7D, 0xF0, 0x10, 0x62, 0xF0, 0xC0, 0x73, 0xF0, 0xA0, 0x74, 0xF0, 0x90,
+		0x72, 0xF0, 0xB0, 0x81, 0xF1, 0x10, 0x78, 0xF0, 0x90, 0x81, 0xDF, 0x08,
+		0x07, 0x2C, 0xF0, 0xDA, 0x88, 0xAA, 0x03, 0x6A, 0xDF, 0x0D, 0xC7, 0x0D,
+		0x01, 0x01, 0x0E, 0x0C, 0x5C, 0xDF, 0x1D, 0xC7, 0x10, 0x27, 0xF0, 0x96,
+		0x69, 0xBF, 0x0D, 0x6E, 0x24, 0x03, 0x4D, 0xF0, 0x3E, 0x60, 0x03, 0xF0,
+		0xDE, 0x70, 0x0A, 0xF0, 0x4E, 0x76, 0xF0, 0x7E, 0x74, 0xF0, 0x8E, 0x75,
+		0xF0, 0x7E, 0x78, 0xF0, 0x4E, 0x7C, 0xF0, 0x2E, 0x66, 0xF0, 0x90, 0x0E,
+		0x56, 0xF0, 0xD1, 0xE1, 0x96, 0x79, 0xDF, 0x0D, 0x30, 0x16, 0xDF, 0x1D,
+		0xB9, 0x50, 0x30, 0x0A, 0x01, 0x01, 0x0E, 0x09, 0x7F, 0x5C, 0x00, 0xE0,
+		0x97, 0x77, 0x76, 0xE1, 0x40, 0x5E, 0xB3, 0xF4, 0x7E, 0x19, 0x77, 0x77,
+		0x3E, 0x14, 0x05, 0xEB, 0x39, 0x77, 0x77, 0x71, 0xE0, 0xF5, 0x10, 0x0A,
+		0x01, 0x01, 0x0E, 0x08, 0x7F, 0x5C, 0xE0, 0x97, 0x77, 0x75, 0xE0, 0x40,
+		0x4E, 0x83, 0xF4, 0x5E, 0x09, 0x77, 0x77, 0x2E, 0x04, 0x04, 0xEE, 0x40,
+		0x0D, 0x00, 0x01, 0x0E, 0x0C, 0x03, 0x39, 0xDF, 0x1C, 0x71, 0x02, 0x8F,
+		0x1B, 0x88, 0xAD, 0x30, 0x1A, 0xF0, 0x91, 0x06, 0x5F, 0x0A, 0x08, 0x1C,
+		0xF0, 0x10, 0x81, 0xF0, 0xC0, 0x81, 0x3F, 0x09, 0x03, 0x46, 0x66, 0x54,
+		0xE4, 0xAF, 0x2C, 0x2F, 0x0C, 0x06, 0xDC, 0x00, 0xDF, 0x01, 0xE7, 0x7F,
+		0x09, 0xE7, 0x00, 0xCF, 0x08, 0x1E, 0x63, 0xDF, 0x0D, 0xA7, 0x7A, 0xF0,
+		0xE1, 0x00, 0x16, 0xAC, 0xF0, 0xDC, 0xA5, 0x0D, 0x01, 0x01, 0x0E, 0x0B,
+		0x7F, 0x04, 0x04, 0x3F, 0x08, 0xEF, 0x6F, 0x7E, 0x1A, 0x88, 0x88, 0x8A,
+		0xE2, 0x40, 0x43, 0xEF, 0x60, 0x05, 0x01, 0x01, 0x0E, 0x03, 0x7F, 0x04,
+		0xED, 0x40, 0x07, 0x00, 0x01, 0x0E, 0x07, 0x03, 0xBF, 0x00, 0x4E, 0xE6,
+		0xCE, 0x4D, 0xD0, 0x34, 0xF0, 0xA0, 0x08, 0x89, 0xF1, 0x20, 0x0B, 0xF0,
+		0xDB, 0x30, 0x10, 0x0B, 0x01, 0x01, 0x0E, 0x0B, 0x7F, 0x04, 0x02, 0x1D,
+		0xF0, 0x40, 0x0E, 0x4A, 0xF0, 0x60, 0x1E, 0x37, 0xF0, 0x90, 0x2E, 0x24,
+		0xF0, 0xB0, 0x3E, 0x12, 0xDD, 0x1E, 0x5C, 0xF0, 0x30, 0x4E, 0x0B, 0xF1,
+		0x2E, 0x5F, 0x07, 0xF0, 0xCE, 0x57, 0x00, 0x9F, 0x06, 0xE4, 0x40, 0x01,
+		0xDF, 0x02, 0xE5, 0x00, 0x4F, 0x0B, 0xE6, 0x00, 0xAF, 0x06, 0xE6, 0x1D,
+		0xF0, 0x2E, 0x50, 0x05, 0xF0, 0xB0, 0x00, 0x09, 0x01, 0x01, 0x0E, 0x09,
+		0x7F, 0x04, 0x05, 0xEB, 0xC1, 0x97, 0x77, 0x77, 0xE1, 0xF5, 0x00, 0x10,
+		0x01, 0x01, 0x0E, 0x0E, 0x00, 0xF1, 0x70, 0x55, 0xF1, 0x2E, 0x1C, 0x05,
+		0xAE, 0x11, 0xF0, 0xBF, 0x02, 0x03, 0x1F, 0x0A, 0xF0, 0x32, 0xF0, 0x6F,
+		0x07, 0x03, 0x6F, 0x06, 0xF0, 0x43, 0xF0, 0x5B, 0xC0, 0x3B, 0xB4, 0xF0,
+		0x54, 0xF0, 0x47, 0xF0, 0x20, 0x12, 0xF0, 0x7E, 0x06, 0x5E, 0x03, 0xF0,
+		0x70, 0x17, 0xF0, 0x23, 0xF0, 0x76, 0xF0, 0x30, 0x0D, 0xC0, 0x1C, 0xC0,
+		0x02, 0xF0, 0x87, 0xF0, 0x20, 0x08, 0xF0, 0x11, 0xF0, 0x70, 0x01, 0xF0,
+		0x98, 0xF0, 0x10, 0x03, 0xF0, 0x56, 0xF0, 0x2E, 0x1A, 0x9F, 0x00, 0x2D,
+		0xAA, 0xB0, 0x2F, 0x0B, 0xAE, 0x29, 0xDD, 0x60, 0x2D, 0xCB, 0xD0, 0x24,
+		0xF1, 0x1E, 0x3C, 0xE2, 0x00, 0xDB, 0x03, 0xCD, 0x0D, 0x01, 0x01, 0x0E,
+		0x0B, 0x7F, 0x0B, 0x05, 0xF0, 0xAE, 0x0F, 0x05, 0xE7, 0xBD, 0x1E, 0x64,
+		0xF0, 0x8E, 0x62, 0xAF, 0x02, 0xE6, 0x2F, 0x0B, 0xE6, 0x00, 0x9F, 0x05,
+		0xE6, 0x1F, 0x0D, 0x1E, 0x50, 0x06, 0xF0, 0x8E, 0x60, 0x0C, 0xF0, 0x1E,
+		0x63, 0xF0, 0x8D, 0xE5, 0x00, 0x9F, 0x0E, 0x71, 0xF1, 0xE6, 0x00, 0x6E,
+		0x00, 0x0E, 0x00, 0x01, 0x0E, 0x0E, 0x03, 0x7C, 0xF1, 0xC6, 0x05, 0x2C,
+		0xF0, 0xC8, 0x9D, 0xF0, 0xB1, 0x03, 0xCF, 0x05, 0x03, 0x9F, 0x0B, 0x02,
+		0x6F, 0x08, 0x05, 0xBF, 0x04, 0x01, 0xDF, 0x01, 0x05, 0x4F, 0x0A, 0x01,
+		0xF0, 0xC0, 0x7F, 0x0C, 0x00, 0x3F, 0x0A, 0x07, 0xDF, 0x0E, 0xB1, 0xD0,
+		0x01, 0xF0, 0xC0, 0x7F, 0x0C, 0x01, 0xDF, 0x01, 0x05, 0x4F, 0x09, 0x01,
+		0x8F, 0x07, 0x05, 0xBF, 0x03, 0x01, 0x1D, 0xF0, 0x50, 0x38, 0xF0, 0x90,
+		0x33, 0xDF, 0x0B, 0x88, 0xCF, 0x0A, 0x10, 0x41, 0x8B, 0xF0, 0xDA, 0x50,
+		0x30, 0x0B, 0x01, 0x01, 0x0E, 0x09, 0x6D, 0xF1, 0xDC, 0x71, 0x00, 0x7F,
+		0x09, 0x67, 0xBF, 0x0D, 0x1E, 0x04, 0x02, 0x7F, 0x07, 0xE4, 0x1F, 0x0B,
+		0xE4, 0x00, 0xE6, 0x5F, 0x08, 0xE0, 0x50, 0x02, 0x6D, 0xF0, 0x1E, 0x0F,
+		0x3B, 0x20, 0x0E, 0x07, 0x64, 0x20, 0x2E, 0x04, 0x05, 0xEA, 0x40, 0x0E,
+		0x00, 0x01, 0x10, 0x0E, 0x03, 0x7C, 0xF1, 0xC6, 0x05, 0x2C, 0xF0, 0xC8,
+		0x9D, 0xF0, 0xB1, 0x03, 0xCF, 0x06, 0x03, 0x9F, 0x0B, 0x02, 0x6F, 0x08,
+		0x05, 0xBF, 0x04, 0x01, 0xDF, 0x01, 0x05, 0x4F, 0x0A, 0x01, 0xF0, 0xC0,
+		0x7F, 0x0C, 0x00, 0x3F, 0x0A, 0x07, 0xDF, 0x0E, 0x19, 0xE9, 0x11, 0xF0,
+		0xB0, 0x7F, 0x0D, 0x01, 0xDF, 0x01, 0x05, 0x4F, 0x09, 0x01, 0x8F, 0x07,
+		0x05, 0xBF, 0x03, 0x01, 0x1D, 0xF0, 0x50, 0x38, 0xF0, 0x90, 0x33, 0xDF,
+		0x0B, 0x78, 0xCF, 0x09, 0x05, 0x17, 0xBF, 0x2A, 0x41, 0x08, 0x13, 0x8C,
+		0xF1, 0xC0, 0xA1, 0x26, 0x80, 0x00, 0x0B, 0x01, 0x01, 0x0E, 0x0A, 0x5D,
+		0xF1, 0xDC, 0x81, 0x01, 0x7F, 0x09, 0x66, 0xAF, 0x0D, 0x1E, 0x14, 0x02,
+		0x6F, 0x08, 0xE5, 0x00, 0xF0, 0xBE, 0x7A, 0xE5, 0x6F, 0x06, 0xE1, 0x75,
+		0x6A, 0xF0, 0xA0, 0x1E, 0x0F, 0x39, 0x02, 0xE0, 0x40, 0x02, 0x9F, 0x07,
+		0xE4, 0x01, 0xCF, 0x01, 0xE5, 0x7F, 0x05, 0xE5, 0x3F, 0x08, 0xE5, 0x00,
+		0xF0, 0xCE, 0x6A, 0xF0, 0x20, 0x0A, 0x00, 0x01, 0x0E, 0x09, 0x01, 0x29,
+		0xDF, 0x0D, 0x91, 0x00, 0x2D, 0xF0, 0x97, 0x9D, 0x30, 0x09, 0xF0, 0x30,
+		0x5C, 0xD0, 0x6B, 0xF0, 0x30, 0x55, 0xF0, 0xD6, 0x05, 0x5F, 0x1D, 0x60,
+		0x41, 0x7D, 0xF0, 0xC1, 0x05, 0x9F, 0x09, 0x06, 0xDD, 0xE8, 0x12, 0x03,
+		0x3F, 0x0A, 0x00, 0xF0, 0xC9, 0x79, 0xF0, 0xD2, 0x00, 0x6B, 0xDF, 0x0C,
+		0x91, 0x00, 0x0A, 0xFF, 0x01, 0x0E, 0x0B, 0x00, 0xF9, 0x10, 0x07, 0x77,
+		0x7F, 0x0D, 0x77, 0x77, 0x04, 0xDC, 0x08, 0x1E, 0xAE, 0x10, 0x0D, 0x01,
+		0x01, 0x0E, 0x0B, 0x7F, 0x04, 0x04, 0x5F, 0x07, 0xEB, 0xA1, 0x6F, 0x06,
+		0x5F, 0x06, 0x04, 0x7F, 0x03, 0x3F, 0x0A, 0x04, 0xBF, 0x01, 0x00, 0xCF,
+		0x03, 0x02, 0x4F, 0x09, 0x01, 0x3F, 0x19, 0x7A, 0xF0, 0xD1, 0x02, 0x2A,
+		0xDF, 0x0C, 0x81, 0x01, 0x0B, 0x00, 0x01, 0x0E, 0x0C, 0xCF, 0x02, 0x05,
+		0xCF, 0x01, 0x7F, 0x06, 0x04, 0x2F, 0x0A, 0x00, 0x2F, 0x0B, 0x04, 0x7F,
+		0x05, 0x01, 0xCF, 0x01, 0x03, 0xCF, 0x01, 0x01, 0x8F, 0x05, 0x02, 0x2F,
+		0x0A, 0x02, 0x3F, 0x09, 0x02, 0x7F, 0x05, 0x03, 0xDD, 0x02, 0xCF, 0x00,
+		0x49, 0xF0, 0x30, 0x01, 0xF0, 0x90, 0x44, 0xF0, 0x70, 0x06, 0xF0, 0x40,
+		0x5D, 0xB0, 0x0A, 0xD0, 0x69, 0xF0, 0x1F, 0x09, 0x06, 0x5F, 0x09, 0xF0,
+		0x40, 0x61, 0xF1, 0xD0, 0x81, 0xAF, 0x08, 0x04, 0x11, 0x00, 0x01, 0x0E,
+		0x11, 0x9F, 0x03, 0x03, 0x7F, 0x09, 0x03, 0x2F, 0x09, 0x5F, 0x07, 0x03,
+		0xBF, 0x0D, 0x03, 0x6F, 0x05, 0x1F, 0x0A, 0x03, 0xF0, 0xCF, 0x01, 0x02,
+		0xAF, 0x01, 0x00, 0xDD, 0x02, 0x3F, 0x07, 0xF0, 0x40, 0x2D, 0xC0, 0x19,
+		0xF0, 0x20, 0x17, 0xF0, 0x1F, 0x08, 0x01, 0x3F, 0x08, 0x01, 0x5F, 0x05,
+		0x01, 0xBB, 0x00, 0xDB, 0x01, 0x6F, 0x04, 0x01, 0x2F, 0x09, 0x01, 0xF0,
+		0x80, 0x09, 0xF0, 0x01, 0xAF, 0x00, 0x3D, 0xC0, 0x03, 0xF0, 0x40, 0x06,
+		0xF0, 0x30, 0x0D, 0xB0, 0x39, 0xF0, 0x17, 0xF0, 0x01, 0x2F, 0x06, 0x2F,
+		0x06, 0x03, 0x6F, 0x04, 0xBB, 0x02, 0xD9, 0x6F, 0x02, 0x03, 0x2F, 0x07,
+		0xD7, 0x02, 0xAC, 0x9D, 0x05, 0xDC, 0xF0, 0x30, 0x27, 0xF0, 0xC9, 0x05,
+		0xAF, 0x0D, 0x03, 0x4F, 0x15, 0x05, 0x6F, 0x0A, 0x04, 0xF1, 0x10, 0x20,
+		0x0B, 0x00, 0x01, 0x0E, 0x0B, 0x2F, 0x0D, 0x10, 0x37, 0xF0, 0x80, 0x07,
+		0xF0, 0x70, 0x21, 0xF0, 0xD1, 0x00, 0x1D, 0xF0, 0x10, 0x19, 0xF0, 0x50,
+		0x25, 0xF0, 0x80, 0x02, 0xF0, 0xB0, 0x4C, 0xF0, 0x2A, 0xF0, 0x20, 0x43,
+		0xF0, 0xBF, 0x08, 0x06, 0xAF, 0x0D, 0x10, 0x6B, 0xF1, 0x20, 0x55, 0xF0,
+		0x9F, 0x0A, 0x05, 0xDD, 0x00, 0xAF, 0x04, 0x03, 0x7F, 0x05, 0x00, 0x2F,
+		0x0D, 0x02, 0x1F, 0x0C, 0x02, 0x7F, 0x07, 0x01, 0x9F, 0x04, 0x02, 0x1D,
+		0xF0, 0x13, 0xF0, 0xB0, 0x46, 0xF0, 0x90, 0x0B, 0x00, 0x01, 0x0E, 0x0B,
+		0x7F, 0x07, 0x04, 0x7F, 0x08, 0x1D, 0xD1, 0x02, 0x1D, 0xD1, 0x00, 0x6F,
+		0x07, 0x02, 0x7F, 0x06, 0x02, 0xDD, 0x10, 0x1D, 0xC0, 0x36, 0xF0, 0x60,
+		0x06, 0xF0, 0x40, 0x4C, 0xD0, 0x0D, 0xB0, 0x55, 0xF0, 0xAF, 0x02, 0x06,
+		0xCF, 0x09, 0x07, 0x7F, 0x04, 0xE9, 0x70, 0x0B, 0x00, 0x01, 0x0E, 0x0B,
+		0x00, 0xBF, 0x75, 0x00, 0x57, 0x77, 0x77, 0x8F, 0x12, 0x06, 0xE0, 0x60,
+		0x63, 0xF0, 0xB0, 0x7D, 0xF0, 0x20, 0x68, 0xF0, 0x70, 0x63, 0xF0, 0xC0,
+		0x7C, 0xF0, 0x20, 0x67, 0xF0, 0x70, 0x62, 0xF0, 0xC0, 0x7C, 0xF0, 0x30,
+		0x67, 0xF0, 0x80, 0x62, 0xF1, 0x77, 0x77, 0x77, 0x73, 0x6F, 0x81, 0x70,
+		0x06, 0x01, 0x01, 0x11, 0x05, 0x6F, 0x24, 0xE0, 0x22, 0x00, 0xE0, 0x02,
+		0xEC, 0x71, 0x1E, 0x1F, 0x14, 0x07, 0x00, 0x01, 0x0F, 0x07, 0xC9, 0x04,
+		0x6D, 0x04, 0x1F, 0x05, 0x04, 0xAA, 0x04, 0x4F, 0x01, 0x04, 0xD7, 0x04,
+		0x8C, 0x04, 0x2F, 0x03, 0x04, 0xC9, 0x04, 0x6D, 0x04, 0x1F, 0x05, 0x04,
+		0xAA, 0x04, 0x4F, 0x01, 0x04, 0xD7, 0x04, 0x56, 0x06, 0x00, 0x01, 0x11,
+		0x05, 0x9F, 0x20, 0x01, 0x26, 0xE0, 0x01, 0x5E, 0xC7, 0x11, 0x6E, 0x09,
+		0xF2, 0x00, 0x0C, 0x01, 0x02, 0x0A, 0x0A, 0x03, 0xDC, 0x06, 0x5D, 0xF0,
+		0x40, 0x5C, 0x79, 0xA0, 0x44, 0xF0, 0x12, 0xF0, 0x20, 0x3A, 0x90, 0x1B,
+		0x90, 0x22, 0xF0, 0x30, 0x14, 0xF0, 0x10, 0x19, 0xC0, 0x3D, 0x70, 0x01,
+		0xF0, 0x50, 0x37, 0xD0, 0x07, 0xD0, 0x41, 0xF0, 0x63, 0x20, 0x53, 0x20,
+		0x0A, 0x00, 0x11, 0x01, 0x0A, 0xF9, 0x10, 0x06, 0x00, 0x01, 0x03, 0x05,
+		0x3D, 0x80, 0x26, 0xF0, 0x30, 0x28, 0xC0, 0x00, 0x0A, 0x00, 0x05, 0x0A,
+		0x09, 0x00, 0x29, 0xDF, 0x0C, 0x80, 0x26, 0xB6, 0x6A, 0xF0, 0x90, 0x6B,
+		0xF0, 0x10, 0x42, 0x9F, 0x03, 0x01, 0x6C, 0xF3, 0x40, 0x09, 0xF0, 0x83,
+		0x17, 0xE0, 0x1F, 0x0A, 0x02, 0xE1, 0x4F, 0x09, 0x02, 0xCE, 0x01, 0xDF,
+		0x08, 0x6C, 0xDF, 0x05, 0x00, 0x3B, 0xF0, 0xC7, 0x4F, 0x06, 0x0B, 0x01,
+		0x00, 0x0F, 0x0A, 0x8F, 0x03, 0x06, 0xE9, 0x56, 0xBF, 0x0C, 0x6E, 0x2A,
+		0xD7, 0x8D, 0xF0, 0x8E, 0x1D, 0x10, 0x11, 0xDF, 0x02, 0xE0, 0x60, 0x36,
+		0xF0, 0x6E, 0x03, 0x03, 0x3F, 0x08, 0xEA, 0x15, 0x03, 0x6F, 0x05, 0xE0,
+		0xD0, 0x21, 0xDD, 0x19, 0xF0, 0xBC, 0x78, 0xDF, 0x05, 0x00, 0x9D, 0x18,
+		0xCF, 0x0B, 0x40, 0x10, 0x09, 0x00, 0x05, 0x0A, 0x09, 0x02, 0x6B, 0xDF,
+		0x0C, 0x30, 0x1B, 0xF0, 0xB7, 0x7A, 0x20, 0x08, 0xF0, 0x70, 0x5F, 0x0D,
+		0x05, 0x2F, 0x09, 0x05, 0x3E, 0x60, 0x0F, 0x0C, 0x06, 0xAF, 0x07, 0x05,
+		0x1D, 0xF0, 0xB7, 0x7A, 0x20, 0x11, 0x8C, 0xF0, 0xDB, 0x20, 0x0B, 0x00,
+		0x00, 0x0F, 0x0A, 0x07, 0xF0, 0xCE, 0x85, 0x19, 0xDD, 0xA2, 0xE1, 0x1D,
+		0xF0, 0x97, 0xAD, 0xE1, 0x9F, 0x05, 0x02, 0x9E, 0x1F, 0x0C, 0x03, 0x1E,
+		0x02, 0xF0, 0x90, 0x4E, 0x03, 0xE7, 0x1F, 0x0C, 0x03, 0x1E, 0x00, 0x0B,
+		0xF0, 0x40, 0x29, 0xE1, 0x2F, 0x19, 0x7A, 0xCC, 0xE0, 0x00, 0x2A, 0xDD,
+		0xA1, 0xBD, 0x0A, 0x00, 0x05, 0x0A, 0x0A, 0x01, 0x19, 0xCF, 0x0B, 0x50,
+		0x21, 0xDD, 0x65, 0xBF, 0x05, 0x01, 0x9F, 0x01, 0x02, 0xCD, 0x01, 0xF0,
+		0x90, 0x37, 0xF0, 0x32, 0xF7, 0x43, 0xF0, 0xA4, 0x44, 0x44, 0x41, 0x1E,
+		0x00, 0x7A, 0xF0, 0x30, 0x62, 0xDF, 0x09, 0x66, 0x96, 0x02, 0x19, 0xCF,
+		0x0D, 0xC5, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x07, 0x01, 0x18, 0xDF, 0x07,
+		0x01, 0x9F, 0x0A, 0x74, 0x00, 0x1F, 0x0B, 0x03, 0x4F, 0x08, 0x03, 0x5F,
+		0x06, 0x02, 0xBF, 0x3B, 0x00, 0x49, 0xF0, 0x95, 0x40, 0x16, 0xF0, 0x60,
+		0x3E, 0xE5, 0x0B, 0x00, 0x05, 0x0E, 0x0A, 0x01, 0x19, 0xDF, 0x0B, 0x2C,
+		0xC0, 0x01, 0xDF, 0x09, 0x7A, 0xDD, 0xB0, 0x09, 0xF0, 0x50, 0x2A, 0xF0,
+		0xE0, 0xF0, 0xC0, 0x32, 0xE0, 0x2F, 0x09, 0x04, 0xE0, 0x3E, 0x71, 0xF0,
+		0xC0, 0x32, 0xE0, 0x00, 0xBF, 0x04, 0x02, 0xAE, 0x13, 0xF1, 0x86, 0xAC,
+		0xE1, 0x00, 0x2A, 0xDD, 0x91, 0xF0, 0xA0, 0x63, 0xF0, 0x80, 0x69, 0xF0,
+		0x30, 0x02, 0xD8, 0x67, 0xBF, 0x08, 0x01, 0x29, 0xDF, 0x0D, 0xB5, 0x01,
+		0x0B, 0x01, 0x00, 0x0F, 0x09, 0x8F, 0x03, 0x05, 0xED, 0x46, 0xDF, 0x0B,
+		0x2E, 0x1A, 0xC8, 0xAF, 0x0D, 0x1E, 0x0C, 0x02, 0x8F, 0x06, 0xE0, 0x50,
+		0x22, 0xF0, 0x9E, 0x03, 0x02, 0x1F, 0x0A, 0xEB, 0x50, 0x05, 0x01, 0x01,
+		0x0E, 0x03, 0x7D, 0x29, 0xF0, 0x40, 0x01, 0x03, 0x8F, 0x03, 0xE9, 0x30,
+		0x05, 0xFF, 0x01, 0x12, 0x05, 0x01, 0x4D, 0x50, 0x16, 0xF0, 0x70, 0x21,
+		0x07, 0x5F, 0x07, 0xEA, 0x55, 0x01, 0x7F, 0x04, 0x01, 0xCF, 0x01, 0x6C,
+		0xF0, 0x70, 0x0B, 0xC5, 0x01, 0x09, 0x01, 0x00, 0x0F, 0x09, 0x8F, 0x03,
+		0x05, 0xEF, 0x47, 0xF0, 0x9E, 0x35, 0xF0, 0xA0, 0x1E, 0x13, 0xF0, 0xB0,
+		0x2E, 0x04, 0xDC, 0x1E, 0x3D, 0xF0, 0x90, 0x3E, 0x0C, 0xBF, 0x05, 0xE3,
+		0x31, 0xDD, 0x2E, 0x30, 0x05, 0xF0, 0xBE, 0x40, 0x09, 0xF0, 0x7E, 0x41,
+		0xDF, 0x03, 0x05, 0x01, 0x00, 0x0F, 0x03, 0x8F, 0x03, 0xE8, 0x50, 0x11,
+		0x01, 0x05, 0x0A, 0x0F, 0x9D, 0x00, 0x9D, 0xF0, 0x90, 0x01, 0x9D, 0xD9,
+		0x10, 0x09, 0xF0, 0xAB, 0x8C, 0xF0, 0x8B, 0xC8, 0xCF, 0x08, 0x00, 0x8F,
+		0x0C, 0x02, 0xDF, 0x0B, 0x02, 0xDF, 0x0E, 0x14, 0x02, 0x8F, 0x05, 0x02,
+		0x8F, 0x02, 0xE0, 0x30, 0x27, 0xF0, 0x30, 0x27, 0xF0, 0x4E, 0x99, 0x10,
+		0x0B, 0x01, 0x05, 0x0A, 0x09, 0x9F, 0x00, 0x08, 0xDF, 0x0B, 0x20, 0x0E,
+		0x09, 0xC8, 0xAF, 0x0D, 0x18, 0xF0, 0xD0, 0x28, 0xF0, 0x6E, 0x05, 0x02,
+		0x2F, 0x09, 0xE0, 0x30, 0x21, 0xF0, 0xAE, 0xB5, 0x0B, 0x00, 0x05, 0x0A,
+		0x0B, 0x01, 0x18, 0xCF, 0x0C, 0x81, 0x02, 0x1D, 0xF0, 0x96, 0x9F, 0x0D,
+		0x10, 0x19, 0xF0, 0x50, 0x26, 0xF0, 0x90, 0x1F, 0x0C, 0x04, 0xDF, 0x00,
+		0x02, 0xF0, 0x90, 0x4A, 0xF0, 0x23, 0xE8, 0x10, 0x0F, 0x0C, 0x04, 0xDD,
+		0x01, 0xAF, 0x05, 0x02, 0x6F, 0x09, 0x01, 0x1D, 0xF0, 0x86, 0x9F, 0x0C,
+		0x10, 0x21, 0x9D, 0xF0, 0xC7, 0x02, 0x0B, 0x01, 0x05, 0x0E, 0x0A, 0x9F,
+		0x00, 0x06, 0xBF, 0x0C, 0x50, 0x1E, 0x08, 0xD7, 0x8D, 0xF0, 0x70, 0x08,
+		0xF0, 0xD1, 0x01, 0x1D, 0xF0, 0x2E, 0x05, 0x03, 0x6F, 0x06, 0xE0, 0x30,
+		0x33, 0xF0, 0x8E, 0xA1, 0x40, 0x36, 0xF0, 0x5E, 0x0C, 0x02, 0x1D, 0xF0,
+		0x1E, 0x1C, 0x77, 0xDF, 0x06, 0x00, 0xE0, 0x38, 0xDF, 0x0B, 0x40, 0x1E,
+		0x10, 0x6E, 0xC3, 0x0B, 0x00, 0x05, 0x0E, 0x0A, 0x01, 0x19, 0xDD, 0xA2,
+		0xCD, 0x00, 0x1D, 0xF0, 0xA7, 0xAD, 0xDC, 0x00, 0x9F, 0x05, 0x02, 0x9F,
+		0x0E, 0x0F, 0x0C, 0x03, 0x1E, 0x02, 0xF0, 0x90, 0x4E, 0x03, 0xE7, 0x1F,
+		0x0C, 0x03, 0x1E, 0x00, 0x0B, 0xF0, 0x40, 0x2A, 0xE1, 0x2F, 0x19, 0x7B,
+		0xCE, 0x10, 0x02, 0xAD, 0xD9, 0x1E, 0x20, 0x5E, 0xE3, 0x07, 0x01, 0x05,
+		0x0A, 0x06, 0x9D, 0x00, 0x9F, 0x03, 0x9F, 0x08, 0xF0, 0xB2, 0x8F, 0x0D,
+		0x10, 0x1E, 0x07, 0x02, 0xE0, 0x3E, 0xF3, 0x08, 0x00, 0x05, 0x0A, 0x08,
+		0x01, 0x7D, 0xF0, 0xD6, 0x01, 0x8F, 0x09, 0x68, 0xE1, 0xDD, 0x05, 0xCF,
+		0x05, 0x04, 0x3D, 0xF0, 0xC4, 0x03, 0x17, 0xDF, 0x07, 0x04, 0x1D, 0xF0,
+		0x05, 0xBF, 0x01, 0x00, 0xC7, 0x58, 0xF0, 0xA0, 0x01, 0x9D, 0xF0, 0xD8,
+		0x10, 0x00, 0x07, 0x00, 0x02, 0x0D, 0x07, 0x00, 0x17, 0x60, 0x32, 0xF0,
+		0x9E, 0x81, 0xAF, 0x41, 0x37, 0xF0, 0xB5, 0x50, 0x12, 0xF0, 0x90, 0x3E,
+		0xA3, 0x1F, 0x0B, 0x04, 0xDF, 0x09, 0x70, 0x23, 0xCF, 0x0D, 0x00, 0x0B,
+		0x01, 0x05, 0x0A, 0x09, 0x9F, 0x02, 0x02, 0x3F, 0x08, 0xEC, 0x43, 0xE4,
+		0x7F, 0x04, 0x02, 0x4E, 0x05, 0xF0, 0x90, 0x2C, 0xE0, 0x1D, 0xF0, 0xA8,
+		0xCA, 0xF0, 0x90, 0x02, 0xBF, 0x0D, 0x80, 0x0E, 0x00, 0x0A, 0x00, 0x05,
+		0x0A, 0x0A, 0x9F, 0x04, 0x03, 0x9F, 0x03, 0x3F, 0x09, 0x03, 0xDD, 0x01,
+		0xCF, 0x00, 0x24, 0xF0, 0x70, 0x17, 0xF0, 0x40, 0x19, 0xF0, 0x10, 0x12,
+		0xF0, 0xA0, 0x1D, 0xB0, 0x3B, 0xF0, 0x00, 0x4F, 0x05, 0x03, 0x5F, 0x04,
+		0x9D, 0x04, 0x1F, 0x09, 0xD8, 0x05, 0x9F, 0x13, 0x05, 0x4F, 0x0C, 0x03,
+		0x0F, 0x00, 0x05, 0x0A, 0x0F, 0x7F, 0x04, 0x02, 0x8F, 0x04, 0x02, 0x7F,
+		0x04, 0x3F, 0x08, 0x02, 0xCF, 0x09, 0x02, 0xBF, 0x00, 0x1D, 0xC0, 0x12,
+		0xF0, 0xAD, 0x01, 0x1F, 0x0A, 0x01, 0x9F, 0x01, 0x00, 0x6D, 0x3F, 0x03,
+		0x00, 0x4F, 0x05, 0x01, 0x5F, 0x04, 0x00, 0xBA, 0x00, 0xF0, 0x70, 0x08,
+		0xF0, 0x10, 0x11, 0xF0, 0x81, 0xF0, 0x50, 0x0A, 0xC0, 0x0C, 0xA0, 0x3B,
+		0xB4, 0xF0, 0x10, 0x06, 0xF0, 0x1F, 0x06, 0x03, 0x7F, 0x09, 0xB0, 0x11,
+		0xF0, 0x8F, 0x01, 0x03, 0x3F, 0x16, 0x02, 0xCF, 0x0B, 0x05, 0xDF, 0x01,
+		0x02, 0x7F, 0x07, 0x02, 0x09, 0x00, 0x05, 0x0A, 0x0A, 0x5F, 0x09, 0x02,
+		0x5F, 0x09, 0x01, 0xAF, 0x04, 0x00, 0x1D, 0xD1, 0x01, 0x1D, 0xD0, 0x08,
+		0xF0, 0x30, 0x35, 0xF0, 0x9F, 0x08, 0x05, 0xAF, 0x0D, 0x06, 0xCF, 0x12,
+		0x04, 0x7F, 0x06, 0xF0, 0xB0, 0x33, 0xF0, 0xA0, 0x08, 0xF0, 0x50, 0x2C,
+		0xF0, 0x10, 0x01, 0xDD, 0x10, 0x08, 0xF0, 0x60, 0x25, 0xF0, 0xA0, 0x00,
+		0x09, 0x00, 0x05, 0x0F, 0x0A, 0x9F, 0x04, 0x03, 0xBF, 0x02, 0x3F, 0x0A,
+		0x02, 0x2F, 0x0B, 0x01, 0xCF, 0x01, 0x01, 0x6F, 0x05, 0x01, 0x6F, 0x06,
+		0x01, 0xCD, 0x02, 0x1F, 0x0B, 0x00, 0x2F, 0x08, 0x03, 0x9F, 0x02, 0x7F,
+		0x03, 0x03, 0x3F, 0x07, 0xBC, 0x05, 0xCC, 0xF0, 0x60, 0x56, 0xF1, 0x10,
+		0x53, 0xF0, 0x90, 0x6A, 0xF0, 0x20, 0x58, 0xF0, 0x80, 0x42, 0xCF, 0x0B,
+		0x05, 0x1D, 0x80, 0x82, 0x09, 0x00, 0x05, 0x0A, 0x09, 0x4F, 0x62, 0x26,
+		0x66, 0x68, 0xF0, 0xC0, 0x41, 0xCF, 0x02, 0x04, 0x9F, 0x05, 0x04, 0x5F,
+		0x09, 0x04, 0x2F, 0x0D, 0x10, 0x4C, 0xF0, 0x30, 0x48, 0xF0, 0x60, 0x44,
+		0xF0, 0xD6, 0x66, 0x66, 0x1A, 0xF6, 0x30, 0x06, 0x00, 0x01, 0x11, 0x06,
+		0x01, 0x3C, 0xF0, 0x30, 0x1D, 0xB3, 0x01, 0x1F, 0x05, 0x02, 0xE0, 0x40,
+		0x3F, 0x06, 0x03, 0xD7, 0xE3, 0x60, 0x24, 0xF0, 0x30, 0x17, 0xF0, 0x60,
+		0x35, 0xF0, 0x30, 0x3D, 0x6E, 0x37, 0x03, 0xF0, 0x60, 0x21, 0xF0, 0x4E,
+		0x35, 0x03, 0xDC, 0x30, 0x23, 0xCF, 0x03, 0x05, 0x01, 0x00, 0x14, 0x03,
+		0x4F, 0x01, 0xEF, 0x60, 0x06, 0x00, 0x01, 0x11, 0x06, 0x7D, 0x91, 0x01,
+		0x14, 0xF0, 0x80, 0x3A, 0xB0, 0x39, 0xE3, 0xBA, 0x03, 0xC9, 0xE3, 0x80,
+		0x38, 0xD2, 0x03, 0xBF, 0x02, 0x01, 0x8D, 0x20, 0x2C, 0x80, 0x3C, 0x90,
+		0x3B, 0xA0, 0x39, 0xB0, 0x3A, 0xE1, 0x15, 0xF0, 0x80, 0x17, 0xD9, 0x10,
+		0x10, 0x0C, 0x00, 0x07, 0x04, 0x0C, 0x01, 0x24, 0x10, 0x75, 0xF2, 0x81,
+		0x01, 0x5D, 0x01, 0xD9, 0x17, 0xDF, 0x09, 0x6C, 0xB0, 0x1F, 0x04, 0x01,
+		0x16, 0xCF, 0x0C, 0x20, 0x00, 0x06, 0x00, 0x01, 0x05, 0x06, 0x00, 0x5D,
+		0xDA, 0x12, 0xF0, 0x30, 0x0A, 0x96, 0xB0, 0x14, 0xC3, 0xF0, 0x31, 0xA9,
+		0x00, 0x6D, 0xD9, 0x10, 0x14, 0x02, 0x0C, 0x03, 0x10, 0x26, 0x10, 0x34,
+		0x40, 0x31, 0x62, 0xBF, 0x06, 0x02, 0x1F, 0x11, 0x02, 0x6F, 0x0B, 0x7D,
+		0x30, 0x3C, 0xC0, 0x33, 0xD7
+	};
+	
+	// Usage: Copy the 3 commented lines to your code, removing the comments.
+	//#include "XFont.h"
+	//XFont xFont;
+	//#include "MyriadPro-Regular_20_4b.h"
+	
+	// Leave the next 3 lines here, as is.
+	DataStream_P	dataStream(glyphData, sizeof(glyphData));
+	XFont4BitDataStream xFontDataStream(&xFont, &dataStream);
+	XFont::Font font(&fontHeader, charcodeRun, glyphDataOffset, &xFontDataStream);
+	
+	// The display needs to be set before using xFont.  This only needs
+	// to be done once at the beginning of the program.
+	// Use xFont.SetDisplay(&display, &MyriadPro_Regular_20_4b::font); to do this.
+	// To change to this font anywhere after setting the display,
+	// use: xFont.SetFont(&MyriadPro_Regular_20_4b::font);
+}
+
+#endif // MyriadPro_Regular_20_4b_h
+
@@ -0,0 +1 @@
+-DSPI_DRIVER_SELECT=3
@@ -23,13 +23,15 @@
 
 #include "Arduino.h"
 #include "AT24C.h"
+#include "I2CQueue.h"
 #include <Wire.h>
 
 /*********************************** AT24C ************************************/
 AT24C::AT24C(
-	uint8_t	inDeviceAddress,
-	uint8_t	inCapacity)
-	: mDeviceAddress(inDeviceAddress)
+	I2CQueue*	inQueue,
+	uint8_t		inDeviceAddress,
+	uint8_t		inCapacity)
+	: mQueue(inQueue), mDeviceAddress(inDeviceAddress)
 #ifdef DEBUG_AT24C
 		, mMaxWaitTime(0)
 #endif
@@ -62,35 +64,40 @@ uint16_t AT24C::Read(
 	uint16_t	inLength,
 	uint8_t*	outBuffer)
 {
-	/*
-	*	Setup the AT24C to inDataAddress
-	*/
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(inDataAddress >> 8);
-	Wire.write(inDataAddress & 0xFF);
-	Wire.endTransmission(true);
-	
-	uint16_t	bytesRead = 0;
+	I2CTransaction	transaction;
 	uint16_t	bytes2Read = inLength;
 	while (bytes2Read)
 	{
-		// The most you can read/request from Wire is 32 bytes.
-		bytesRead = Wire.requestFrom(mDeviceAddress, (uint8_t)(bytes2Read >= 32 ? 32 : bytes2Read), (uint8_t)true);
-		if (bytesRead > 0)
-		{
-			bytes2Read -= bytesRead;
-			for (uint8_t i = bytesRead; i != 0; i--)
-			{
-				*(outBuffer++) = (uint8_t)Wire.read();
-			}
-		} else
+		uint16_t	bytesRead = QueueRead(transaction, inDataAddress, bytes2Read, outBuffer);
+		if (!mQueue->WaitFor(&transaction))
 		{
 			return(0);
 		}
+		inDataAddress += bytesRead;
+		outBuffer += bytesRead;
+		bytes2Read -= bytesRead;
 	}
 	return(inLength);
 }
 
+/********************************* QueueRead **********************************/
+uint16_t AT24C::QueueRead(
+	I2CTransaction&	ioTransaction,
+	uint16_t		inDataAddress,
+	uint16_t		inLength,
+	uint8_t*		outBuffer)
+{
+	// The most you can read/request from Wire is 32 bytes.
+	uint8_t	bytes2Read = inLength >= 32 ? 32 : inLength;
+	/*
+	*	The AT24C doesn't respond while completing a write so the read also
+	*	waits till ready.
+	*/
+	ioTransaction.SetRead(mDeviceAddress, inDataAddress, 2, outBuffer, bytes2Read, true);
+	mQueue->Append(&ioTransaction);
+	return(bytes2Read);
+}
+
 /******************************* WaitTillReady ********************************/
 /*
 *	Waits till ready or a timeout occurs, whichever occurs first.
@@ -121,11 +128,41 @@ bool AT24C::WaitTillReady(void)
 	return(false);
 }
 
+/********************************** IsReady ***********************************/
+bool AT24C::IsReady(void)
+{
+	Wire.beginTransmission(mDeviceAddress);
+	return(Wire.endTransmission(true) == 0);
+}
+
 /*********************************** Write ************************************/
 uint16_t AT24C::Write(
 	uint16_t		inDataAddress,
 	uint16_t		inLength,
 	const uint8_t*	inBuffer)
+{
+	I2CTransaction	transaction;
+	uint16_t	bytesLeft2Write = inLength;
+	while (bytesLeft2Write)
+	{
+		uint16_t	bytesWritten = QueueWrite(transaction, inDataAddress, bytesLeft2Write, inBuffer);
+		if (!mQueue->WaitFor(&transaction))
+		{
+			return(0);
+		}
+		inBuffer += bytesWritten;
+		inDataAddress += bytesWritten;
+		bytesLeft2Write -= bytesWritten;
+	}
+	return(inLength);
+}
+
+/********************************* QueueWrite *********************************/
+uint16_t AT24C::QueueWrite(
+	I2CTransaction&	ioTransaction,
+	uint16_t		inDataAddress,
+	uint16_t		inLength,
+	const uint8_t*	inBuffer)
 {
 	/*
 	*	Constraints:
@@ -139,49 +176,12 @@ uint16_t AT24C::Write(
 	// mPageSize -1 results in one of 0x1F, 0x3F, 0x7F, 0xFF.  This value is
 	// used as a mask to determine the bytes left in the current page.
 	uint16_t	bytesLeftInPage = mPageSize - (inDataAddress & (mPageSize -1));
-	uint16_t	bytesLeft2Write = inLength;
-	uint16_t	bytes2Write;
-	while (WaitTillReady() &&
-		bytesLeft2Write)
+	uint16_t	bytes2Write = bytesLeftInPage > 30 ? 30 : bytesLeftInPage;
+	if (bytes2Write > inLength)
 	{
-		bytes2Write = bytesLeftInPage > 30 ? 30 : bytesLeftInPage;
-		Wire.beginTransmission(mDeviceAddress);
-		Wire.write(inDataAddress >> 8);
-		Wire.write(inDataAddress & 0xFF);
-		if (bytes2Write > bytesLeft2Write)
-		{
-			bytes2Write = bytesLeft2Write;
-		}
-		Wire.write(inBuffer, bytes2Write);
-		inBuffer += bytes2Write;
-		inDataAddress += bytes2Write;
-		bytesLeft2Write -= bytes2Write;
-		bytesLeftInPage -= bytes2Write;
-		if (bytesLeftInPage == 0)
-		{
-			bytesLeftInPage = mPageSize;
-		}
-		/*
-		This was an attempt to continue to write to the eeprom till the page is
-		full and only then end the transmission with a stop.  This doesn't work.
-		
-		while (bytesLeft2Write &&
-			bytesLeftInPage)
-		{
-			Wire.endTransmission(false);
-			Wire.beginTransmission(mDeviceAddress);
-			bytes2Write = bytesLeftInPage > 32 ? 32 : bytesLeftInPage;
-			if (bytes2Write > bytesLeft2Write)
-			{
-				bytes2Write = bytesLeft2Write;
-			}
-			Wire.write(inBuffer, bytes2Write);
-			inBuffer += bytes2Write;
-			inDataAddress += bytes2Write;
-			bytesLeft2Write -= bytes2Write;
-			bytesLeftInPage -= bytes2Write;
-		}*/
-		Wire.endTransmission(true);
+		bytes2Write = inLength;
 	}
-	return(bytesLeft2Write == 0 ? inLength : 0);
+	ioTransaction.SetWrite(mDeviceAddress, inDataAddress, 2, inBuffer, bytes2Write, true);
+	mQueue->Append(&ioTransaction);
+	return(bytes2Write);
 }
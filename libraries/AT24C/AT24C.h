@@ -27,10 +27,19 @@
 // AT24C01A -> C16A aren't supported
 // Only tested with C32, C128, and C256 (32, 64 and 64 byte pages resp.)
 #define DEBUG_AT24C 1
+class I2CQueue;
+class I2CTransaction;
+
+/*
+*	All transfers are done on an I2CQueue.  Read and Write wait for the
+*	queued transaction(s) to complete.  QueueRead and QueueWrite return
+*	immediately, the transaction is done by I2CQueue::Update.
+*/
 class AT24C
 {
 public:
 							AT24C(
+								I2CQueue*				inQueue,
 								uint8_t					inDeviceAddress,
 								uint8_t					inCapacity); // KB, one of: 4, 8, 16, 32, 64, 128
 	uint16_t				Read(
@@ -42,16 +51,48 @@ public:
 								uint16_t				inLength,
 								const uint8_t*			inBuffer);
 	/*
+	*	QueueWrite: Queues a write of up to inLength bytes starting at
+	*	inDataAddress.  The write is limited to the page containing
+	*	inDataAddress and to what fits in the Wire buffer (30 bytes.)  The
+	*	transaction waits for the AT24C to complete any previous write.
+	*	inBuffer must not change until the transaction is done.  Returns the
+	*	number of bytes queued.
+	*/
+	uint16_t				QueueWrite(
+								I2CTransaction&			ioTransaction,
+								uint16_t				inDataAddress,
+								uint16_t				inLength,
+								const uint8_t*			inBuffer);
+	/*
+	*	QueueRead: Queues a read of up to 32 bytes.  Returns the number of
+	*	bytes queued.
+	*/
+	uint16_t				QueueRead(
+								I2CTransaction&			ioTransaction,
+								uint16_t				inDataAddress,
+								uint16_t				inLength,
+								uint8_t*				outBuffer);
+	I2CQueue*				Queue(void) const
+								{return(mQueue);}
+	/*
 	*	Rather than use some large software delay, this routine polls the AT24C
 	*	chip waiting for it to return 0 after it enables itself after writing.
 	*/
 	bool					WaitTillReady(void);
+	/*
+	*	Returns true if the AT24C isn't busy completing a write (it acknowledges
+	*	its address.)  Unlike WaitTillReady, this doesn't wait.
+	*/
+	bool					IsReady(void);
+	uint16_t				PageSize(void) const
+								{return(mPageSize);}
 #ifdef DEBUG_AT24C
 	uint32_t				MaxWaitTime(void)
 								{return(mMaxWaitTime);}
 	uint32_t mMaxWaitTime;
 #endif
 private:
+	I2CQueue*	mQueue;
 	uint8_t		mDeviceAddress;	// 0x50 + N low address bits.
 								// 3 bits for C32 -> C64, 2 bits for C128 -> C512
 	uint16_t	mPageSize;		// Initialized to one of: 32, 64, 128
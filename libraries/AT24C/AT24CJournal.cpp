@@ -0,0 +1,245 @@
+/*
+*	AT24CJournal.cpp, Copyright Jonathan Mackey 2023
+*	Append only, wear levelled journal of fixed size records on an AT24C.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "AT24CJournal.h"
+#include "AT24C.h"
+#include <string.h>
+#include <functional>
+
+/******************************** AT24CJournal ********************************/
+AT24CJournal::AT24CJournal(
+	AT24C*		inAT24C,
+	uint16_t	inStartAddress,
+	uint16_t	inLength,
+	uint8_t		inRecordSize)
+	: mAT24C(inAT24C), mStartAddress(inStartAddress), mHead(0),
+	  mWriteAddress(0), mRecordSize(inRecordSize), mSlotLength(0),
+	  mWriteOffset(0), mQueuedLength(0), mNextSequence(0)
+{
+	uint8_t	slotLength = inRecordSize + sizeof(uint32_t) + sizeof(uint16_t);
+	for (mSlotSize = 8; mSlotSize < slotLength && mSlotSize < kMaxSlotSize; mSlotSize *= 2){}
+	/*
+	*	If the record doesn't fit in the largest slot THEN
+	*	the journal is unusable (no slots.)
+	*/
+	mSlots = slotLength <= mSlotSize ? inLength / mSlotSize : 0;
+	mTransaction.SetCallback(std::bind(&AT24CJournal::WriteDone, this,
+								std::placeholders::_1, std::placeholders::_2));
+}
+
+/************************************ Load ************************************/
+bool AT24CJournal::Load(void)
+{
+	mHead = 0;
+	mNextSequence = 0;
+	uint32_t	firstSequence = mSlots ? ReadSequence(0) : kEmpty;
+	if (firstSequence != kEmpty)
+	{
+		/*
+		*	Binary search for the first slot not written in the current lap.
+		*	Slot 0 is always in the current lap.
+		*/
+		uint16_t	low = 1;
+		uint16_t	high = mSlots;
+		while (low < high)
+		{
+			uint16_t	mid = (low + high) / 2;
+			if (ReadSequence(mid) == (firstSequence + mid))
+			{
+				low = mid + 1;
+			} else
+			{
+				high = mid;
+			}
+		}
+		/*
+		*	Verify the newest record and the one before it.  Only one record
+		*	can be partially written so if neither is valid, the region
+		*	doesn't contain a journal.
+		*/
+		uint32_t	sequence = firstSequence + low - 1;
+		uint16_t	slot = low - 1;
+		for (uint8_t i = 0; i < 2; i++)
+		{
+			if (ReadSlot(slot, sequence, nullptr))
+			{
+				mHead = slot + 1 < mSlots ? slot + 1 : 0;
+				mNextSequence = sequence + 1;
+				break;
+			}
+			if (sequence == 0)
+			{
+				break;
+			}
+			sequence--;
+			slot = slot ? slot - 1 : mSlots - 1;
+		}
+	}
+	return(mNextSequence != 0);
+}
+
+/*********************************** Append ***********************************/
+bool AT24CJournal::Append(
+	const void*	inRecord)
+{
+	bool	success = mSlots != 0;
+	if (success)
+	{
+		if (mTransaction.IsPending())
+		{
+			Flush();
+		}
+		memcpy(mSlot, &mNextSequence, sizeof(uint32_t));
+		memcpy(&mSlot[sizeof(uint32_t)], inRecord, mRecordSize);
+		uint8_t		length = sizeof(uint32_t) + mRecordSize;
+		uint16_t	crc = CRC16(mSlot, length);
+		memcpy(&mSlot[length], &crc, sizeof(uint16_t));
+		mSlotLength = length + sizeof(uint16_t);
+		mWriteOffset = 0;
+		mWriteAddress = mStartAddress + (mHead * mSlotSize);
+		QueueNextPart();
+	}
+	return(success);
+}
+
+/*********************************** Flush ************************************/
+/*
+*	Waits for the record being written to complete.  Returns true if
+*	successful.
+*/
+bool AT24CJournal::Flush(void)
+{
+	while (mTransaction.IsPending() &&
+		mAT24C->Queue()->WaitFor(&mTransaction)){}
+	return(!mTransaction.IsPending() && mWriteOffset >= mSlotLength);
+}
+
+/******************************* QueueNextPart ********************************/
+void AT24CJournal::QueueNextPart(void)
+{
+	mQueuedLength = mAT24C->QueueWrite(mTransaction, mWriteAddress + mWriteOffset,
+							mSlotLength - mWriteOffset, &mSlot[mWriteOffset]);
+}
+
+/********************************* WriteDone **********************************/
+/*
+*	Called by the I2CQueue when a part of the record has been written.  Queues
+*	the next part, if any.  The record is only added to the journal once all
+*	of it has been written.  If a write fails, the next Append overwrites the
+*	slot with the same sequence number.
+*/
+void AT24CJournal::WriteDone(
+	I2CTransaction*	inTransaction,
+	bool			inSuccess)
+{
+	if (inSuccess)
+	{
+		mWriteOffset += mQueuedLength;
+		if (mWriteOffset < mSlotLength)
+		{
+			QueueNextPart();
+		} else
+		{
+			mHead = mHead + 1 < mSlots ? mHead + 1 : 0;
+			mNextSequence++;
+		}
+	}
+}
+
+/********************************* ReadRecent *********************************/
+bool AT24CJournal::ReadRecent(
+	uint16_t	inIndex,
+	void*		outRecord)
+{
+	bool	success = inIndex < Count();
+	if (success)
+	{
+		uint16_t	slot = (uint16_t)(((uint32_t)mHead + mSlots - 1 - inIndex) % mSlots);
+		success = ReadSlot(slot, mNextSequence - 1 - inIndex, outRecord);
+	}
+	return(success);
+}
+
+/******************************** ReadSequence ********************************/
+uint32_t AT24CJournal::ReadSequence(
+	uint16_t	inSlot)
+{
+	uint32_t	sequence;
+	if (mAT24C->Read(mStartAddress + (inSlot * mSlotSize), sizeof(uint32_t),
+							(uint8_t*)&sequence) != sizeof(uint32_t))
+	{
+		sequence = kEmpty;
+	}
+	return(sequence);
+}
+
+/********************************** ReadSlot **********************************/
+/*
+*	Returns true if the slot contains the record with inSequence.  outRecord
+*	may be null to only verify the slot.
+*/
+bool AT24CJournal::ReadSlot(
+	uint16_t	inSlot,
+	uint32_t	inSequence,
+	void*		outRecord)
+{
+	uint8_t	slot[kMaxSlotSize];
+	uint8_t	length = sizeof(uint32_t) + mRecordSize;
+	bool	success = mAT24C->Read(mStartAddress + (inSlot * mSlotSize),
+							length + sizeof(uint16_t), slot) == (length + sizeof(uint16_t));
+	if (success)
+	{
+		uint32_t	sequence;
+		uint16_t	crc;
+		memcpy(&sequence, slot, sizeof(uint32_t));
+		memcpy(&crc, &slot[length], sizeof(uint16_t));
+		success = sequence == inSequence && crc == CRC16(slot, length);
+		if (success &&
+			outRecord)
+		{
+			memcpy(outRecord, &slot[sizeof(uint32_t)], mRecordSize);
+		}
+	}
+	return(success);
+}
+
+/*********************************** CRC16 ************************************/
+/*
+*	CRC-16/CCITT (polynomial 0x1021.)  inCRC allows the CRC to be calculated
+*	in pieces.
+*/
+uint16_t AT24CJournal::CRC16(
+	const uint8_t*	inData,
+	uint16_t		inLength,
+	uint16_t		inCRC)
+{
+	uint16_t	crc = inCRC;
+	for (; inLength; inLength--)
+	{
+		crc ^= (uint16_t)(*(inData++)) << 8;
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+		}
+	}
+	return(crc);
+}
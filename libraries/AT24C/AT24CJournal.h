@@ -0,0 +1,122 @@
+/*
+*	AT24CJournal.h, Copyright Jonathan Mackey 2023
+*	Append only, wear levelled journal of fixed size records on an AT24C.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef AT24CJournal_h
+#define AT24CJournal_h
+
+#include <inttypes.h>
+#include "I2CQueue.h"
+class AT24C;
+
+/*
+*	AT24CJournal divides a region of the AT24C into slots used as a circular
+*	log.  Every record is written to the next slot so each slot (and its
+*	page) is only written once per lap of the region.
+*
+*	A slot holds a 32 bit sequence number, the record, and a CRC-16 of both.
+*	The slot size is the record size plus 6, rounded up to a power of 2 (64
+*	bytes max.)  inStartAddress should be a multiple of the slot size so that
+*	a slot never shares a page with another slot.
+*
+*	Slot i of lap L holds sequence number L*slots + i, so the slots written
+*	in the current lap are exactly those where sequence - i equals the
+*	sequence of slot 0.  Load uses this to find the newest record with a
+*	binary search, reading only the sequence numbers of log2(slots) slots.
+*	A record that was only partially written (e.g. power lost) fails its CRC
+*	and is ignored.  Erased slots (0xFF) are empty.
+*
+*	Append copies the record and queues its write on the AT24C's I2CQueue.
+*	The write completes in the background over the next few I2CQueue updates.
+*	The record is added to the journal (Count, Appended, ReadRecent) once
+*	completely written.
+*/
+class AT24CJournal
+{
+public:
+							AT24CJournal(
+								AT24C*					inAT24C,
+								uint16_t				inStartAddress,
+								uint16_t				inLength,
+								uint8_t					inRecordSize);
+	/*
+	*	Load: Finds the newest record.  Returns true if the journal contains
+	*	at least one record.
+	*/
+	bool					Load(void);
+	/*
+	*	Append: Returns true if the write was queued.  If the previous record
+	*	is still being written, this waits for it to complete.
+	*/
+	bool					Append(
+								const void*				inRecord);
+	/*
+	*	ReadRecent: Reads a record where inIndex 0 is the newest record.
+	*	Returns false if inIndex >= Count() or the record is invalid.
+	*/
+	bool					ReadRecent(
+								uint16_t				inIndex,
+								void*					outRecord);
+	uint16_t				Count(void) const
+								{return(mNextSequence < mSlots ? mNextSequence : mSlots);}
+	// The number of records written over the life of the journal.
+	uint32_t				Appended(void) const
+								{return(mNextSequence);}
+	bool					IsWriting(void) const
+								{return(mTransaction.IsPending());}
+	bool					Flush(void);
+	uint16_t				Slots(void) const
+								{return(mSlots);}
+protected:
+	static const uint8_t	kMaxSlotSize = 64;
+	static const uint32_t	kEmpty = 0xFFFFFFFF;
+	AT24C*		mAT24C;
+	uint16_t	mStartAddress;
+	uint16_t	mSlots;
+	uint16_t	mHead;			// Slot the next record is written to
+	uint16_t	mWriteAddress;	// Address of the slot being written
+	uint8_t		mSlotSize;
+	uint8_t		mRecordSize;
+	uint8_t		mSlotLength;	// Bytes of mSlot written
+	uint8_t		mWriteOffset;	// Next byte of mSlot to write
+	uint8_t		mQueuedLength;	// Bytes of the queued write
+	uint32_t	mNextSequence;
+	I2CTransaction	mTransaction;
+	uint8_t		mSlot[kMaxSlotSize];
+
+	uint32_t				ReadSequence(
+								uint16_t				inSlot);
+	bool					ReadSlot(
+								uint16_t				inSlot,
+								uint32_t				inSequence,
+								void*					outRecord);
+	void					QueueNextPart(void);
+	void					WriteDone(
+								I2CTransaction*			inTransaction,
+								bool					inSuccess);
+public:
+	static uint16_t			CRC16(
+								const uint8_t*			inData,
+								uint16_t				inLength,
+								uint16_t				inCRC = 0xFFFF);
+};
+
+#endif // AT24CJournal_h
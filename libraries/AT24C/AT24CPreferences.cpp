@@ -0,0 +1,222 @@
+/*
+*	AT24CPreferences.cpp, Copyright Jonathan Mackey 2023
+*	RAM mirror of the preferences stored at the start of an AT24C.
+*
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "AT24CPreferences.h"
+#include "AT24C.h"
+#include <string.h>
+#include <functional>
+
+/****************************** AT24CPreferences ******************************/
+AT24CPreferences::AT24CPreferences(
+	AT24C*		inAT24C,
+	uint8_t*	inBuffer,
+	uint16_t	inLength)
+	: mAT24C(inAT24C), mBuffer(inBuffer), mDirtyPages(0), mFlushPage(0),
+	  mFlushOffset(0), mQueuedLength(0), mLoaded(false), mRestart(false)
+{
+	mTransaction.SetCallback(std::bind(&AT24CPreferences::WriteDone, this,
+								std::placeholders::_1, std::placeholders::_2));
+	mPageSize = inAT24C->PageSize();
+	/*
+	*	If the buffer is larger than the pages that can be tracked THEN
+	*	only mirror the pages that can be tracked.
+	*/
+	if (inLength > (kMaxPages * mPageSize))
+	{
+		inLength = kMaxPages * mPageSize;
+	}
+	mLength = inLength;
+	memset(mWriteCycles, 0, sizeof(mWriteCycles));
+}
+
+/************************************ Load ************************************/
+bool AT24CPreferences::Load(void)
+{
+	mLoaded = mAT24C->Read(0, mLength, mBuffer) == mLength;
+	mDirtyPages = 0;
+	mFlushOffset = 0;
+	mRestart = false;
+	return(mLoaded);
+}
+
+/************************************ Read ************************************/
+uint16_t AT24CPreferences::Read(
+	uint16_t	inDataAddress,
+	uint16_t	inLength,
+	uint8_t*	outBuffer)
+{
+	if (!mLoaded)
+	{
+		return(mAT24C->Read(inDataAddress, inLength, outBuffer));
+	}
+	uint16_t	length = inLength;
+	if (inDataAddress < mLength)
+	{
+		uint16_t	mirrored = mLength - inDataAddress;
+		if (mirrored > length)
+		{
+			mirrored = length;
+		}
+		memcpy(outBuffer, &mBuffer[inDataAddress], mirrored);
+		inDataAddress += mirrored;
+		outBuffer += mirrored;
+		length -= mirrored;
+	}
+	if (length &&
+		mAT24C->Read(inDataAddress, length, outBuffer) != length)
+	{
+		return(0);
+	}
+	return(inLength);
+}
+
+/*********************************** Write ************************************/
+uint16_t AT24CPreferences::Write(
+	uint16_t		inDataAddress,
+	uint16_t		inLength,
+	const uint8_t*	inBuffer)
+{
+	if (!mLoaded)
+	{
+		return(mAT24C->Write(inDataAddress, inLength, inBuffer));
+	}
+	uint16_t	length = inLength;
+	for (; length && inDataAddress < mLength; length--, inDataAddress++, inBuffer++)
+	{
+		if (mBuffer[inDataAddress] != *inBuffer)
+		{
+			mBuffer[inDataAddress] = *inBuffer;
+			uint8_t	page = inDataAddress / mPageSize;
+			mDirtyPages |= (1 << page);
+			/*
+			*	If the page is being written THEN
+			*	start over, the part already written may have changed.
+			*/
+			if (page == mFlushPage)
+			{
+				mRestart = true;
+			}
+		}
+	}
+	if (length &&
+		mAT24C->Write(inDataAddress, length, inBuffer) != length)
+	{
+		return(0);
+	}
+	return(inLength);
+}
+
+/*********************************** Update ***********************************/
+/*
+*	Queues a write of the next part of a dirty page if the previous write is
+*	done.
+*/
+void AT24CPreferences::Update(void)
+{
+	if (mDirtyPages &&
+		!mTransaction.IsPending())
+	{
+		QueueNextPart();
+	}
+}
+
+/*********************************** Flush ************************************/
+/*
+*	Writes all of the dirty pages, waiting for each write to complete.
+*	Returns true if successful.
+*/
+bool AT24CPreferences::Flush(void)
+{
+	while (mDirtyPages)
+	{
+		Update();
+		if (!mAT24C->Queue()->WaitFor(&mTransaction))
+		{
+			break;
+		}
+	}
+	return(mDirtyPages == 0);
+}
+
+/******************************* QueueNextPart ********************************/
+/*
+*	Wire limits a write to kMaxWireData bytes so a page may take more than one
+*	write (and write cycle.)  The page being written is finished before
+*	starting the next dirty page.
+*/
+void AT24CPreferences::QueueNextPart(void)
+{
+	if (!(mDirtyPages & (1 << mFlushPage)))
+	{
+		for (mFlushPage = 0; !(mDirtyPages & (1 << mFlushPage)); mFlushPage++){}
+		mFlushOffset = 0;
+	} else if (mRestart)
+	{
+		mFlushOffset = 0;
+	}
+	mRestart = false;
+	uint16_t	address = (mFlushPage * mPageSize) + mFlushOffset;
+	uint16_t	length = mPageSize - mFlushOffset;
+	if (length > kMaxWireData)
+	{
+		length = kMaxWireData;
+	}
+	if (length > (mLength - address))
+	{
+		length = mLength - address;
+	}
+	mQueuedLength = mAT24C->QueueWrite(mTransaction, address, length, &mBuffer[address]);
+}
+
+/********************************* WriteDone **********************************/
+/*
+*	Called by the I2CQueue when the write queued by QueueNextPart is done.  A
+*	failed write is queued again by the next Update.
+*/
+void AT24CPreferences::WriteDone(
+	I2CTransaction*	inTransaction,
+	bool			inSuccess)
+{
+	if (inSuccess)
+	{
+		mWriteCycles[mFlushPage]++;
+		/*
+		*	If the page didn't change while being written THEN
+		*	continue with the next part of the page.
+		*/
+		if (!mRestart)
+		{
+			mFlushOffset += mQueuedLength;
+			/*
+			*	If the whole page has been written THEN
+			*	it's no longer dirty.
+			*/
+			if (mFlushOffset >= mPageSize ||
+				((mFlushPage * mPageSize) + mFlushOffset) >= mLength)
+			{
+				mDirtyPages &= ~(1 << mFlushPage);
+				mFlushOffset = 0;
+			}
+		}
+	}
+}
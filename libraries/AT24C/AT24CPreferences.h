@@ -0,0 +1,98 @@
+/*
+*	AT24CPreferences.h, Copyright Jonathan Mackey 2023
+*	RAM mirror of the preferences stored at the start of an AT24C.
+*
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef AT24CPreferences_h
+#define AT24CPreferences_h
+
+#include <inttypes.h>
+#include "I2CQueue.h"
+class AT24C;
+
+/*
+*	AT24CPreferences keeps a copy of the first inLength bytes of the AT24C in
+*	RAM.  The copy is loaded with a single burst Read.  Reads are then served
+*	from RAM.  Writes are compared with the copy, and only the pages that
+*	changed are marked dirty.  Writing the same value again costs nothing.
+*
+*	The dirty pages are written by Update, one I2C transaction at a time,
+*	queued on the AT24C's I2CQueue.  The queue waits for the AT24C to
+*	complete the previous write.  Update never waits, so it can be called
+*	from the loop whenever the machine is idle.  Call Flush before anything
+*	that loses RAM (e.g. a reset).
+*
+*	Data outside of the mirror is read and written directly.
+*/
+class AT24CPreferences
+{
+public:
+							AT24CPreferences(
+								AT24C*					inAT24C,
+								uint8_t*				inBuffer,
+								uint16_t				inLength);
+	/*
+	*	Load: Reads the mirror from the AT24C.  Until this succeeds, reads and
+	*	writes go directly to the AT24C.  Returns true if successful.
+	*/
+	bool					Load(void);
+	uint16_t				Read(
+								uint16_t				inDataAddress,
+								uint16_t				inLength,
+								uint8_t*				outBuffer);
+	uint16_t				Write(
+								uint16_t				inDataAddress,
+								uint16_t				inLength,
+								const uint8_t*			inBuffer);
+	void					Update(void);
+	bool					Flush(void);
+	bool					IsDirty(void) const
+								{return(mDirtyPages != 0);}
+	/*
+	*	The number of write cycles of each mirrored page since Load.  Used to
+	*	monitor EEPROM wear (about 1,000,000 cycles per page.)
+	*/
+	uint16_t				WriteCycles(
+								uint8_t					inPage) const
+								{return(inPage < kMaxPages ? mWriteCycles[inPage] : 0);}
+protected:
+	static const uint8_t	kMaxPages = 16;
+	static const uint8_t	kMaxWireData = 30;	// Wire buffer less the address
+	AT24C*		mAT24C;
+	uint8_t*	mBuffer;
+	uint16_t	mLength;
+	uint16_t	mPageSize;
+	uint16_t	mDirtyPages;		// Bit per page
+	uint8_t		mFlushPage;			// Page being written
+	uint16_t	mFlushOffset;		// Next byte of mFlushPage to write
+	uint16_t	mQueuedLength;		// Bytes of the queued write
+	bool		mLoaded;
+	bool		mRestart;			// mFlushPage changed, write it from the start
+	uint16_t	mWriteCycles[kMaxPages];
+	I2CTransaction	mTransaction;
+
+	void					QueueNextPart(void);
+	void					WriteDone(
+								I2CTransaction*			inTransaction,
+								bool					inSuccess);
+};
+
+#endif // AT24CPreferences_h
@@ -0,0 +1,214 @@
+/*
+*	DMALog.cpp, Copyright Jonathan Mackey 2023
+*	Non-blocking serial output through a ring buffer drained by UART TX DMA.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "DMALog.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#ifndef __MACH__
+#include <Arduino.h>
+#endif
+
+DMALog	dmaLog;
+
+#ifndef __MACH__
+/**************************** DMALOG_DMA_IRQHandler ***************************/
+extern "C" void DMALOG_DMA_IRQHandler(void)
+{
+	if (DMA1->ISR & DMALOG_DMA_TCIF)
+	{
+		DMA1->IFCR = DMALOG_DMA_CGIF;
+		dmaLog.TransferComplete();
+	}
+}
+#endif
+
+/*********************************** DMALog ***********************************/
+DMALog::DMALog(void)
+	: mReserve(0), mCommit(0), mRead(0), mWriters(0), mOverflows(0),
+	  mReportedOverflows(0), mChunkLength(0), mDMABusy(false)
+{
+	static_assert((kBufferSize & kIndexMask) == 0, "DMALOG_BUFFER_SIZE must be a power of 2");
+}
+
+/*********************************** begin ************************************/
+void DMALog::begin(void)
+{
+#ifndef __MACH__
+	/*
+	*	Serial.begin has setup the USART.  Route its TX requests to the DMA
+	*	channel.  The channel writes the USART's data register from memory,
+	*	incrementing the memory address only.
+	*/
+	RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+	DMALOG_DMA_CHANNEL->CCR = 0;
+	DMALOG_DMA_CHANNEL->CPAR = (uint32_t)&DMALOG_USART->DR;
+	DMALOG_USART->CR3 |= USART_CR3_DMAT;
+	// Lowest priority.  The ISR only starts the next chunk.
+	NVIC_SetPriority(DMALOG_DMA_IRQn, 15);
+	NVIC_EnableIRQ(DMALOG_DMA_IRQn);
+#endif
+}
+
+/*********************************** Write ************************************/
+bool DMALog::Write(
+	const void*	inData,
+	uint32_t	inLength)
+{
+	bool	success = inLength <= kBufferSize;
+	mWriters++;
+	uint32_t	start = mReserve.load();
+	/*
+	*	Claim inLength bytes.  If an ISR claims space between the load and
+	*	the compare_exchange, start is updated and this is tried again.
+	*/
+	while (success)
+	{
+		if ((start + inLength - mRead.load()) > kBufferSize)
+		{
+			success = false;
+		} else if (mReserve.compare_exchange_weak(start, start + inLength))
+		{
+			break;
+		}
+	}
+	if (success)
+	{
+		uint32_t	index = start & kIndexMask;
+		uint32_t	firstLength = kBufferSize - index;
+		if (firstLength > inLength)
+		{
+			firstLength = inLength;
+		}
+		memcpy(&mBuffer[index], inData, firstLength);
+		memcpy(mBuffer, (const uint8_t*)inData + firstLength, inLength - firstLength);
+	} else
+	{
+		mOverflows++;
+	}
+	/*
+	*	If this is the outermost write THEN
+	*	every claim made so far has been completely written (any ISR that
+	*	interrupted this write has returned), so commit up to mReserve.
+	*	mCommit only moves forward, in case an ISR committed a later
+	*	mReserve between the decrement and the load.
+	*/
+	if (--mWriters == 0)
+	{
+		uint32_t	reserve = mReserve.load();
+		uint32_t	commit = mCommit.load();
+		while ((int32_t)(reserve - commit) > 0 &&
+			!mCommit.compare_exchange_weak(commit, reserve)){}
+	}
+	return(success);
+}
+
+/*********************************** Printf ***********************************/
+bool DMALog::Printf(
+	const char*	inFormat,
+	...)
+{
+	char	message[kMaxMessageLength];
+	va_list	args;
+	va_start(args, inFormat);
+	int	length = vsnprintf(message, kMaxMessageLength, inFormat, args);
+	va_end(args);
+	if (length >= (int)kMaxMessageLength)
+	{
+		length = kMaxMessageLength - 1;
+	}
+	return(length > 0 && Write(message, length));
+}
+
+/*********************************** Update ***********************************/
+void DMALog::Update(void)
+{
+	if (!mDMABusy &&
+		mCommit != mRead)
+	{
+		StartTransfer();
+	}
+	/*
+	*	If messages have been dropped since the last report AND
+	*	the buffer is at most half full THEN
+	*	report them.  Waiting for room keeps the report itself from being
+	*	counted as an overflow.
+	*/
+	uint32_t	overflows = mOverflows;
+	if (mReportedOverflows != overflows &&
+		(mReserve - mRead) <= kBufferSize/2 &&
+		Printf("Log overflow: %u dropped\n", (unsigned)(overflows - mReportedOverflows)))
+	{
+		mReportedOverflows = overflows;
+	}
+}
+
+/*********************************** Flush ************************************/
+void DMALog::Flush(void)
+{
+	do
+	{
+		Update();
+	} while (mCommit != mRead);
+}
+
+/******************************* StartTransfer ********************************/
+/*
+*	Sends the committed data up to the end of the buffer.  Any data that wraps
+*	is sent as the next chunk.  Called when the DMA is idle.
+*/
+void DMALog::StartTransfer(void)
+{
+	uint32_t	read = mRead;
+	uint32_t	index = read & kIndexMask;
+	uint32_t	length = mCommit - read;
+	if (length > kBufferSize - index)
+	{
+		length = kBufferSize - index;
+	}
+	mChunkLength = length;
+	// mDMABusy is set first because the transfer may complete before the
+	// next statement executes.
+	mDMABusy = true;
+#ifndef __MACH__
+	DMALOG_DMA_CHANNEL->CCR = 0;
+	DMALOG_DMA_CHANNEL->CMAR = (uint32_t)&mBuffer[index];
+	DMALOG_DMA_CHANNEL->CNDTR = length;
+	DMALOG_DMA_CHANNEL->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_TCIE | DMA_CCR_EN;
+#else
+	fwrite(&mBuffer[index], 1, length, stdout);
+	TransferComplete();
+#endif
+}
+
+/****************************** TransferComplete ******************************/
+void DMALog::TransferComplete(void)
+{
+	mRead += mChunkLength;
+	if (mCommit != mRead)
+	{
+		StartTransfer();
+	} else
+	{
+		mDMABusy = false;
+	}
+}
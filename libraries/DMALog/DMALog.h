@@ -0,0 +1,158 @@
+/*
+*	DMALog.h, Copyright Jonathan Mackey 2023
+*	Non-blocking serial output through a ring buffer drained by UART TX DMA.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef DMALog_h
+#define DMALog_h
+
+#include <inttypes.h>
+#include <atomic>
+
+/*
+*	Compile time log levels.  The LOG_xxx macros above DMALOG_LEVEL compile
+*	to nothing, including their arguments.  The level can be set for the
+*	whole sketch by adding -DDMALOG_LEVEL=n to the sketch's build_opt.h.
+*/
+#define DMALOG_LEVEL_NONE	0
+#define DMALOG_LEVEL_ERROR	1
+#define DMALOG_LEVEL_WARN	2
+#define DMALOG_LEVEL_INFO	3
+#define DMALOG_LEVEL_DEBUG	4
+#ifndef DMALOG_LEVEL
+#define DMALOG_LEVEL	DMALOG_LEVEL_INFO
+#endif
+
+#if DMALOG_LEVEL >= DMALOG_LEVEL_ERROR
+#define LOG_ERROR(...)	dmaLog.Printf(__VA_ARGS__)
+#else
+#define LOG_ERROR(...)	do{}while(0)
+#endif
+#if DMALOG_LEVEL >= DMALOG_LEVEL_WARN
+#define LOG_WARN(...)	dmaLog.Printf(__VA_ARGS__)
+#else
+#define LOG_WARN(...)	do{}while(0)
+#endif
+#if DMALOG_LEVEL >= DMALOG_LEVEL_INFO
+#define LOG_INFO(...)	dmaLog.Printf(__VA_ARGS__)
+#else
+#define LOG_INFO(...)	do{}while(0)
+#endif
+#if DMALOG_LEVEL >= DMALOG_LEVEL_DEBUG
+#define LOG_DEBUG(...)	dmaLog.Printf(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...)	do{}while(0)
+#endif
+
+/*
+*	The ring buffer size must be a power of 2.
+*/
+#ifndef DMALOG_BUFFER_SIZE
+#define DMALOG_BUFFER_SIZE	1024
+#endif
+
+/*
+*	DMALog owns the TX side of the UART used by Serial.  Serial.begin must be
+*	called before begin().  Once begun, everything sent by the sketch must go
+*	through Write or Printf rather than Serial.write/print, otherwise the
+*	bytes written by HardwareSerial and the DMA will be interleaved.  Serial
+*	is still used to receive.
+*
+*	Write and Printf may be called from the main loop and from ISRs.  They
+*	never wait.  Each message is copied to the ring buffer whole, or not at
+*	all when there isn't room, in which case it's counted as an overflow.
+*	Messages from an ISR that interrupts a write are placed after the
+*	interrupted message, so messages are never interleaved.
+*
+*	The buffer is sent in contiguous chunks by the TX DMA channel.  Update,
+*	called from loop(), starts a transfer when the DMA is idle.  The transfer
+*	complete ISR starts the next chunk.  Update also logs a message when
+*	overflows have occurred since the last report.
+*
+*	On the STM32F103 the TX DMA channel is fixed by the USART: USART1 is
+*	DMA1 channel 4, USART2 (Serial on this board) is channel 7, USART3 is
+*	channel 2.
+*
+*	On the host (__MACH__) Update writes the buffer to stdout.
+*/
+#ifndef __MACH__
+#ifndef DMALOG_USART
+#define DMALOG_USART			USART2
+#define DMALOG_DMA_CHANNEL		DMA1_Channel7
+#define DMALOG_DMA_IRQn			DMA1_Channel7_IRQn
+#define DMALOG_DMA_IRQHandler	DMA1_Channel7_IRQHandler
+#define DMALOG_DMA_TCIF			DMA_ISR_TCIF7
+#define DMALOG_DMA_CGIF			DMA_IFCR_CGIF7
+#endif
+#endif
+
+class DMALog
+{
+public:
+	static const uint32_t	kBufferSize = DMALOG_BUFFER_SIZE;
+	static const uint32_t	kMaxMessageLength = 96;	// Printf
+							DMALog(void);
+	void					begin(void);
+	/*
+	*	Write: Returns false if the data was dropped because the buffer is full.
+	*/
+	bool					Write(
+								const void*				inData,
+								uint32_t				inLength);
+	bool					Printf(
+								const char*				inFormat,
+								...) __attribute__ ((format (printf, 2, 3)));
+	void					Update(void);
+	/*
+	*	Flush: Waits until the buffer has been sent.  For use before a reset.
+	*/
+	void					Flush(void);
+	// Messages dropped because the buffer was full.
+	uint32_t				Overflows(void) const
+								{return(mOverflows);}
+	// Bytes waiting to be sent.
+	uint32_t				Pending(void) const
+								{return(mCommit - mRead);}
+	void					TransferComplete(void);	// Called by the DMA ISR
+protected:
+	static const uint32_t	kIndexMask = kBufferSize - 1;
+	uint8_t					mBuffer[kBufferSize];
+	/*
+	*	The indexes are free running.  mReserve is the end of the space
+	*	claimed by writers, mCommit is the end of the data completely written,
+	*	and mRead is the end of the data sent.  mWriters is the number of
+	*	writes in progress, more than one when an ISR interrupts a write.
+	*	Only the outermost write moves mCommit.
+	*/
+	std::atomic<uint32_t>	mReserve;
+	std::atomic<uint32_t>	mCommit;
+	std::atomic<uint32_t>	mRead;
+	std::atomic<uint32_t>	mWriters;
+	std::atomic<uint32_t>	mOverflows;
+	uint32_t				mReportedOverflows;
+	uint32_t				mChunkLength;
+	volatile bool			mDMABusy;
+
+	void					StartTransfer(void);
+};
+
+extern DMALog	dmaLog;
+
+#endif // DMALog_h
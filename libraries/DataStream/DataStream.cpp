@@ -122,6 +122,24 @@ uint32_t DataStream_S::Write(
 	return(bytesWritten);
 }
 
+/************************************ Peek ************************************/
+const void* DataStream_S::Peek(
+	uint32_t&	ioLength)
+{
+	ioLength = Clip(ioLength);
+	return(ioLength ? mCurrent : nullptr);
+}
+
+/********************************** Acquire ***********************************/
+const void* DataStream_S::Acquire(
+	uint32_t&	ioLength)
+{
+	const uint8_t*	data = mCurrent;
+	ioLength = Clip(ioLength);
+	mCurrent += ioLength;
+	return(ioLength ? data : nullptr);
+}
+
 /******************************** DataStream_P ********************************/
 DataStream_P::DataStream_P(
 	const void*	inStartAddress,
@@ -150,6 +168,31 @@ uint32_t DataStream_P::Write(
 	return(Clip(inLength));
 }
 
+/************************************ Peek ************************************/
+/*
+*	On the AVR, PROGMEM is a separate address space so there's nothing to
+*	point to.  On ARM and ESP the flash is memory mapped.
+*/
+const void* DataStream_P::Peek(
+	uint32_t&	ioLength)
+{
+#ifdef __AVR__
+	ioLength = 0;
+#else
+	ioLength = Clip(ioLength);
+#endif
+	return(ioLength ? mCurrent : nullptr);
+}
+
+/********************************** Acquire ***********************************/
+const void* DataStream_P::Acquire(
+	uint32_t&	ioLength)
+{
+	const void*	data = Peek(ioLength);
+	mCurrent += ioLength;
+	return(data);
+}
+
 /****************************** DataStream_E *******************************/
 DataStream_E::DataStream_E(
 	const void*	inStartAddress,
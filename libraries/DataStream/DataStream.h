@@ -50,6 +50,23 @@ public:
 	virtual bool			AtEOF(void) const = 0;
 	virtual uint32_t		Clip(
 								uint32_t				inLength) const = 0;	
+	/*
+	*	Peek: Returns a pointer to the data at the current position without
+	*	copying it.  ioLength is the length wanted in the same units as Read.
+	*	It's returned as the length available at the pointer, which may be
+	*	less.  The pointer is only valid until the next call to the stream.
+	*	nullptr is returned when there's no data or the stream has nothing to
+	*	point to (e.g. EEPROM, or data that's unpacked as it's read.)  The
+	*	caller should then Read into its own buffer.
+	*
+	*	Acquire: Same as Peek, but also advances past the returned data.
+	*/
+	virtual const void*		Peek(
+								uint32_t&				ioLength)
+								{ioLength = 0; return(nullptr);}
+	virtual const void*		Acquire(
+								uint32_t&				ioLength)
+								{ioLength = 0; return(nullptr);}
 };
 
 class DataStreamImpl : public DataStream
@@ -87,6 +104,10 @@ public:
 	virtual uint32_t		Write(
 								uint32_t				inLength,
 								const void*				inBuffer);
+	virtual const void*		Peek(
+								uint32_t&				ioLength);
+	virtual const void*		Acquire(
+								uint32_t&				ioLength);
 
 };
 
@@ -103,6 +124,10 @@ public:
 	virtual uint32_t		Write(
 								uint32_t				inLength,
 								const void*				inBuffer);
+	virtual const void*		Peek(
+								uint32_t&				ioLength);
+	virtual const void*		Acquire(
+								uint32_t&				ioLength);
 
 };
 
@@ -0,0 +1,204 @@
+/*
+*	CircleQuadrant.cpp, Copyright Jonathan Mackey 2023
+*	Anti-aliased tint profile of one quadrant of a circle.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "CircleQuadrant.h"
+
+/*********************************** MapTint **********************************/
+/*
+*	Same as the Arduino map() function.
+*/
+static inline uint8_t MapTint(
+	int32_t	x,
+	int32_t	inMin,
+	int32_t	inMax,
+	int32_t	outMin,
+	int32_t	outMax)
+{
+	return((x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin);
+}
+
+/******************************* CircleQuadrant *******************************/
+CircleQuadrant::CircleQuadrant(void)
+	: mRadius(0), mThickness(0), mRow(0), mCacheOffset(0), mCached(false),
+	  mEdgeTint(0)
+{
+}
+
+/*********************************** Begin ************************************/
+void CircleQuadrant::Begin(
+	int16_t	inRadius,
+	int16_t	inThickness)
+{
+	if (inRadius < 0)
+	{
+		inRadius = 0;
+	}
+	/*
+	*	Same as DrawCircle, if the thickness isn't less than the radius THEN
+	*	fill the entire circle.
+	*/
+	if (inThickness < 0 ||
+		inThickness >= inRadius)
+	{
+		inThickness = 0;
+	}
+	mRow = inRadius;
+	mCacheOffset = 0;
+	/*
+	*	If the profile of this radius and thickness isn't already cached...
+	*/
+	if (!mCached ||
+		mRadius != inRadius ||
+		mThickness != inThickness)
+	{
+		mRadius = inRadius;
+		mThickness = inThickness;
+		mOuterTintRadiusSquared = inRadius + 1;
+		mOuterTintRadiusSquared *= mOuterTintRadiusSquared;
+		mRadiusSquared = (uint32_t)inRadius*inRadius;
+		if (inThickness)
+		{
+			mInnerRadiusSquared = inRadius-inThickness+1;
+			mInnerTintRadiusSquared = mInnerRadiusSquared-1;
+			mInnerRadiusSquared *= mInnerRadiusSquared;
+			mInnerTintRadiusSquared *= mInnerTintRadiusSquared;
+		} else
+		{
+			mInnerRadiusSquared = 0;
+			mInnerTintRadiusSquared = 0;
+		}
+		/*
+		*	The innermost pixel of the furthest row is always in the outer tint
+		*	area.
+		*/
+		mEdgeTint = inRadius ? MapTint(mRadiusSquared+1, mOuterTintRadiusSquared, mRadiusSquared, 0, 255) : 0;
+
+		/*
+		*	Attempt to cache the entire profile.
+		*/
+		mCached = false;
+		if (inRadius <= 255)
+		{
+			uint16_t	cacheOffset = 0;
+			uint16_t	row = inRadius;
+			for (; row; row--)
+			{
+				/*
+				*	If there isn't room for a row of the maximum length THEN
+				*	the profile can't be cached.
+				*/
+				if ((cacheOffset + 2 + inRadius) > QUADRANT_CACHE_SIZE)
+				{
+					break;
+				}
+				uint16_t	start;
+				uint16_t	len = CalcRow(row, &mCache[cacheOffset+2], start);
+				mCache[cacheOffset] = start;
+				mCache[cacheOffset+1] = len;
+				cacheOffset += (len + 2);
+			}
+			mCached = row == 0;
+		}
+	}
+}
+
+/********************************** NextRow ***********************************/
+const uint8_t* CircleQuadrant::NextRow(
+	uint8_t*	ioRowBuffer,
+	uint16_t&	outRow,
+	uint16_t&	outStart,
+	uint16_t&	outLen)
+{
+	const uint8_t*	tints = nullptr;
+	if (mRow)
+	{
+		outRow = mRow;
+		if (mCached)
+		{
+			outStart = mCache[mCacheOffset];
+			outLen = mCache[mCacheOffset+1];
+			tints = &mCache[mCacheOffset+2];
+			mCacheOffset += (outLen + 2);
+		} else
+		{
+			outLen = CalcRow(mRow, ioRowBuffer, outStart);
+			tints = ioRowBuffer;
+		}
+		mRow--;
+	}
+	return(tints);
+}
+
+/********************************** CalcRow ***********************************/
+/*
+*	Calculates the tints of inRow using the same rules as DrawCircle:
+*	pixels between the outer tint radius and the radius are tinted, pixels
+*	between the radius and the inner radius are 100%, pixels between the inner
+*	radius and the inner tint radius are tinted, and the interior isn't drawn.
+*	Returns the number of tints.
+*/
+uint16_t CircleQuadrant::CalcRow(
+	uint16_t	inRow,
+	uint8_t*	outTints,
+	uint16_t&	outStart)
+{
+	uint32_t	rowSquared = (uint32_t)inRow*inRow;
+	uint32_t	column = mRadius;
+	/*
+	*	Find the outermost column within the outer tint radius.
+	*/
+	while (column &&
+		((column*column) + rowSquared) > mOuterTintRadiusSquared)
+	{
+		column--;
+	}
+	uint32_t	endColumn = column;
+	/*
+	*	Find the innermost column outside of the inner tint radius.
+	*/
+	column = 1;
+	if (mInnerTintRadiusSquared)
+	{
+		while (column <= endColumn &&
+			((column*column) + rowSquared) <= mInnerTintRadiusSquared)
+		{
+			column++;
+		}
+	}
+	outStart = column;
+	uint8_t*	tintPtr = outTints;
+	for (; column <= endColumn; column++)
+	{
+		uint32_t	rcSquared = (column*column) + rowSquared;
+		if (rcSquared > mRadiusSquared)
+		{
+			*(tintPtr++) = MapTint(rcSquared, mOuterTintRadiusSquared, mRadiusSquared, 0, 255);
+		} else if (rcSquared > mInnerRadiusSquared)
+		{
+			*(tintPtr++) = 255;
+		} else
+		{
+			*(tintPtr++) = MapTint(rcSquared, mInnerRadiusSquared, mInnerTintRadiusSquared, 255, 0);
+		}
+	}
+	return(tintPtr - outTints);
+}
@@ -0,0 +1,101 @@
+/*
+*	CircleQuadrant.h, Copyright Jonathan Mackey 2023
+*	Anti-aliased tint profile of one quadrant of a circle.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef CircleQuadrant_h
+#define CircleQuadrant_h
+
+#include <inttypes.h>
+
+/*
+*	The pixels of each quadrant of a circle are addressed by the column and row
+*	relative to the center, where 1 is the column/row adjacent to the center and
+*	inRadius is the furthest.  Because the circle is symmetric, every quadrant
+*	and octant is a mirror of this profile.
+*
+*	The rows are returned from the furthest row (inRadius) to the row adjacent
+*	to the center.  The drawn pixels within a row are always contiguous, from
+*	column outStart to column outStart+outLen-1.
+*
+*	The profile of the most recently used radius and thickness is cached so
+*	that the rounded rects of buttons, menus and dialogs don't have to
+*	recalculate the tints of each corner every time they're drawn.  If the
+*	profile won't fit in the cache, each row is calculated as it's requested.
+*/
+#ifdef __AVR__
+#define QUADRANT_CACHE_SIZE	0
+#else
+#define QUADRANT_CACHE_SIZE	512
+#endif
+
+class CircleQuadrant
+{
+public:
+							CircleQuadrant(void);
+	/*
+	*	Begin: Prepares to return the rows of the quadrant of a circle of
+	*	inRadius.  When inThickness is zero the circle is filled.
+	*/
+	void					Begin(
+								int16_t					inRadius,
+								int16_t					inThickness);
+	/*
+	*	NextRow: Returns the tints of the next row, nullptr if there are no
+	*	more rows.  ioRowBuffer must be at least inRadius bytes.  It's only used
+	*	when the profile isn't cached.  The returned tints are ordered from
+	*	outStart (the column nearest the center) outward.
+	*/
+	const uint8_t*			NextRow(
+								uint8_t*				ioRowBuffer,
+								uint16_t&				outRow,
+								uint16_t&				outStart,
+								uint16_t&				outLen);
+	/*
+	*	EdgeTint: Returns the tint of the innermost pixel of the row furthest
+	*	from the center.  This is used by DrawRoundedRect as the tint value of
+	*	the one pixel outer frame.
+	*/
+	uint8_t					EdgeTint(void) const
+								{return(mEdgeTint);}
+protected:
+	int16_t		mRadius;
+	int16_t		mThickness;
+	uint16_t	mRow;			// Next row to be returned
+	uint16_t	mCacheOffset;	// Offset of the next cached row
+	bool		mCached;
+	uint8_t		mEdgeTint;
+	uint32_t	mOuterTintRadiusSquared;
+	uint32_t	mRadiusSquared;
+	uint32_t	mInnerRadiusSquared;
+	uint32_t	mInnerTintRadiusSquared;
+	/*
+	*	Each cached row is stored as the start column, the length, followed by
+	*	the tints.  Only radii up to 255 are cached.
+	*/
+	uint8_t		mCache[QUADRANT_CACHE_SIZE+1];
+
+	uint16_t				CalcRow(
+								uint16_t				inRow,
+								uint8_t*				outTints,
+								uint16_t&				outStart);
+};
+
+#endif // CircleQuadrant_h
@@ -22,12 +22,21 @@
 */
 #include "DisplayController.h"
 #include "DataStream.h"
+#include "CircleQuadrant.h"
+#include "TintedSpan.h"
+#include "TintTable.h"
 #ifndef __MACH__
 #include <Arduino.h>
 #else
 #include <iostream>
 #endif
 
+/*
+*	The quadrant profile is shared by all displays.  It holds the tints of the
+*	last circle or rounded rect corner drawn.
+*/
+static CircleQuadrant	sQuadrant;
+static TintTable	sTintTable;
 
 /***************************** DisplayController ******************************/
 DisplayController::DisplayController(
@@ -239,6 +248,13 @@ uint16_t DisplayController::DrawRoundedRect(
 	uint8_t	inFillTint,
 	bool	inFrameOnly)
 {
+	if (BitsPerPixel() == 16 &&
+		inRadius > 0 &&
+		inWidth >= inRadius*2 &&
+		inHeight >= inRadius*2)
+	{
+		return(DrawRoundedRectSpans(inX, inY, inWidth, inHeight, inRadius, inFillTint, inFrameOnly));
+	}
 	int16_t	radiusX2 = inRadius*2;
 	int16_t widthMRX2 = inWidth-radiusX2;
 	int16_t heightMRX2 = inHeight-radiusX2;
@@ -263,6 +279,103 @@ uint16_t DisplayController::DrawRoundedRect(
 	return(fillColor);
 }
 
+/**************************** DrawRoundedRectSpans ****************************/
+/*
+*	Same as the octant version of DrawRoundedRect except that each scanline of
+*	the corners, including the part of the top or bottom between the corners,
+*	is sent as a single span.  The corner tints come from sQuadrant, so
+*	redrawing rounded rects of the same radius doesn't recalculate the tints.
+*/
+uint16_t DisplayController::DrawRoundedRectSpans(
+	int16_t	inX,
+	int16_t	inY,
+	int16_t	inWidth,
+	int16_t	inHeight,
+	int16_t	inRadius,
+	uint8_t	inFillTint,
+	bool	inFrameOnly)
+{
+	int16_t	widthMRX2 = inWidth-(inRadius*2);
+	int16_t	heightMRX2 = inHeight-(inRadius*2);
+	int16_t	xPlusR = inX+inRadius;
+	int16_t	yPlusR = inY+inRadius;
+	uint16_t	savedFGColor = mFGColor;
+	uint16_t	fillColor = Calc565Color(inFillTint);
+	mFGColor = fillColor;
+	sQuadrant.Begin(inRadius, inFrameOnly ? 1:0);
+	uint8_t	frameTint = sQuadrant.EdgeTint();
+	{
+		TintedSpan	span(this);
+		uint8_t		rowBuffer[inRadius+1];
+		uint16_t	row, start, len;
+		const uint8_t*	tints;
+		while ((tints = sQuadrant.NextRow(rowBuffer, row, start, len)) != nullptr)
+		{
+			if (!len)
+			{
+				continue;
+			}
+			/*
+			*	The top and bottom rows have the one pixel frame between the
+			*	corners.  When not frame only, the other rows have the fill.
+			*/
+			bool	hasMiddle = widthMRX2 > 0 && (row == inRadius || !inFrameOnly);
+			uint8_t	middleTint = row == inRadius ? frameTint : 255;
+			int16_t	leftX = xPlusR-(start+len-1);
+			int16_t	rightX = xPlusR+widthMRX2+start-1;
+			int16_t	y = yPlusR-row;
+			for (uint8_t i = 0; i < 2; i++)
+			{
+				/*
+				*	If the corners and the middle are contiguous THEN
+				*	send the row as one span.
+				*/
+				if (start == 1 &&
+					(hasMiddle || widthMRX2 == 0))
+				{
+					if (span.Begin(leftX, y, (len*2) + widthMRX2))
+					{
+						span.Append(tints, len, true);
+						span.AppendRun(middleTint, widthMRX2);
+						span.Append(tints, len);
+						span.End();
+					}
+				} else
+				{
+					if (span.Begin(leftX, y, len))
+					{
+						span.Append(tints, len, true);
+						span.End();
+					}
+					if (hasMiddle &&
+						span.Begin(xPlusR, y, widthMRX2))
+					{
+						span.AppendRun(middleTint, widthMRX2);
+						span.End();
+					}
+					if (span.Begin(rightX, y, len))
+					{
+						span.Append(tints, len);
+						span.End();
+					}
+				}
+				y = yPlusR+heightMRX2+row-1;	// The bottom row
+			}
+		}
+	}
+	if (heightMRX2 > 0)
+	{
+		FillTintedRect(inX, yPlusR, 1, heightMRX2, frameTint);			// Left
+		FillTintedRect(inX+inWidth-1, yPlusR, 1, heightMRX2, frameTint);// Right
+		if (!inFrameOnly)
+		{
+			FillRect(inX+1, yPlusR, inWidth-2, heightMRX2, fillColor);
+		}
+	}
+	mFGColor = savedFGColor;
+	return(fillColor);
+}
+
 /********************************* DrawFrame **********************************/
 void DisplayController::DrawFrame(
 	uint16_t	inX,
@@ -333,6 +446,10 @@ uint8_t DisplayController::DrawCircle(
 	int16_t		inOctantXOffset,
 	int16_t		inOctantYOffset)
 {
+	if (BitsPerPixel() == 16)
+	{
+		return(DrawCircleSpans(inCenterX, inCenterY, inRadius, inThickness, inOctants, inOctantXOffset, inOctantYOffset));
+	}
 	int16_t	xOffset = inCenterX - inRadius;
 	int16_t	yOffset = inCenterY - inRadius;
 	/*
@@ -591,6 +708,118 @@ uint8_t DisplayController::DrawCircle(
 	return(roundRectTint);
 }
 
+/****************************** DrawCircleSpans *******************************/
+/*
+*	Same as the octant version of DrawCircle except that the circle is drawn by
+*	scanline.  Each scanline of the west and east quadrants is sent as a span,
+*	or as a single span when the two quadrants are contiguous.
+*
+*	The pixels of a quadrant within the horizontal octants (NNW, NNE, SSE, SSW)
+*	are those with a column <= row.  Those within the vertical octants (WNW,
+*	ENE, ESE, WSW) have a column >= row.  The 45° pixel is in both.
+*/
+uint8_t DisplayController::DrawCircleSpans(
+	int16_t		inCenterX,
+	int16_t		inCenterY,
+	int16_t		inRadius,
+	int16_t		inThickness,
+	uint8_t		inOctants,
+	int16_t		inOctantXOffset,
+	int16_t		inOctantYOffset)
+{
+	/*
+	*	Octant pairs of the NW, NE, SW and SE quadrants.  The first octant of
+	*	each pair is the horizontal octant.
+	*/
+	static const uint8_t	kQuadrantOctants[4][2] =
+	{
+		{eNNWOctant, eWNWOctant},
+		{eNNEOctant, eENEOctant},
+		{eSSWOctant, eWSWOctant},
+		{eSSEOctant, eESEOctant}
+	};
+	sQuadrant.Begin(inRadius, inThickness);
+	TintedSpan	span(this);
+	uint8_t		rowBuffer[inRadius+1];
+	uint16_t	row, start, len;
+	const uint8_t*	tints;
+	while ((tints = sQuadrant.NextRow(rowBuffer, row, start, len)) != nullptr)
+	{
+		if (!len)
+		{
+			continue;
+		}
+		int16_t	y = inCenterY - row;
+		for (uint8_t half = 0; half < 4; half += 2)
+		{
+			/*
+			*	Determine the columns of the west and east quadrant to be drawn.
+			*/
+			uint16_t	first[2];
+			uint16_t	last[2];
+			for (uint8_t i = 0; i < 2; i++)
+			{
+				const uint8_t*	octants = kQuadrantOctants[half+i];
+				first[i] = start;
+				last[i] = start+len-1;
+				if ((inOctants & octants[0]) == 0)
+				{
+					if (first[i] < row)
+					{
+						first[i] = row;
+					}
+				}
+				if ((inOctants & octants[1]) == 0)
+				{
+					if (last[i] > row)
+					{
+						last[i] = row;
+					}
+				}
+				if ((inOctants & (octants[0]+octants[1])) == 0)
+				{
+					last[i] = 0;	// Nothing to draw
+				}
+			}
+			uint16_t	westLen = last[0] >= first[0] ? last[0]-first[0]+1 : 0;
+			uint16_t	eastLen = last[1] >= first[1] ? last[1]-first[1]+1 : 0;
+			int16_t		westX = inCenterX - last[0];
+			int16_t		eastX = inCenterX + inOctantXOffset + first[1] - 1;
+			/*
+			*	If the west and east quadrants are contiguous THEN
+			*	send as a single span.
+			*/
+			if (westLen && eastLen &&
+				first[0] == 1 && first[1] == 1 &&
+				inOctantXOffset == 0)
+			{
+				if (span.Begin(westX, y, westLen+eastLen))
+				{
+					span.Append(tints, westLen, true);
+					span.Append(tints, eastLen);
+					span.End();
+				}
+			} else
+			{
+				if (westLen &&
+					span.Begin(westX, y, westLen))
+				{
+					span.Append(&tints[first[0]-start], westLen, true);
+					span.End();
+				}
+				if (eastLen &&
+					span.Begin(eastX, y, eastLen))
+				{
+					span.Append(&tints[first[1]-start], eastLen);
+					span.End();
+				}
+			}
+			y = inCenterY + inOctantYOffset + row - 1;	// South half row
+		}
+	}
+	return(inRadius > 0 ? sQuadrant.EdgeTint() : 0);
+}
+
 #else
 /********************************* DrawCircle *********************************/
 /*
@@ -799,6 +1028,145 @@ uint8_t DisplayController::DrawCircle(
 }
 #endif
 
+/****************************** TintedColumnTile ******************************/
+/*
+*	TintedColumnTile collects the vertical tint patterns of up to kMaxColumns
+*	consecutive columns so that they can be sent as horizontal spans, one per
+*	scanline, rather than as one address window per column.  Used by DrawLine
+*	for lines that are closer to horizontal than vertical.
+*/
+class TintedColumnTile
+{
+public:
+	static const uint8_t	kMaxColumns = 16;
+							TintedColumnTile(
+								DisplayController*		inDisplay,
+								uint8_t*				inTints,
+								uint16_t				inMaxColumnLen)
+								: mDisplay(inDisplay), mTints(inTints),
+								  mMaxColumnLen(inMaxColumnLen), mColumns(0),
+								  mStep(1){}
+	void					AddColumn(
+								int32_t					inX,
+								int32_t					inY,
+								const uint8_t*			inTints,
+								uint16_t				inLen,
+								bool					inReverseOrder);
+	void					Flush(void);
+protected:
+	DisplayController*	mDisplay;
+	uint8_t*	mTints;	// kMaxColumns x mMaxColumnLen
+	uint16_t	mMaxColumnLen;
+	uint8_t		mColumns;
+	int8_t		mStep;	// 1 or -1, the x direction of the columns added
+	int16_t		mX[kMaxColumns];
+	int16_t		mY[kMaxColumns];
+	uint16_t	mLen[kMaxColumns];
+};
+
+/********************************* AddColumn **********************************/
+void TintedColumnTile::AddColumn(
+	int32_t			inX,
+	int32_t			inY,
+	const uint8_t*	inTints,
+	uint16_t		inLen,
+	bool			inReverseOrder)
+{
+	/*
+	*	If the tile is full or this column isn't adjacent to the last column in
+	*	the same direction THEN
+	*	flush the tile.
+	*/
+	if (mColumns)
+	{
+		int32_t	step = inX - mX[mColumns-1];
+		if (mColumns == kMaxColumns ||
+			(step != 1 && step != -1) ||
+			(mColumns > 1 && step != mStep))
+		{
+			Flush();
+		} else
+		{
+			mStep = step;
+		}
+	}
+	if (inLen > mMaxColumnLen)
+	{
+		inLen = mMaxColumnLen;
+	}
+	mX[mColumns] = inX;
+	mY[mColumns] = inY;
+	mLen[mColumns] = inLen;
+	uint8_t*	tintPtr = &mTints[mColumns*mMaxColumnLen];
+	if (inReverseOrder)
+	{
+		for (uint16_t i = inLen; i; i--)
+		{
+			*(tintPtr++) = inTints[i-1];
+		}
+	} else
+	{
+		memcpy(tintPtr, inTints, inLen);
+	}
+	mColumns++;
+}
+
+/*********************************** Flush ************************************/
+void TintedColumnTile::Flush(void)
+{
+	if (mColumns)
+	{
+		int32_t	minY = mY[0];
+		int32_t	maxY = mY[0] + mLen[0];
+		for (uint8_t i = 1; i < mColumns; i++)
+		{
+			if (mY[i] < minY)
+			{
+				minY = mY[i];
+			}
+			if ((mY[i] + mLen[i]) > maxY)
+			{
+				maxY = mY[i] + mLen[i];
+			}
+		}
+		TintedSpan	span(mDisplay);
+		uint8_t		rowTints[kMaxColumns];
+		for (int32_t y = minY; y < maxY; y++)
+		{
+			uint8_t	count = 0;
+			int32_t	spanX = 0;
+			/*
+			*	Walk the columns in display order, sending each contiguous
+			*	group of columns that intersect this row as a span.
+			*/
+			for (uint8_t i = 0; i <= mColumns; i++)
+			{
+				uint8_t	column = mStep < 0 ? mColumns-1-i : i;
+				int32_t	offset = i < mColumns ? y - mY[column] : -1;
+				if (offset >= 0 &&
+					offset < mLen[column])
+				{
+					if (!count)
+					{
+						spanX = mX[column];
+					}
+					rowTints[count++] = mTints[(column*mMaxColumnLen) + offset];
+				} else if (count)
+				{
+					if (span.Begin(spanX, y, count))
+					{
+						span.Append(rowTints, count);
+						span.End();
+					}
+					count = 0;
+				}
+			}
+		}
+		mColumns = 0;
+		mStep = 1;
+	}
+}
+
 /********************************** DrawLine **********************************/
 /*
 *	Draws a line of inThickness centered around the line made by the input
@@ -1001,6 +1369,15 @@ void DisplayController::DrawLine(
 		}
 		int32_t	lastX = 0;
 		int32_t	lastXM = 0;
+		/*
+		*	16 bit displays send the patterns as horizontal spans.  When the
+		*	patterns are vertical (swapXY), the patterns of the first and
+		*	mirrored halves of the line are collected into tiles.
+		*/
+		bool	useSpans = BitsPerPixel() == 16;
+		uint8_t	tileTints[2][TintedColumnTile::kMaxColumns * sizeof(pattern)];
+		TintedColumnTile	tile(this, tileTints[0], sizeof(pattern));
+		TintedColumnTile	mirrorTile(this, tileTints[1], sizeof(pattern));
 		
 		for (y = -thicknessPlusAM; y <= halfDy; y++)
 		{
@@ -1149,7 +1526,16 @@ void DisplayController::DrawLine(
 					if (reps && clippedPatternLen)
 					{
 						lastX = oX;
-						CopyTintedPattern(oX, oY, &pattern[patternInset], clippedPatternLen, 1, swapXY, false);
+						if (!useSpans)
+						{
+							CopyTintedPattern(oX, oY, &pattern[patternInset], clippedPatternLen, 1, swapXY, false);
+						} else if (swapXY)
+						{
+							tile.AddColumn(oX, oY, &pattern[patternInset], clippedPatternLen, false);
+						} else
+						{
+							DrawTintedSpan(oX, oY, &pattern[patternInset], clippedPatternLen, false);
+						}
 					}
 					if (y < mirrorY)
 					{
@@ -1186,13 +1572,24 @@ void DisplayController::DrawLine(
 						if (reps && patternLen)
 						{
 							lastXM = oX;
-							CopyTintedPattern(oX, oY, &pattern[patternInset], patternLen, 1, swapXY, true);
+							if (!useSpans)
+							{
+								CopyTintedPattern(oX, oY, &pattern[patternInset], patternLen, 1, swapXY, true);
+							} else if (swapXY)
+							{
+								mirrorTile.AddColumn(oX, oY, &pattern[patternInset], patternLen, true);
+							} else
+							{
+								DrawTintedSpan(oX, oY, &pattern[patternInset], patternLen, true);
+							}
 						}
 					}
 				}
 				mirrorY--;
 			}
 		}
+		tile.Flush();
+		mirrorTile.Flush();
 	}
 //	FillRect(inX0, inY0, 1, 1, 0x001F);
 //	FillRect(inX1, inY1, 1, 1, 0x07E0);
@@ -1226,6 +1623,22 @@ void DisplayController::CopyTintedPattern(
 	// See TFT_ST77XX::CopyTintedPattern for an implementation example
 }
 
+/******************************* DrawTintedSpan *******************************/
+void DisplayController::DrawTintedSpan(
+	int16_t			inX,
+	int16_t			inY,
+	const uint8_t*	inTintPattern,
+	uint16_t		inPatternLen,
+	bool			inReverseOrder)
+{
+	TintedSpan	span(this);
+	if (span.Begin(inX, inY, inPatternLen))
+	{
+		span.Append(inTintPattern, inPatternLen, inReverseOrder);
+		span.End();
+	}
+}
+
 /********************************* DrawFrameP *********************************/
 /*void DisplayController::DrawFrameP(
 	const Rect8_t*	inRect,
@@ -1268,7 +1681,11 @@ bool DisplayController::StreamCopyBlock(
 	bool	success = WillFit(inRows, inColumns);
 	if (success)
 	{
-		uint16_t	pixelsToCopy = inRows * inColumns;
+		/*
+		*	A full screen block can be more than the 65535 pixels StreamCopy
+		*	can copy in one call.
+		*/
+		uint32_t	pixelsToCopy = (uint32_t)inRows * inColumns;
 		if (pixelsToCopy)
 		{
 			if (mAddressingMode == eHorizontal)
@@ -1276,6 +1693,10 @@ bool DisplayController::StreamCopyBlock(
 				SetColumnRange(inColumns);
 				// The column index will wrap back to the starting point.
 				// The page won't so it needs to be reset.
+				for (; pixelsToCopy > 0xFFFF; pixelsToCopy -= 0xFFFF)
+				{
+					StreamCopy(inDataStream, 0xFFFF);
+				}
 				StreamCopy(inDataStream, pixelsToCopy);
 				SetColumnRange(0, mColumns-1);	// Remove the column range clipping
 				MoveToRow(mRow);	// Leave the page unchanged
@@ -1286,6 +1707,10 @@ bool DisplayController::StreamCopyBlock(
 				SetRowRange(inRows);
 				// The row index will wrap back to the starting point.
 				// The column won't so it needs to be reset.
+				for (; pixelsToCopy > 0xFFFF; pixelsToCopy -= 0xFFFF)
+				{
+					StreamCopy(inDataStream, 0xFFFF);
+				}
 				StreamCopy(inDataStream, pixelsToCopy);
 				MoveToRow(mRow);	// Leave the page unchanged
 				MoveColumnBy(inColumns); // Advance by inColumns (or wrap to zero if at or past end)
@@ -1296,11 +1721,40 @@ bool DisplayController::StreamCopyBlock(
 	return(success);
 }
 
+/******************************* CopyPixelBlock *******************************/
+bool DisplayController::CopyPixelBlock(
+	const uint16_t*	inPixels,
+	uint16_t		inRows,
+	uint16_t		inColumns)
+{
+	bool	success = WillFit(inRows, inColumns);
+	if (success)
+	{
+		uint16_t	pixelsToCopy = inRows * inColumns;
+		if (pixelsToCopy)
+		{
+			SetColumnRange(inColumns);
+			CopyPixels(inPixels, pixelsToCopy);
+			SetColumnRange(0, mColumns-1);	// Remove the column range clipping
+			MoveToRow(mRow);	// Leave the page unchanged
+			MoveColumnBy(inColumns); // Advance by inColumns (or wrap to zero if at or past end)
+		}
+	}
+	return(success);
+}
+
 /******************************** Calc565Color ********************************/
 uint16_t DisplayController::Calc565Color(
 	uint8_t		inTint)
 {
-	return(Calc565Color(mFGColor, mBGColor, inTint));
+	sTintTable.SetColors(mFGColor, mBGColor);
+	return(sTintTable.Color(inTint));
+}
+
+/******************************** GetTintTable ********************************/
+TintTable& DisplayController::GetTintTable(void)
+{
+	return(sTintTable);
 }
 
 /******************************** Calc565Color ********************************/
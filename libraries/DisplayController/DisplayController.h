@@ -26,6 +26,7 @@
 #include "PlatformDefs.h"
 
 class DataStream;
+class TintTable;
 
 typedef struct Rect8_t
 {
@@ -212,6 +213,19 @@ public:
 								uint16_t				inReps,
 								bool					inVertical,
 								bool					inReverseOrder);
+	/*
+	*	DrawTintedSpan: Draws a horizontal pattern of tints using a single
+	*	address window, merging adjacent pixels of the same tint into runs.
+	*	The tints are converted to colors using the foreground and background
+	*	colors.  The span is clipped to the display.
+	*	Only supported by 16 bit displays.  See TintedSpan.h
+	*/
+	void					DrawTintedSpan(
+								int16_t					inX,
+								int16_t					inY,
+								const uint8_t*			inTintPattern,
+								uint16_t				inPatternLen,
+								bool					inReverseOrder = false);
 	uint16_t				DrawRoundedRect(
 								int16_t					inX,
 								int16_t					inY,
@@ -282,6 +296,16 @@ public:
 	virtual void			CopyPixels(
 								const void*				inPixels,
 								uint16_t				inPixelsToCopy){};
+	/*
+	*	CopyPixelBlock: The CopyPixels equivalent of StreamCopyBlock for 16 bit
+	*	displays.  Copies inRows*inColumns pixels starting at the current row
+	*	and column.  Will fail if it won't fit.  If successful the current
+	*	column is advanced by inColumns.  The current row is left unchanged.
+	*/
+	bool					CopyPixelBlock(
+								const uint16_t*			inPixels,
+								uint16_t				inRows,
+								uint16_t				inColumns);
 	enum EAddressingMode
 	{
 		eHorizontal,
@@ -290,15 +314,33 @@ public:
 	virtual void			SetAddressingMode(
 								EAddressingMode			inAddressingMode = eHorizontal) = 0;
 	/*
+	*	HasPackedFill returns true if FillPixels of inColor sends fewer bytes
+	*	per pixel than CopyPixels.  Large areas of such a color are cheaper to
+	*	fill than to compose off-screen.  See XFont::DrawLine.
+	*/
+	virtual bool			HasPackedFill(
+								uint16_t				inColor) const
+								{return(false);}
+	/*
 	*	Calc565Color was moved from XFont.h to support anti-aliased lines.
 	*/
 	static uint16_t			Calc565Color(
 								uint16_t				inFG,
 								uint16_t				inBG,
 								uint8_t					inTint);
+	/*
+	*	Returns the color of inTint between mFGColor and mBGColor using the
+	*	shared tint table.
+	*/
 	uint16_t				Calc565Color(
 								uint8_t					inTint);
 	/*
+	*	GetTintTable: Returns the tint table shared by the anti-aliased
+	*	drawing routines and the XFont glyph decoder.  Call SetColors before
+	*	each use because the other users may have changed the colors.
+	*/
+	static TintTable&		GetTintTable(void);
+	/*
 	*	The foreground and background colors are used by some of the newer
 	*	routines to avoid constantly passing these colors.
 	*	See DrawCircle() as an example.
@@ -338,6 +380,28 @@ protected:
 	EAddressingMode	mAddressingMode;
 	uint16_t	mFGColor;
 	uint16_t	mBGColor;
+
+	/*
+	*	Span based versions of DrawCircle and DrawRoundedRect used by 16 bit
+	*	displays.  Each scanline is sent as one or two address windows rather
+	*	than one address window per octant pattern.
+	*/
+	uint8_t					DrawCircleSpans(
+								int16_t					inCenterX,
+								int16_t					inCenterY,
+								int16_t					inRadius,
+								int16_t					inThickness,
+								uint8_t					inOctants,
+								int16_t					inOctantXOffset,
+								int16_t					inOctantYOffset);
+	uint16_t				DrawRoundedRectSpans(
+								int16_t					inX,
+								int16_t					inY,
+								int16_t					inWidth,
+								int16_t					inHeight,
+								int16_t					inRadius,
+								uint8_t					inFillTint,
+								bool					inFrameOnly);
 };
 
 #endif // DisplayController_h
@@ -0,0 +1,409 @@
+/*
+*	FramebufferDisplayController.cpp, Copyright Jonathan Mackey 2023
+*	Host display controller that renders to an in-memory RGB565 image.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "FramebufferDisplayController.h"
+#ifdef __MACH__
+#include "DataStream.h"
+#include <stdio.h>
+
+
+/************************ FramebufferDisplayController ************************/
+FramebufferDisplayController::FramebufferDisplayController(
+	uint16_t	inRows,
+	uint16_t	inColumns)
+	: DisplayController(inRows, inColumns),
+	  mStartColumn(0), mEndColumn(inColumns-1),
+	  mStartRow(0), mEndRow(inRows-1),
+	  mWriteRow(0), mWriteColumn(0), mSleeping(false)
+{
+	mPixels = new uint16_t[(uint32_t)inRows * inColumns];
+	memset(mPixels, 0, (uint32_t)inRows * inColumns * 2);
+	ResetStats();
+}
+
+/*********************** ~FramebufferDisplayController ************************/
+FramebufferDisplayController::~FramebufferDisplayController(void)
+{
+	delete [] mPixels;
+}
+
+/********************************* ResetStats *********************************/
+void FramebufferDisplayController::ResetStats(void)
+{
+	memset(mStats, 0, sizeof(mStats));
+}
+
+/********************************* GetTotals **********************************/
+void FramebufferDisplayController::GetTotals(
+	SSPIStats&	outTotals) const
+{
+	memset(&outTotals, 0, sizeof(SSPIStats));
+	for (uint8_t i = 0; i < eNumPrimitives; i++)
+	{
+		outTotals.calls += mStats[i].calls;
+		outTotals.transactions += mStats[i].transactions;
+		outTotals.cmdBytes += mStats[i].cmdBytes;
+		outTotals.dataBytes += mStats[i].dataBytes;
+		outTotals.pixels += mStats[i].pixels;
+	}
+}
+
+/******************************* PrimitiveName ********************************/
+const char* FramebufferDisplayController::PrimitiveName(
+	EPrimitive	inPrimitive)
+{
+	static const char* const	kPrimitiveNames[] =
+	{
+		"MoveToRow",
+		"SetColumnRange",
+		"SetRowRange",
+		"FillPixels",
+		"StreamCopy",
+		"CopyPixels",
+		"SleepWake"
+	};
+	return(inPrimitive < eNumPrimitives ? kPrimitiveNames[inPrimitive] : "");
+}
+
+/****************************** CountTransaction ******************************/
+void FramebufferDisplayController::CountTransaction(
+	EPrimitive	inPrimitive,
+	uint32_t	inCmdBytes,
+	uint32_t	inDataBytes,
+	uint32_t	inPixels)
+{
+	SSPIStats&	stats = mStats[inPrimitive];
+	stats.calls++;
+	stats.transactions++;
+	stats.cmdBytes += inCmdBytes;
+	stats.dataBytes += inDataBytes;
+	stats.pixels += inPixels;
+}
+
+/******************************* AdvanceWritePtr ******************************/
+/*
+*	Same as the controller, when the end of the column range is reached the
+*	memory pointer moves to the start column of the next row, and wraps to the
+*	first row after the last row.  In the vertical addressing mode rows and
+*	columns are swapped.
+*/
+void FramebufferDisplayController::AdvanceWritePtr(void)
+{
+	if (mAddressingMode == eHorizontal)
+	{
+		if (mWriteColumn < mEndColumn)
+		{
+			mWriteColumn++;
+		} else
+		{
+			mWriteColumn = mStartColumn;
+			mWriteRow = mWriteRow < mEndRow ? mWriteRow + 1 : mStartRow;
+		}
+	} else if (mWriteRow < mEndRow)
+	{
+		mWriteRow++;
+	} else
+	{
+		mWriteRow = mStartRow;
+		mWriteColumn = mWriteColumn < mEndColumn ? mWriteColumn + 1 : mStartColumn;
+	}
+}
+
+/*********************************** MoveTo ***********************************/
+void FramebufferDisplayController::MoveTo(
+	uint16_t	inRow,
+	uint16_t	inColumn)
+{
+	MoveToRow(inRow);
+	mColumn = inColumn;
+}
+
+/********************************* MoveToRow **********************************/
+/*
+*	RASET with 2 16 bit parameters, same as TFT_ST77XX::MoveToRow.
+*/
+void FramebufferDisplayController::MoveToRow(
+	uint16_t inRow)
+{
+	CountTransaction(eMoveToRowPrim, 1, 4);
+	mStartRow = inRow < mRows ? inRow : mRows -1;
+	mEndRow = mRows -1;
+	mRow = inRow;
+}
+
+/******************************** MoveToColumn ********************************/
+// Same as TFT_ST77XX, doesn't communicate with the controller.
+void FramebufferDisplayController::MoveToColumn(
+	uint16_t inColumn)
+{
+	mColumn = inColumn;
+}
+
+/******************************* SetColumnRange *******************************/
+/*
+*	CASET with 2 16 bit parameters followed by RAMWR.  RAMWR resets the memory
+*	pointer to the start of the row and column range.
+*/
+void FramebufferDisplayController::SetColumnRange(
+	uint16_t	inStartColumn,
+	uint16_t	inEndColumn)
+{
+	CountTransaction(eSetColumnRangePrim, 2, 4);
+	if (inEndColumn >= mColumns)
+	{
+		inEndColumn = mColumns -1;
+	}
+	mStartColumn = inStartColumn <= inEndColumn ? inStartColumn : inEndColumn;
+	mEndColumn = inEndColumn;
+	mWriteRow = mStartRow;
+	mWriteColumn = mStartColumn;
+}
+
+/******************************* SetRowRange *******************************/
+void FramebufferDisplayController::SetRowRange(
+	uint16_t	inStartRow,
+	uint16_t	inEndRow)
+{
+	CountTransaction(eSetRowRangePrim, 1, 4);
+	if (inEndRow >= mRows)
+	{
+		inEndRow = mRows -1;
+	}
+	mStartRow = inStartRow <= inEndRow ? inStartRow : inEndRow;
+	mEndRow = inEndRow;
+}
+
+/*********************************** Sleep ************************************/
+void FramebufferDisplayController::Sleep(void)
+{
+	CountTransaction(eSleepWakePrim, 1, 0);
+	mSleeping = true;
+}
+
+/*********************************** WakeUp ***********************************/
+void FramebufferDisplayController::WakeUp(void)
+{
+	CountTransaction(eSleepWakePrim, 1, 0);
+	mSleeping = false;
+}
+
+/******************************* HasPackedFill ********************************/
+bool FramebufferDisplayController::HasPackedFill(
+	uint16_t	inColor) const
+{
+	switch (inColor)	// BGR
+	{
+		case 0:			// 000	Black
+		case 0x001F:	// 001	Red
+		case 0x07E0:	// 010	Green
+		case 0x07FF:	// 011	Yellow
+		case 0xF800:	// 100	Blue
+		case 0xF81F:	// 101	Magenta
+		case 0xFFFE:	// 110	Cyan
+		case 0xFFFF:	// 111	White
+			return(true);
+	}
+	return(false);
+}
+
+/********************************* FillPixels *********************************/
+/*
+*	The byte counts mirror TFT_ILI9488::FillPixels.  The 8 colors supported by
+*	the 3-bit pixel format are sent as 2 pixels per byte, preceded by an odd
+*	18-bit pixel if needed, and bracketed by the COLMOD and WRMEMC commands.
+*	All other colors are sent as 3 bytes per pixel.
+*/
+void FramebufferDisplayController::FillPixels(
+	uint32_t	inPixelsToFill,
+	uint16_t	inFillColor)
+{
+	uint32_t	cmdBytes = 0;
+	uint32_t	dataBytes;
+	switch (inFillColor)	// BGR
+	{
+		case 0:			// 000	Black
+		case 0x001F:	// 001	Red
+		case 0x07E0:	// 010	Green
+		case 0x07FF:	// 011	Yellow
+		case 0xF800:	// 100	Blue
+		case 0xF81F:	// 101	Magenta
+		case 0xFFFE:	// 110	Cyan
+		case 0xFFFF:	// 111	White
+		{
+			uint32_t	pixelPairs = inPixelsToFill/2;
+			dataBytes = (inPixelsToFill & 1) ? 3 : 0;
+			if (pixelPairs)
+			{
+				cmdBytes = 3;	// COLMOD, WRMEMC, COLMOD
+				dataBytes += pixelPairs + 2;	// + the 2 COLMOD parameters
+			}
+			break;
+		}
+		default:
+			dataBytes = inPixelsToFill * 3;
+			break;
+	}
+	CountTransaction(eFillPixelsPrim, cmdBytes, dataBytes, inPixelsToFill);
+	for (; inPixelsToFill; inPixelsToFill--)
+	{
+		WritePixel(inFillColor);
+	}
+}
+
+/******************************** StreamCopy **********************************/
+void FramebufferDisplayController::StreamCopy(
+	DataStream*	inDataStream,	// A 16 bit data stream
+	uint16_t	inPixelsToCopy)
+{
+	CountTransaction(eStreamCopyPrim, 0, inPixelsToCopy * 3, inPixelsToCopy);
+	uint16_t	buffer[96];
+	uint32_t	runs = 0;
+	while (inPixelsToCopy)
+	{
+		uint32_t	pixelsToWrite = inPixelsToCopy;
+		const uint16_t*	pixels = (const uint16_t*)inDataStream->Acquire(pixelsToWrite);
+		if (!pixels)
+		{
+			pixelsToWrite = inPixelsToCopy > 96 ? 96 : inPixelsToCopy;
+			inDataStream->Read(pixelsToWrite, buffer);
+			pixels = buffer;
+		}
+		inPixelsToCopy -= pixelsToWrite;
+		runs++;
+		for (uint32_t i = 0; i < pixelsToWrite; i++)
+		{
+			WritePixel(pixels[i]);
+		}
+	}
+	// TFT_ILI9488 uses a transaction per acquired or 96 pixel run.
+	if (runs > 1)
+	{
+		mStats[eStreamCopyPrim].transactions += runs - 1;
+	}
+}
+
+/******************************** CopyPixels **********************************/
+void FramebufferDisplayController::CopyPixels(
+	const void*		inPixels,
+	uint16_t		inPixelsToCopy)
+{
+	CountTransaction(eCopyPixelsPrim, 0, inPixelsToCopy * 3, inPixelsToCopy);
+	const uint16_t*	pixels = (const uint16_t*)inPixels;
+	for (; inPixelsToCopy; inPixelsToCopy--)
+	{
+		WritePixel(*(pixels++));
+	}
+}
+
+/***************************** CopyTintedPattern ******************************/
+/*
+*	Same as TFT_ST77XX::CopyTintedPattern, which is inherited by TFT_ILI9488.
+*/
+void FramebufferDisplayController::CopyTintedPattern(
+	uint16_t		inX,
+	uint16_t		inY,
+	const uint8_t*	inTintPattern,
+	uint16_t		inPatternLen,
+	uint16_t		inReps,
+	bool			inVertical,
+	bool			inReverseOrder)
+{
+	uint16_t	colorPattern[inPatternLen];
+	uint8_t		thisTint;
+	uint8_t		lastTint;
+	uint16_t	color = 0;
+	if (inReverseOrder)
+	{
+		const uint8_t*	patternPtr = &inTintPattern[inPatternLen-1];
+		lastTint = *patternPtr + 1;
+		for (uint16_t i = 0; i < inPatternLen; i++)
+		{
+			thisTint = *(patternPtr--);
+			if (lastTint != thisTint)
+			{
+				lastTint = thisTint;
+				color = Calc565Color(thisTint);
+			}
+			colorPattern[i] = color;
+		}
+	} else
+	{
+		lastTint = inTintPattern[0] + 1;
+		for (uint16_t i = 0; i < inPatternLen; i++)
+		{
+			thisTint = inTintPattern[i];
+			if (lastTint != thisTint)
+			{
+				lastTint = thisTint;
+				color = Calc565Color(thisTint);
+			}
+			colorPattern[i] = color;
+		}
+	}
+	uint16_t	relativeWidth = inVertical ? 1 : inPatternLen;
+	for (uint16_t i = inReps; i; i--)
+	{
+		MoveTo(inY, inX);
+		DisplayController::SetColumnRange(relativeWidth);
+		if (inVertical)
+		{
+			inX++;
+		} else
+		{
+			inY++;
+		}
+		CopyPixels(colorPattern, inPatternLen);
+	}
+}
+
+/********************************** WritePPM **********************************/
+bool FramebufferDisplayController::WritePPM(
+	const char*	inPath) const
+{
+	FILE*	file = fopen(inPath, "wb");
+	bool	success = file != nullptr;
+	if (success)
+	{
+		fprintf(file, "P6\n%d %d\n255\n", mColumns, mRows);
+		uint8_t	rowBuffer[mColumns*3];
+		const uint16_t*	pixels = mPixels;
+		for (uint16_t row = 0; success && row < mRows; row++)
+		{
+			uint8_t*	bufferPtr = rowBuffer;
+			for (uint16_t column = 0; column < mColumns; column++)
+			{
+				uint16_t	color = *(pixels++);
+				uint8_t	red = color & 0x1F;
+				uint8_t	green = (color >> 5) & 0x3F;
+				uint8_t	blue = color >> 11;
+				*(bufferPtr++) = (red << 3) | (red >> 2);
+				*(bufferPtr++) = (green << 2) | (green >> 4);
+				*(bufferPtr++) = (blue << 3) | (blue >> 2);
+			}
+			success = fwrite(rowBuffer, 1, sizeof(rowBuffer), file) == sizeof(rowBuffer);
+		}
+		fclose(file);
+	}
+	return(success);
+}
+
+#endif // __MACH__
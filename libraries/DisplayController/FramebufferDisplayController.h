@@ -0,0 +1,165 @@
+/*
+*	FramebufferDisplayController.h, Copyright Jonathan Mackey 2023
+*	Host display controller that renders to an in-memory RGB565 image.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef FramebufferDisplayController_h
+#define FramebufferDisplayController_h
+
+/*
+*	FramebufferDisplayController is only used by host builds (Mac or Linux.)
+*	Host builds select the host code paths used throughout these libraries by
+*	defining __MACH__ (on Linux pass -D__MACH__ to the compiler.)
+*
+*	The controller emulates the TFT_ILI9488 address window and memory pointer
+*	so that the XView, XFont and DisplayController code renders exactly as it
+*	would on the display.  In addition to rendering, the command and data
+*	bytes that TFT_ILI9488 would have sent over SPI are counted per primitive.
+*	This allows the rendering cost to be measured and regression tested
+*	off-target.
+*/
+#ifdef __MACH__
+#include "DisplayController.h"
+
+class FramebufferDisplayController : public DisplayController
+{
+public:
+							FramebufferDisplayController(
+								uint16_t				inRows = 320,
+								uint16_t				inColumns = 480);
+	virtual					~FramebufferDisplayController(void);
+
+	virtual void			MoveTo(
+								uint16_t				inRow,
+								uint16_t				inColumn);
+	virtual void			MoveToRow(
+								uint16_t				inRow);
+	virtual void			MoveToColumn(
+								uint16_t				inColumn);
+	virtual void			Sleep(void);
+	virtual void			WakeUp(void);
+	virtual void			FillPixels(
+								uint32_t				inPixelsToFill,
+								uint16_t				inFillColor);
+	virtual void			SetColumnRange(
+								uint16_t				inStartColumn,
+								uint16_t				inEndColumn);
+	virtual void			SetRowRange(
+								uint16_t				inStartRow,
+								uint16_t				inEndRow);
+	virtual void			StreamCopy(
+								DataStream*				inDataStream,
+								uint16_t				inPixelsToCopy);
+	virtual void			CopyPixels(
+								const void*				inPixels,
+								uint16_t				inPixelsToCopy);
+	virtual void			CopyTintedPattern(
+								uint16_t				inX,
+								uint16_t				inY,
+								const uint8_t*			inPattern,
+								uint16_t				inPatternLen,
+								uint16_t				inReps,
+								bool					inVertical,
+								bool					inReverseOrder);
+	virtual void			SetAddressingMode(
+								EAddressingMode			inAddressingMode)
+								{mAddressingMode = inAddressingMode;}
+	// Same as TFT_ILI9488
+	virtual bool			HasPackedFill(
+								uint16_t				inColor) const;
+
+	/*
+	*	SPI accounting.  The primitives below are the only routines of
+	*	TFT_ILI9488 that communicate with the display controller.
+	*/
+	enum EPrimitive
+	{
+		eMoveToRowPrim,
+		eSetColumnRangePrim,
+		eSetRowRangePrim,
+		eFillPixelsPrim,
+		eStreamCopyPrim,
+		eCopyPixelsPrim,
+		eSleepWakePrim,
+		eNumPrimitives
+	};
+	struct SSPIStats
+	{
+		uint32_t	calls;
+		uint32_t	transactions;	// BeginTransaction/EndTransaction pairs
+		uint32_t	cmdBytes;		// Bytes sent with DC low
+		uint32_t	dataBytes;		// Bytes sent with DC high
+		uint32_t	pixels;			// Pixels written to display memory
+	};
+	void					ResetStats(void);
+	const SSPIStats&		GetStats(
+								EPrimitive				inPrimitive) const
+								{return(mStats[inPrimitive]);}
+	/*
+	*	GetTotals: Returns the sum of the stats of all primitives.
+	*/
+	void					GetTotals(
+								SSPIStats&				outTotals) const;
+	static const char*		PrimitiveName(
+								EPrimitive				inPrimitive);
+
+	/*
+	*	Image access.  Pixels are RGB565 in the BGR order used by the
+	*	XFont::E565Colors (red is the low 5 bits.)
+	*/
+	const uint16_t*			GetPixels(void) const
+								{return(mPixels);}
+	uint16_t				GetPixel(
+								uint16_t				inX,
+								uint16_t				inY) const
+								{return(mPixels[(inY * mColumns) + inX]);}
+	/*
+	*	WritePPM: Writes the image as a binary (P6) PPM file.
+	*	Returns true if successful.
+	*/
+	bool					WritePPM(
+								const char*				inPath) const;
+protected:
+	uint16_t*	mPixels;
+	uint16_t	mStartColumn;	// Emulated controller address window
+	uint16_t	mEndColumn;
+	uint16_t	mStartRow;
+	uint16_t	mEndRow;
+	uint16_t	mWriteRow;		// Emulated controller memory pointer
+	uint16_t	mWriteColumn;
+	bool		mSleeping;
+	SSPIStats	mStats[eNumPrimitives];
+
+	inline void				WritePixel(
+								uint16_t				inColor)
+								{
+									mPixels[(mWriteRow * mColumns) + mWriteColumn] = inColor;
+									AdvanceWritePtr();
+								}
+	void					AdvanceWritePtr(void);
+	void					CountTransaction(
+								EPrimitive				inPrimitive,
+								uint32_t				inCmdBytes,
+								uint32_t				inDataBytes,
+								uint32_t				inPixels = 0);
+};
+
+#endif // __MACH__
+#endif // FramebufferDisplayController_h
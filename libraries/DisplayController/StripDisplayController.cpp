@@ -0,0 +1,395 @@
+/*
+*	StripDisplayController.cpp, Copyright Jonathan Mackey 2023
+*	Off-screen strip compositor for 16 bit color displays.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "StripDisplayController.h"
+#include "DataStream.h"
+
+
+/*************************** StripDisplayController ***************************/
+StripDisplayController::StripDisplayController(
+	uint16_t*	inBuffer,
+	uint16_t	inBufferPixels)
+	: DisplayController(0, 0), mTarget(nullptr),
+	  mBuffer(inBuffer), mBufferPixels(inBufferPixels),
+	  mX(0), mY(0), mWidth(0), mHeight(0), mStripBGColor(0),
+	  mStripY(0), mStripRows(0), mStartColumn(0), mEndColumn(0),
+	  mStartRow(0), mEndRow(0), mWriteRow(0), mWriteColumn(0)
+{
+}
+
+/******************************** BeginStrips *********************************/
+/*
+*	Sets up the first strip of the area to be composited.  The area is clipped
+*	to the target display.  Returns false if nothing can be composited, either
+*	because the clipped area is empty or because a single row of the area
+*	won't fit in the buffer.
+*/
+bool StripDisplayController::BeginStrips(
+	DisplayController*	inTarget,
+	int32_t				inX,
+	int32_t				inY,
+	int32_t				inWidth,
+	int32_t				inHeight,
+	uint16_t			inBGColor)
+{
+	bool	success = false;
+	mTarget = inTarget;
+	if (inTarget)
+	{
+		mRows = inTarget->GetRows();
+		mColumns = inTarget->GetColumns();
+		ClipX(inX, inWidth);
+		ClipY(inY, inHeight);
+		if (inWidth > 0 &&
+			inHeight > 0 &&
+			inWidth <= mBufferPixels)
+		{
+			mX = inX;
+			mY = inY;
+			mWidth = inWidth;
+			mHeight = inHeight;
+			mStripBGColor = inBGColor;
+			mFGColor = inTarget->GetFGColor();
+			mBGColor = inTarget->GetBGColor();
+			mStripY = mY;
+			mStripRows = mBufferPixels/mWidth;
+			if (mStripRows > mHeight)
+			{
+				mStripRows = mHeight;
+			}
+			ClearStrip();
+			MoveTo(mY, mX);
+			SetColumnRange(0, mColumns-1);
+			success = true;
+		}
+	}
+	return(success);
+}
+
+/********************************* NextStrip **********************************/
+bool StripDisplayController::NextStrip(void)
+{
+	bool	anotherStrip = false;
+	if (mStripRows)
+	{
+		/*
+		*	Flush the strip using a single address window.
+		*	MoveTo must be called before SetColumnRange on the TFT displays.
+		*	See DisplayController::Fill.
+		*/
+		mTarget->MoveTo(mStripY, mX);
+		mTarget->SetColumnRange(mX, mX + mWidth -1);
+		mTarget->CopyPixels(mBuffer, mWidth * mStripRows);
+
+		mStripY += mStripRows;
+		uint16_t	rowsRemaining = mY + mHeight - mStripY;
+		if (rowsRemaining)
+		{
+			if (mStripRows > rowsRemaining)
+			{
+				mStripRows = rowsRemaining;
+			}
+			ClearStrip();
+			MoveTo(mY, mX);
+			SetColumnRange(0, mColumns-1);
+			anotherStrip = true;
+		} else
+		{
+			mStripRows = 0;
+		}
+	}
+	return(anotherStrip);
+}
+
+/********************************* ClearStrip *********************************/
+void StripDisplayController::ClearStrip(void)
+{
+	uint16_t*	bufferPtr = mBuffer;
+	uint16_t*	endPtr = &mBuffer[mWidth * mStripRows];
+	while (bufferPtr < endPtr)
+	{
+		*(bufferPtr++) = mStripBGColor;
+	}
+}
+
+/*********************************** MoveTo ***********************************/
+void StripDisplayController::MoveTo(
+	uint16_t	inRow,
+	uint16_t	inColumn)
+{
+	MoveToRow(inRow);
+	mColumn = inColumn;
+}
+
+/********************************* MoveToRow **********************************/
+/*
+*	Same as the TFT controllers, the row range is set from inRow to the last
+*	row.  The memory pointer isn't reset until SetColumnRange is called.
+*/
+void StripDisplayController::MoveToRow(
+	uint16_t inRow)
+{
+	mStartRow = inRow;
+	mEndRow = mRows -1;
+	mRow = inRow;
+}
+
+/******************************** MoveToColumn ********************************/
+void StripDisplayController::MoveToColumn(
+	uint16_t inColumn)
+{
+	mColumn = inColumn;
+}
+
+/******************************* SetColumnRange *******************************/
+/*
+*	Equivalent of CASET followed by RAMWR.  The memory pointer is reset to the
+*	start of the row and column range.
+*/
+void StripDisplayController::SetColumnRange(
+	uint16_t	inStartColumn,
+	uint16_t	inEndColumn)
+{
+	mStartColumn = inStartColumn;
+	mEndColumn = inEndColumn >= inStartColumn ? inEndColumn : inStartColumn;
+	mWriteRow = mStartRow;
+	mWriteColumn = mStartColumn;
+}
+
+/******************************* SetRowRange *******************************/
+void StripDisplayController::SetRowRange(
+	uint16_t	inStartRow,
+	uint16_t	inEndRow)
+{
+	mStartRow = inStartRow;
+	mEndRow = inEndRow >= inStartRow ? inEndRow : inStartRow;
+}
+
+/********************************** NextRun ***********************************/
+/*
+*	Returns the run of up to inPixels that remain in the current row of the
+*	emulated address window, advancing the emulated memory pointer past it.
+*
+*	outRunLength is the number of pixels consumed.  If any part of the run is
+*	within the strip, the address of the first visible pixel in the strip
+*	buffer is returned, outLeadingSkip is the number of clipped pixels that
+*	precede it, and outVisibleLength is the number of visible pixels.  If no
+*	part of the run is visible, nullptr is returned.
+*/
+uint16_t* StripDisplayController::NextRun(
+	uint32_t	inPixels,
+	uint16_t&	outRunLength,
+	uint16_t&	outLeadingSkip,
+	uint16_t&	outVisibleLength)
+{
+	uint16_t*	run = nullptr;
+	uint32_t	runLength = mEndColumn - mWriteColumn + 1;
+	if (runLength > inPixels)
+	{
+		runLength = inPixels;
+	}
+	outRunLength = runLength;
+	outLeadingSkip = 0;
+	outVisibleLength = 0;
+	if (mWriteRow >= mStripY &&
+		mWriteRow < (mStripY + mStripRows))
+	{
+		uint32_t	startColumn = mWriteColumn > mX ? mWriteColumn : mX;
+		uint32_t	endColumn = mWriteColumn + runLength;
+		if (endColumn > (uint32_t)(mX + mWidth))
+		{
+			endColumn = mX + mWidth;
+		}
+		if (startColumn < endColumn)
+		{
+			outLeadingSkip = startColumn - mWriteColumn;
+			outVisibleLength = endColumn - startColumn;
+			run = &mBuffer[((mWriteRow - mStripY) * mWidth) + startColumn - mX];
+		}
+	}
+	/*
+	*	Advance the memory pointer.  Same as the controller, when the end of
+	*	the column range is reached the pointer moves to the start column of the
+	*	next row, and wraps to the first row after the last row.
+	*/
+	mWriteColumn += runLength;
+	if (mWriteColumn > mEndColumn)
+	{
+		mWriteColumn = mStartColumn;
+		if (mWriteRow < mEndRow)
+		{
+			mWriteRow++;
+		} else
+		{
+			mWriteRow = mStartRow;
+		}
+	}
+	return(run);
+}
+
+/********************************* FillPixels *********************************/
+void StripDisplayController::FillPixels(
+	uint32_t	inPixelsToFill,
+	uint16_t	inFillColor)
+{
+	uint16_t	runLength, leadingSkip, visibleLength;
+	while (inPixelsToFill)
+	{
+		uint16_t*	run = NextRun(inPixelsToFill, runLength, leadingSkip, visibleLength);
+		if (run)
+		{
+			uint16_t*	endRun = &run[visibleLength];
+			while (run < endRun)
+			{
+				*(run++) = inFillColor;
+			}
+		}
+		inPixelsToFill -= runLength;
+	}
+}
+
+/******************************** StreamCopy **********************************/
+void StripDisplayController::StreamCopy(
+	DataStream*	inDataStream,	// A 16 bit data stream
+	uint16_t	inPixelsToCopy)
+{
+	uint16_t	runLength, leadingSkip, visibleLength;
+	uint16_t	buffer[96];
+	while (inPixelsToCopy)
+	{
+		uint16_t*	run = NextRun(inPixelsToCopy, runLength, leadingSkip, visibleLength);
+		inPixelsToCopy -= runLength;
+		/*
+		*	If the entire run is visible THEN
+		*	read it directly into the strip buffer.
+		*/
+		if (visibleLength == runLength)
+		{
+			inDataStream->Read(runLength, run);
+		/*
+		*	Else read the run in chunks, only keeping the visible pixels.
+		*/
+		} else
+		{
+			uint16_t	runOffset = 0;
+			uint16_t	visibleEnd = leadingSkip + visibleLength;
+			while (runOffset < runLength)
+			{
+				uint16_t	pixelsToRead = runLength - runOffset;
+				if (pixelsToRead > 96)
+				{
+					pixelsToRead = 96;
+				}
+				inDataStream->Read(pixelsToRead, buffer);
+				for (uint16_t i = 0; i < pixelsToRead; i++, runOffset++)
+				{
+					if (runOffset >= leadingSkip &&
+						runOffset < visibleEnd)
+					{
+						*(run++) = buffer[i];
+					}
+				}
+			}
+		}
+	}
+}
+
+/******************************** CopyPixels **********************************/
+void StripDisplayController::CopyPixels(
+	const void*		inPixels,
+	uint16_t		inPixelsToCopy)
+{
+	const uint16_t*	pixels = (const uint16_t*)inPixels;
+	uint16_t	runLength, leadingSkip, visibleLength;
+	while (inPixelsToCopy)
+	{
+		uint16_t*	run = NextRun(inPixelsToCopy, runLength, leadingSkip, visibleLength);
+		if (run)
+		{
+			memcpy(run, &pixels[leadingSkip], visibleLength*2);
+		}
+		pixels += runLength;
+		inPixelsToCopy -= runLength;
+	}
+}
+
+/***************************** CopyTintedPattern ******************************/
+/*
+*	Same as TFT_ST77XX::CopyTintedPattern.  The tints are converted to colors
+*	using the foreground and background colors.
+*/
+void StripDisplayController::CopyTintedPattern(
+	uint16_t		inX,
+	uint16_t		inY,
+	const uint8_t*	inTintPattern,
+	uint16_t		inPatternLen,
+	uint16_t		inReps,
+	bool			inVertical,
+	bool			inReverseOrder)
+{
+	uint16_t	colorPattern[inPatternLen];
+	uint8_t		thisTint;
+	uint8_t		lastTint;
+	uint16_t	color = 0;
+	if (inReverseOrder)
+	{
+		const uint8_t*	patternPtr = &inTintPattern[inPatternLen-1];
+		lastTint = *patternPtr + 1;
+		for (uint16_t i = 0; i < inPatternLen; i++)
+		{
+			thisTint = *(patternPtr--);
+			if (lastTint != thisTint)
+			{
+				lastTint = thisTint;
+				color = Calc565Color(thisTint);
+			}
+			colorPattern[i] = color;
+		}
+	} else
+	{
+		lastTint = inTintPattern[0] + 1;
+		for (uint16_t i = 0; i < inPatternLen; i++)
+		{
+			thisTint = inTintPattern[i];
+			if (lastTint != thisTint)
+			{
+				lastTint = thisTint;
+				color = Calc565Color(thisTint);
+			}
+			colorPattern[i] = color;
+		}
+	}
+	uint16_t	relativeWidth = inVertical ? 1 : inPatternLen;
+	for (uint16_t i = inReps; i; i--)
+	{
+		MoveTo(inY, inX);
+		DisplayController::SetColumnRange(relativeWidth);
+		if (inVertical)
+		{
+			inX++;
+		} else
+		{
+			inY++;
+		}
+		CopyPixels(colorPattern, inPatternLen);
+	}
+}
@@ -0,0 +1,143 @@
+/*
+*	StripDisplayController.h, Copyright Jonathan Mackey 2023
+*	Off-screen strip compositor for 16 bit color displays.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef StripDisplayController_h
+#define StripDisplayController_h
+
+#include "DisplayController.h"
+
+/*
+*	StripDisplayController renders into an N row RGB565 buffer in SRAM rather
+*	than to the display.  It uses the same global coordinates as the target
+*	display and emulates the controller's address window, so the
+*	DisplayController primitives and XFont draw into it unchanged.  Anything
+*	drawn outside of the current strip is clipped.
+*
+*	When a strip is complete it's flushed to the target display using a
+*	single address window and one CopyPixels call.  An area taller than the
+*	buffer is rendered as a series of strips, redrawing the content once per
+*	strip:
+*
+*		if (strip.BeginStrips(display, x, y, width, height, bgColor))
+*		{
+*			do
+*			{
+*				... draw to &strip ...
+*			} while (strip.NextStrip());
+*		}
+*
+*	BeginStrips returns false if the area isn't at least one buffer row, in
+*	which case the caller should draw directly to the target display.
+*
+*	Only the horizontal addressing mode is supported.
+*/
+class StripDisplayController : public DisplayController
+{
+public:
+							StripDisplayController(
+								uint16_t*				inBuffer,
+								uint16_t				inBufferPixels);
+	bool					BeginStrips(
+								DisplayController*		inTarget,
+								int32_t					inX,
+								int32_t					inY,
+								int32_t					inWidth,
+								int32_t					inHeight,
+								uint16_t				inBGColor);
+	/*
+	*	NextStrip: Flushes the current strip to the target display.  Returns
+	*	true if there is another strip to be drawn.
+	*/
+	bool					NextStrip(void);
+	DisplayController*		GetTarget(void) const
+								{return(mTarget);}
+	uint16_t				StripRows(void) const
+								{return(mStripRows);}
+	/*
+	*	FitsOneStrip: Returns true if an area inWidth x inHeight can be
+	*	composited as a single strip, i.e. drawn once.
+	*/
+	bool					FitsOneStrip(
+								uint16_t				inWidth,
+								uint16_t				inHeight) const
+								{return(((uint32_t)inWidth * inHeight) <= mBufferPixels);}
+	virtual void			MoveTo(
+								uint16_t				inRow,
+								uint16_t				inColumn);
+	virtual void			MoveToRow(
+								uint16_t				inRow);
+	virtual void			MoveToColumn(
+								uint16_t				inColumn);
+	virtual void			Sleep(void){}
+	virtual void			WakeUp(void){}
+	virtual void			FillPixels(
+								uint32_t				inPixelsToFill,
+								uint16_t				inFillColor);
+	virtual void			SetColumnRange(
+								uint16_t				inStartColumn,
+								uint16_t				inEndColumn);
+	virtual void			SetRowRange(
+								uint16_t				inStartRow,
+								uint16_t				inEndRow);
+	virtual void			StreamCopy(
+								DataStream*				inDataStream,
+								uint16_t				inPixelsToCopy);
+	virtual void			CopyPixels(
+								const void*				inPixels,
+								uint16_t				inPixelsToCopy);
+	virtual void			CopyTintedPattern(
+								uint16_t				inX,
+								uint16_t				inY,
+								const uint8_t*			inPattern,
+								uint16_t				inPatternLen,
+								uint16_t				inReps,
+								bool					inVertical,
+								bool					inReverseOrder);
+	virtual void			SetAddressingMode(
+								EAddressingMode			inAddressingMode){}
+protected:
+	DisplayController*	mTarget;
+	uint16_t*	mBuffer;
+	uint16_t	mBufferPixels;
+	uint16_t	mX;				// The composited area
+	uint16_t	mY;
+	uint16_t	mWidth;
+	uint16_t	mHeight;
+	uint16_t	mStripBGColor;	// Each strip is cleared to this color
+	uint16_t	mStripY;		// The top row of the current strip
+	uint16_t	mStripRows;		// Rows in the current strip
+	uint16_t	mStartColumn;	// Emulated controller address window
+	uint16_t	mEndColumn;
+	uint16_t	mStartRow;
+	uint16_t	mEndRow;
+	uint16_t	mWriteRow;		// Emulated controller memory pointer
+	uint16_t	mWriteColumn;
+
+	void					ClearStrip(void);
+	uint16_t*				NextRun(
+								uint32_t				inPixels,
+								uint16_t&				outRunLength,
+								uint16_t&				outLeadingSkip,
+								uint16_t&				outVisibleLength);
+};
+
+#endif // StripDisplayController_h
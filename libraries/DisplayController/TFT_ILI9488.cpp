@@ -118,6 +118,25 @@ void TFT_ILI9488::Init(void)
 	After optimizing for 3-bit fill
 	Fill time = 153860	(15ms)
 */
+/******************************* HasPackedFill ********************************/
+bool TFT_ILI9488::HasPackedFill(
+	uint16_t	inColor) const
+{
+	switch (inColor)	// BGR
+	{
+		case 0:			// 000	Black
+		case 0x001F:	// 001	Red
+		case 0x07E0:	// 010	Green
+		case 0x07FF:	// 011	Yellow
+		case 0xF800:	// 100	Blue
+		case 0xF81F:	// 101	Magenta
+		case 0xFFFE:	// 110	Cyan
+		case 0xFFFF:	// 111	White
+			return(true);
+	}
+	return(false);
+}
+
 /********************************* FillPixels *********************************/
 /*
 *	This is an override of the TFT_ST77XX routine.  This override converts
@@ -269,20 +288,33 @@ void TFT_ILI9488::FillPixels(
 }
 
 /******************************** StreamCopy **********************************/
+/*
+*	Each run of pixels is acquired or read before the display is selected
+*	because the data stream may be on a device that shares the SPI bus (e.g.
+*	a file on the SD card.)  The memory write continues from one transaction
+*	to the next.  Pixels that can be acquired (see DataStream::Acquire) are
+*	written in place without copying them to the local buffer.
+*/
 void TFT_ILI9488::StreamCopy(
-	DataStream* inDataStream,	// A 16 bit data stream
+	DataStream*	inDataStream,	// A 16 bit data stream
 	uint16_t	inPixelsToCopy)
 {
-	BeginTransaction();
 	uint16_t	buffer[96];	// WritePixelData's buffer holds 96 pixels.
 	while (inPixelsToCopy)
 	{
-		uint16_t pixelsToWrite = inPixelsToCopy > 96 ? 96 : inPixelsToCopy;
+		uint32_t	pixelsToWrite = inPixelsToCopy;
+		const uint16_t*	pixels = (const uint16_t*)inDataStream->Acquire(pixelsToWrite);
+		if (!pixels)
+		{
+			pixelsToWrite = inPixelsToCopy > 96 ? 96 : inPixelsToCopy;
+			inDataStream->Read(pixelsToWrite, buffer);
+			pixels = buffer;
+		}
 		inPixelsToCopy -= pixelsToWrite;
-		inDataStream->Read(pixelsToWrite, buffer);
-		WritePixelData(buffer, pixelsToWrite);
+		BeginTransaction();
+		WritePixelData(pixels, pixelsToWrite);
+		EndTransaction();
 	}
-	EndTransaction();
 }
 
 /******************************** CopyPixels **********************************/
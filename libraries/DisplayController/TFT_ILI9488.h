@@ -52,6 +52,12 @@ public:
 	virtual void			CopyPixels(
 								const void*				inPixels,
 								uint16_t				inPixelsToCopy);
+	/*
+	*	The 8 colors supported by the 3-bit pixel format are filled 2 pixels
+	*	per byte.
+	*/
+	virtual bool			HasPackedFill(
+								uint16_t				inColor) const;
 protected:
 	static const uint8_t k5To6Bit[];
 	enum
@@ -468,20 +468,33 @@ void TFT_ST77XX::SetRowRange(
 }
 
 /******************************** StreamCopy **********************************/
+/*
+*	Each run of pixels is acquired or read before the display is selected
+*	because the data stream may be on a device that shares the SPI bus (e.g.
+*	a file on the SD card.)  The memory write continues from one transaction
+*	to the next.  Pixels that can be acquired (see DataStream::Acquire) are
+*	written in place without copying them to the local buffer.
+*/
 void TFT_ST77XX::StreamCopy(
 	DataStream*	inDataStream,	// A 16 bit data stream
 	uint16_t	inPixelsToCopy)
 {
-	BeginTransaction();
 	uint16_t	buffer[96];
 	while (inPixelsToCopy)
 	{
-		uint16_t pixelsToWrite = inPixelsToCopy > 96 ? 96 : inPixelsToCopy;
+		uint32_t	pixelsToWrite = inPixelsToCopy;
+		const uint16_t*	pixels = (const uint16_t*)inDataStream->Acquire(pixelsToWrite);
+		if (!pixels)
+		{
+			pixelsToWrite = inPixelsToCopy > 96 ? 96 : inPixelsToCopy;
+			inDataStream->Read(pixelsToWrite, buffer);
+			pixels = buffer;
+		}
 		inPixelsToCopy -= pixelsToWrite;
-		inDataStream->Read(pixelsToWrite, buffer);
-		WriteData16(buffer, pixelsToWrite);
+		BeginTransaction();
+		WriteData16(pixels, pixelsToWrite);
+		EndTransaction();
 	}
-	EndTransaction();
 }
 
 /******************************** CopyPixels **********************************/
@@ -530,7 +543,7 @@ void TFT_ST77XX::CopyTintedPattern(
 			if (lastTint != thisTint)
 			{
 				lastTint = thisTint;
-				color = Calc565Color(mFGColor, mBGColor, thisTint);
+				color = Calc565Color(thisTint);
 			}
 			colorPattern[i] = color;
 		}
@@ -543,7 +556,7 @@ void TFT_ST77XX::CopyTintedPattern(
 			if (lastTint != thisTint)
 			{
 				lastTint = thisTint;
-				color = Calc565Color(mFGColor, mBGColor, thisTint);
+				color = Calc565Color(thisTint);
 			}
 			colorPattern[i] = color;
 		}
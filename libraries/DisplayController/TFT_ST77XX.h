@@ -24,6 +24,7 @@
 #define TFT_ST77XX_h
 #include <SPI.h>
 #include "DisplayController.h"
+#include "SPIBus.h"
 
 class DataStream;
 
@@ -184,7 +185,7 @@ protected:
 								uint8_t					inRotation);
 	inline void				BeginTransaction(void)
 							{
-								SPI.beginTransaction(mSPISettings);
+								SPIBus::BeginTransaction(mSPISettings);
 								if (mCSPin >= 0)
 								{
 									*mChipSelPortReg &= ~mChipSelBitMask;
@@ -198,7 +199,7 @@ protected:
 								{
 									*mChipSelPortReg |= mChipSelBitMask;
 								}
-								SPI.endTransaction();
+								SPIBus::EndTransaction();
 							}
 
 	inline void				WriteCmd(
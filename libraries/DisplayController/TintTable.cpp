@@ -0,0 +1,55 @@
+/*
+*	TintTable.cpp, Copyright Jonathan Mackey 2023
+*	Table of 565 colors for each of the 256 tints between two colors.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "TintTable.h"
+#include "DisplayController.h"
+#include <string.h>
+
+/********************************* TintTable **********************************/
+TintTable::TintTable(void)
+{
+	Reset(0xFFFF, 0);
+}
+
+/*********************************** Reset ************************************/
+void TintTable::Reset(
+	uint16_t	inFGColor,
+	uint16_t	inBGColor)
+{
+	mFGColor = inFGColor;
+	mBGColor = inBGColor;
+#if TINT_TABLE_SIZE
+	memset(mValid, 0, sizeof(mValid));
+#endif
+}
+
+/********************************* CalcColor **********************************/
+uint16_t TintTable::CalcColor(
+	uint8_t	inTint)
+{
+	uint16_t	color = DisplayController::Calc565Color(mFGColor, mBGColor, inTint);
+#if TINT_TABLE_SIZE
+	mColors[inTint] = color;
+	mValid[inTint >> 3] |= (1 << (inTint & 7));
+#endif
+	return(color);
+}
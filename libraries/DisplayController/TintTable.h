@@ -0,0 +1,90 @@
+/*
+*	TintTable.h, Copyright Jonathan Mackey 2023
+*	Table of 565 colors for each of the 256 tints between two colors.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef TintTable_h
+#define TintTable_h
+
+#include <inttypes.h>
+
+/*
+*	TintTable replaces the per pixel blending of DisplayController::Calc565Color
+*	with a lookup.  The anti-aliased glyphs and shapes only use a few colors at
+*	a time, and the same tints are used over and over.
+*
+*	The table is filled lazily.  Calculating all 256 colors each time the
+*	colors change would cost more than it saves when only a handful of tints
+*	are used, e.g. a FillTintedRect.  A tint's color is calculated the first
+*	time it's used after SetColors changes the colors.  The result is always
+*	the same as Calc565Color.
+*
+*	On AVR the 544 bytes of RAM can't be spared, so each color is calculated.
+*/
+#ifdef __AVR__
+#define TINT_TABLE_SIZE	0
+#else
+#define TINT_TABLE_SIZE	256
+#endif
+
+class TintTable
+{
+public:
+							TintTable(void);
+	/*
+	*	SetColors: Sets the foreground (tint 255) and background (tint 0)
+	*	colors.  Does nothing if the colors haven't changed.
+	*/
+	void					SetColors(
+								uint16_t				inFGColor,
+								uint16_t				inBGColor)
+								{
+									if (inFGColor != mFGColor ||
+										inBGColor != mBGColor)
+									{
+										Reset(inFGColor, inBGColor);
+									}
+								}
+	uint16_t				Color(
+								uint8_t					inTint)
+								{
+								#if TINT_TABLE_SIZE
+									return((mValid[inTint >> 3] & (1 << (inTint & 7))) ?
+												mColors[inTint] : CalcColor(inTint));
+								#else
+									return(CalcColor(inTint));
+								#endif
+								}
+protected:
+	uint16_t	mFGColor;
+	uint16_t	mBGColor;
+#if TINT_TABLE_SIZE
+	uint8_t		mValid[TINT_TABLE_SIZE/8];	// One bit per tint, set when mColors is valid
+	uint16_t	mColors[TINT_TABLE_SIZE];
+#endif
+
+	void					Reset(
+								uint16_t				inFGColor,
+								uint16_t				inBGColor);
+	uint16_t				CalcColor(
+								uint8_t					inTint);
+};
+
+#endif // TintTable_h
@@ -0,0 +1,180 @@
+/*
+*	TintedSpan.cpp, Copyright Jonathan Mackey 2023
+*	Writes a horizontal run of tinted pixels using a single address window.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "TintedSpan.h"
+#include "DisplayController.h"
+#include "TintTable.h"
+
+/********************************* TintedSpan *********************************/
+TintedSpan::TintedSpan(
+	DisplayController*	inDisplay)
+	: mDisplay(inDisplay), mFGColor(inDisplay->GetFGColor()),
+	  mBGColor(inDisplay->GetBGColor()), mSkip(0), mRemaining(0),
+	  mRunLength(0), mRunTint(0), mLastTint(255),
+	  mLastColor(inDisplay->GetFGColor()), mBufferLength(0)
+{
+}
+
+/*********************************** Begin ************************************/
+/*
+*	Sets up the address window for the visible part of the span.
+*	Returns false if no part of the span is visible.
+*/
+bool TintedSpan::Begin(
+	int32_t	inX,
+	int32_t	inY,
+	int32_t	inLength)
+{
+	int32_t	rows = 1;
+	mSkip = mDisplay->ClipX(inX, inLength);
+	mDisplay->ClipY(inY, rows);
+	mRemaining = rows > 0 && inLength > 0 ? inLength : 0;
+	mRunLength = 0;
+	mBufferLength = 0;
+	if (mRemaining)
+	{
+		mDisplay->MoveTo(inY, inX);
+		mDisplay->SetColumnRange(mRemaining);
+	}
+	return(mRemaining != 0);
+}
+
+/*********************************** Append ***********************************/
+void TintedSpan::Append(
+	const uint8_t*	inTints,
+	uint16_t		inLength,
+	bool			inReverseOrder)
+{
+	int16_t	step = 1;
+	if (inReverseOrder)
+	{
+		inTints += (inLength-1);
+		step = -1;
+	}
+	while (inLength)
+	{
+		uint8_t		tint = *inTints;
+		uint16_t	runLength = 1;
+		inTints += step;
+		while (runLength < inLength &&
+			*inTints == tint)
+		{
+			runLength++;
+			inTints += step;
+		}
+		inLength -= runLength;
+		AppendRun(tint, runLength);
+	}
+}
+
+/********************************* AppendRun **********************************/
+void TintedSpan::AppendRun(
+	uint8_t		inTint,
+	uint16_t	inLength)
+{
+	/*
+	*	Discard any pixels clipped on the left or right.
+	*/
+	if (mSkip)
+	{
+		uint16_t	skip = mSkip < inLength ? mSkip : inLength;
+		mSkip -= skip;
+		inLength -= skip;
+	}
+	if (inLength > mRemaining)
+	{
+		inLength = mRemaining;
+	}
+	if (inLength)
+	{
+		mRemaining -= inLength;
+		/*
+		*	If this continues the pending run THEN
+		*	merge it.
+		*/
+		if (mRunLength &&
+			mRunTint == inTint)
+		{
+			mRunLength += inLength;
+		} else
+		{
+			CommitRun();
+			mRunTint = inTint;
+			mRunLength = inLength;
+		}
+	}
+}
+
+/************************************ End *************************************/
+void TintedSpan::End(void)
+{
+	CommitRun();
+	FlushBuffer();
+}
+
+/********************************* CommitRun **********************************/
+void TintedSpan::CommitRun(void)
+{
+	if (mRunLength)
+	{
+		if (mRunTint != mLastTint)
+		{
+			TintTable&	tints = DisplayController::GetTintTable();
+			tints.SetColors(mFGColor, mBGColor);
+			mLastTint = mRunTint;
+			mLastColor = tints.Color(mRunTint);
+		}
+		/*
+		*	If the run is long THEN
+		*	send it as a fill.
+		*/
+		if (mRunLength >= kMinFillRun)
+		{
+			FlushBuffer();
+			mDisplay->FillPixels(mRunLength, mLastColor);
+		/*
+		*	Else add it to the buffer of pixels to be copied.
+		*/
+		} else
+		{
+			for (uint16_t i = mRunLength; i; i--)
+			{
+				if (mBufferLength == kBufferPixels)
+				{
+					FlushBuffer();
+				}
+				mBuffer[mBufferLength++] = mLastColor;
+			}
+		}
+		mRunLength = 0;
+	}
+}
+
+/******************************** FlushBuffer *********************************/
+void TintedSpan::FlushBuffer(void)
+{
+	if (mBufferLength)
+	{
+		mDisplay->CopyPixels(mBuffer, mBufferLength);
+		mBufferLength = 0;
+	}
+}
@@ -0,0 +1,90 @@
+/*
+*	TintedSpan.h, Copyright Jonathan Mackey 2023
+*	Writes a horizontal run of tinted pixels using a single address window.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef TintedSpan_h
+#define TintedSpan_h
+
+#include <inttypes.h>
+
+class DisplayController;
+
+/*
+*	TintedSpan is used by the anti-aliased drawing routines of 16 bit color
+*	displays.  Rather than sending each short pattern with its own address
+*	window, the tints of one scanline are appended to a span that is sent as a
+*	single address window.  Within the span, adjacent pixels of the same tint
+*	are merged into runs.  Long runs are sent using FillPixels, the remaining
+*	pixels are converted to colors and sent using CopyPixels.
+*
+*	The tints are converted to colors using the display's foreground and
+*	background colors at the time the TintedSpan is created.  The conversion
+*	uses the tint table shared with the other anti-aliased routines.
+*
+*	Usage:
+*		TintedSpan	span(display);
+*		if (span.Begin(x, y, width))
+*		{
+*			span.Append(...);
+*			span.AppendRun(...);
+*			span.End();
+*		}
+*
+*	The span is clipped to the display.  The total number of pixels appended
+*	must equal the inLength passed to Begin.
+*/
+class TintedSpan
+{
+public:
+							TintedSpan(
+								DisplayController*		inDisplay);
+	bool					Begin(
+								int32_t					inX,
+								int32_t					inY,
+								int32_t					inLength);
+	void					Append(
+								const uint8_t*			inTints,
+								uint16_t				inLength,
+								bool					inReverseOrder = false);
+	void					AppendRun(
+								uint8_t					inTint,
+								uint16_t				inLength);
+	void					End(void);
+protected:
+	DisplayController*	mDisplay;
+	uint16_t	mFGColor;
+	uint16_t	mBGColor;
+	uint16_t	mSkip;			// Clipped pixels remaining on the left
+	uint16_t	mRemaining;		// Visible pixels remaining
+	uint16_t	mRunLength;		// The pending run of mRunTint
+	uint8_t		mRunTint;
+	uint8_t		mLastTint;		// Tint of mLastColor
+	uint16_t	mLastColor;
+	uint16_t	mBufferLength;
+	static const uint16_t	kMinFillRun = 8;
+	static const uint16_t	kBufferPixels = 32;
+	uint16_t	mBuffer[kBufferPixels];
+
+	void					CommitRun(void);
+	void					FlushBuffer(void);
+};
+
+#endif // TintedSpan_h
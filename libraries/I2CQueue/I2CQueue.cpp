@@ -0,0 +1,197 @@
+/*
+*	I2CQueue.cpp, Copyright Jonathan Mackey 2023
+*	Queue of I2C transactions executed from the loop.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "Arduino.h"
+#include "I2CQueue.h"
+#include <Wire.h>
+
+/********************************** SetWrite **********************************/
+void I2CTransaction::SetWrite(
+	uint8_t			inDeviceAddress,
+	uint16_t		inHeader,
+	uint8_t			inHeaderLength,
+	const uint8_t*	inData,
+	uint8_t			inLength,
+	bool			inPollReady)
+{
+	mDeviceAddress = inDeviceAddress;
+	mHeader = inHeader;
+	mHeaderLength = inHeaderLength;
+	mData = (uint8_t*)inData;
+	mLength = inLength;
+	mRead = false;
+	mPollReady = inPollReady;
+}
+
+/********************************** SetRead ***********************************/
+void I2CTransaction::SetRead(
+	uint8_t		inDeviceAddress,
+	uint16_t	inHeader,
+	uint8_t		inHeaderLength,
+	uint8_t*	outData,
+	uint8_t		inLength,
+	bool		inPollReady)
+{
+	mDeviceAddress = inDeviceAddress;
+	mHeader = inHeader;
+	mHeaderLength = inHeaderLength;
+	mData = outData;
+	mLength = inLength;
+	mRead = true;
+	mPollReady = inPollReady;
+}
+
+/********************************** I2CQueue **********************************/
+I2CQueue::I2CQueue(void)
+	: mHead(nullptr), mTail(nullptr)
+{
+}
+
+/*********************************** Append ***********************************/
+void I2CQueue::Append(
+	I2CTransaction*	inTransaction)
+{
+	inTransaction->mNext = nullptr;
+	inTransaction->mState = I2CTransaction::eQueued;
+	if (mTail)
+	{
+		mTail->mNext = inTransaction;
+		mTail = inTransaction;
+	} else
+	{
+		mHead = mTail = inTransaction;
+	}
+}
+
+/*********************************** Update ***********************************/
+void I2CQueue::Update(void)
+{
+	I2CTransaction*	transaction = mHead;
+	if (transaction)
+	{
+		if (transaction->mState == I2CTransaction::eQueued)
+		{
+			if (transaction->mPollReady)
+			{
+				transaction->mState = I2CTransaction::ePolling;
+				transaction->mPollStart = micros();
+			} else
+			{
+				transaction->mState = I2CTransaction::eReady;
+			}
+		}
+		/*
+		*	If the device needs to be polled THEN
+		*	poll it once.  If it acknowledges, the transaction is executed on
+		*	the next update so that this update does only one Wire
+		*	transaction.  If it doesn't acknowledge, try again on the next
+		*	update until 10ms have passed since polling started.
+		*/
+		if (transaction->mState == I2CTransaction::ePolling)
+		{
+			Wire.beginTransmission(transaction->mDeviceAddress);
+			if (Wire.endTransmission(true) == 0)
+			{
+				transaction->mState = I2CTransaction::eReady;
+				return;
+			} else if ((micros() - transaction->mPollStart) < 10000)
+			{
+				return;
+			}
+		}
+		transaction->mSucceeded = transaction->mState == I2CTransaction::eReady &&
+									Execute(transaction);
+		transaction->mState = I2CTransaction::eDone;
+		mHead = transaction->mNext;
+		if (!mHead)
+		{
+			mTail = nullptr;
+		}
+		transaction->mNext = nullptr;
+		if (transaction->mCallback)
+		{
+			transaction->mCallback(transaction, transaction->mSucceeded);
+		}
+	}
+}
+
+/********************************** WaitFor ***********************************/
+/*
+*	Returns true if the transaction succeeded.
+*/
+bool I2CQueue::WaitFor(
+	I2CTransaction*	inTransaction)
+{
+	while (inTransaction->IsPending())
+	{
+		Update();
+	}
+	return(inTransaction->mSucceeded);
+}
+
+/********************************** Execute ***********************************/
+bool I2CQueue::Execute(
+	I2CTransaction*	inTransaction)
+{
+	uint8_t	deviceAddress = inTransaction->mDeviceAddress;
+	bool	success = true;
+	if (inTransaction->mHeaderLength ||
+		!inTransaction->mRead)
+	{
+		Wire.beginTransmission(deviceAddress);
+		if (inTransaction->mHeaderLength > 1)
+		{
+			Wire.write((uint8_t)(inTransaction->mHeader >> 8));
+		}
+		if (inTransaction->mHeaderLength)
+		{
+			Wire.write((uint8_t)inTransaction->mHeader);
+		}
+		if (inTransaction->mRead)
+		{
+			// Repeated start before reading
+			success = Wire.endTransmission(false) == 0;
+		} else
+		{
+			if (inTransaction->mLength)
+			{
+				Wire.write(inTransaction->mData, inTransaction->mLength);
+			}
+			success = Wire.endTransmission(true) == 0;
+		}
+	}
+	if (success &&
+		inTransaction->mRead)
+	{
+		uint8_t	length = inTransaction->mLength;
+		success = Wire.requestFrom(deviceAddress, length, (uint8_t)true) == length;
+		if (success)
+		{
+			uint8_t*	data = inTransaction->mData;
+			for (; length; length--)
+			{
+				*(data++) = (uint8_t)Wire.read();
+			}
+		}
+	}
+	return(success);
+}
@@ -0,0 +1,133 @@
+/*
+*	I2CQueue.h, Copyright Jonathan Mackey 2023
+*	Queue of I2C transactions executed from the loop.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef I2CQueue_h
+#define I2CQueue_h
+
+#include <inttypes.h>
+#include <functional>
+
+class I2CTransaction;
+typedef std::function<void(I2CTransaction*, bool)> I2CCallback;
+
+/*
+*	An I2CTransaction is a single Wire transaction: an optional header of 1
+*	or 2 bytes (a register, command or memory address) followed by either
+*	data to write or data to read.  Wire limits the data to 32 bytes,
+*	including the header when writing.  The transaction and its data are
+*	owned by the caller and must not change until the transaction is done.
+*
+*	When poll ready is set the device is polled (one address only
+*	transmission per I2CQueue::Update) until it acknowledges, for up to 10ms
+*	after the transaction reaches the head of the queue.  This replaces busy
+*	waiting for an EEPROM write cycle to complete.
+*/
+class I2CTransaction
+{
+public:
+							I2CTransaction(void)
+							: mNext(nullptr), mState(eDone), mSucceeded(false),
+							  mCallback(nullptr){}
+	void					SetWrite(
+								uint8_t					inDeviceAddress,
+								uint16_t				inHeader,
+								uint8_t					inHeaderLength,
+								const uint8_t*			inData = nullptr,
+								uint8_t					inLength = 0,
+								bool					inPollReady = false);
+	void					SetRead(
+								uint8_t					inDeviceAddress,
+								uint16_t				inHeader,
+								uint8_t					inHeaderLength,
+								uint8_t*				outData,
+								uint8_t					inLength,
+								bool					inPollReady = false);
+	// The header can be changed until the transaction starts (e.g. to
+	// replace a queued value with a newer value.)
+	void					SetHeader(
+								uint16_t				inHeader)
+								{mHeader = inHeader;}
+	void					SetCallback(
+								I2CCallback				inCallback)
+								{mCallback = inCallback;}
+	bool					IsPending(void) const
+								{return(mState != eDone);}
+	bool					Succeeded(void) const
+								{return(mSucceeded);}
+	I2CTransaction*			Next(void) const
+								{return(mNext);}
+	void					SetNext(
+								I2CTransaction*			inNext)
+								{mNext = inNext;}
+protected:
+	friend class I2CQueue;
+	enum EState
+	{
+		eDone,
+		eQueued,
+		ePolling,
+		eReady
+	};
+	I2CTransaction*	mNext;
+	uint8_t*		mData;
+	uint32_t		mPollStart;
+	uint16_t		mHeader;
+	uint8_t			mHeaderLength;
+	uint8_t			mLength;
+	uint8_t			mDeviceAddress;
+	uint8_t			mState;
+	bool			mRead;
+	bool			mPollReady;
+	bool			mSucceeded;
+	I2CCallback		mCallback;
+};
+
+/*
+*	I2CQueue executes the transactions in the order they were appended.
+*	Update does at most one Wire transaction (a short bus operation, about
+*	1ms for 32 bytes at 400KHz) so it can be called every loop without
+*	stalling the loop.  The transaction's callback is called when it's done.
+*
+*	WaitFor is used to build blocking calls on the queue.  It runs the queue
+*	until the transaction is done, so any transactions queued before it are
+*	done first.
+*/
+class I2CQueue
+{
+public:
+							I2CQueue(void);
+	void					Append(
+								I2CTransaction*			inTransaction);
+	void					Update(void);
+	bool					WaitFor(
+								I2CTransaction*			inTransaction);
+	bool					IsEmpty(void) const
+								{return(mHead == nullptr);}
+protected:
+	I2CTransaction*	mHead;
+	I2CTransaction*	mTail;
+	
+	bool					Execute(
+								I2CTransaction*			inTransaction);
+};
+
+#endif // I2CQueue_h
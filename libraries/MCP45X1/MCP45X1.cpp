@@ -23,12 +23,12 @@
 
 #include "Arduino.h"
 #include "MCP45X1.h"
-#include <Wire.h>
 
 /*********************************** MCP45X1 ************************************/
 MCP45X1::MCP45X1(
-	uint8_t	inDeviceAddress)
-	: mDeviceAddress(inDeviceAddress)
+	I2CQueue*	inQueue,
+	uint8_t		inDeviceAddress)
+	: mQueue(inQueue), mDeviceAddress(inDeviceAddress), mWriteAddress(0)
 {
 }
 
@@ -36,15 +36,15 @@ MCP45X1::MCP45X1(
 uint16_t MCP45X1::Read(
 	uint8_t	inAddress)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(inAddress | eReadData);
-	Wire.endTransmission(false);
-	
-	uint16_t	bytesRead = Wire.requestFrom(mDeviceAddress, 2);
-	if (bytesRead == 2)
+	mQueue->WaitFor(&mTransaction);
+	uint8_t	data[2];
+	I2CTransaction	transaction;
+	transaction.SetRead(mDeviceAddress, inAddress | eReadData, 1, data, 2);
+	mQueue->Append(&transaction);
+	if (mQueue->WaitFor(&transaction))
 	{
-		uint16_t	msb = (Wire.read() & 1) << 8;
-		return(msb | Wire.read());
+		uint16_t	msb = (data[0] & 1) << 8;
+		return(msb | data[1]);
 	}
 	return(0xFFFF);	// Invalid for both eWiper0 and eTCONReg
 }
@@ -54,40 +54,61 @@ bool MCP45X1::Write(
 	uint16_t	inValue,
 	uint8_t		inAddress)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(inAddress | ((inValue >> 8) & 1));
-	Wire.write((uint8_t)inValue);
-	return(Wire.endTransmission(true) == 0);
+	/*
+	*	The command byte followed by the low 8 bits of the value are sent as
+	*	the transaction's 2 byte header.
+	*/
+	uint16_t	header = ((inAddress | ((inValue >> 8) & 1)) << 8) | (uint8_t)inValue;
+	/*
+	*	If a write to the same address is still queued THEN
+	*	replace its value.
+	*/
+	if (mTransaction.IsPending())
+	{
+		if (inAddress == mWriteAddress)
+		{
+			mTransaction.SetHeader(header);
+			return(true);
+		}
+		mQueue->WaitFor(&mTransaction);
+	}
+	mWriteAddress = inAddress;
+	mTransaction.SetWrite(mDeviceAddress, header, 2);
+	mQueue->Append(&mTransaction);
+	return(true);
+}
+
+/********************************* SendCommand ********************************/
+bool MCP45X1::SendCommand(
+	uint8_t	inCommand)
+{
+	mQueue->WaitFor(&mTransaction);
+	I2CTransaction	transaction;
+	transaction.SetWrite(mDeviceAddress, inCommand, 1);
+	mQueue->Append(&transaction);
+	return(mQueue->WaitFor(&transaction));
 }
 
 /********************************** Increment *********************************/
 bool MCP45X1::Increment(void)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(eIncrement0);
-	return(Wire.endTransmission(true) == 0);
+	return(SendCommand(eIncrement0));
 }
 
 /********************************** Decrement *********************************/
 bool MCP45X1::Decrement(void)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(eDecrement0);
-	return(Wire.endTransmission(true) == 0);
+	return(SendCommand(eDecrement0));
 }
 
 /********************************* Increment1 *********************************/
 bool MCP45X1::Increment1(void)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(eIncrement1);
-	return(Wire.endTransmission(true) == 0);
+	return(SendCommand(eIncrement1));
 }
 
 /********************************* Decrement1 *********************************/
 bool MCP45X1::Decrement1(void)
 {
-	Wire.beginTransmission(mDeviceAddress);
-	Wire.write(eDecrement1);
-	return(Wire.endTransmission(true) == 0);
+	return(SendCommand(eDecrement1));
 }
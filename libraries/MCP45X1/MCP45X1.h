@@ -24,12 +24,22 @@
 #ifndef MCP45X1_H
 #define MCP45X1_H
 
+#include "I2CQueue.h"
+
 // This class has only been tested with the MCP4531-103E device.
 
+/*
+*	Write is queued on the I2CQueue and returns immediately.  If the previous
+*	write hasn't been sent yet, it's replaced by the new value rather than
+*	queuing another write (e.g. while a stepper value is held down.)  Read,
+*	Increment and Decrement wait for any queued write, then wait for their
+*	own transaction to complete.
+*/
 class MCP45X1
 {
 public:
 							MCP45X1(
+								I2CQueue*				inQueue,
 								uint8_t					inDeviceAddress);
 	enum EMemAddress
 	{
@@ -53,9 +63,12 @@ public:
 	};
 	uint16_t				Read(
 								uint8_t					inAddress = eWiper0);	// Read Wiper 0
+	// Returns true if the write was queued.
 	bool					Write(
 								uint16_t				inValue,
 								uint8_t					inAddress = eWiper0);
+	bool					WritePending(void) const
+								{return(mTransaction.IsPending());}
 								
 	bool					Increment(void);	// Increment Wiper 0
 	bool					Decrement(void);	// Decrement Wiper 0
@@ -63,7 +76,10 @@ public:
 	bool					Decrement1(void);	// Wiper 1, N/A this device
 
 protected:
+	I2CQueue*	mQueue;
 	uint8_t		mDeviceAddress;	// 0x50 + N low address bit(s).
+	uint8_t		mWriteAddress;	// Address of the queued write
+	I2CTransaction	mTransaction;	// Queued write
 
 	enum ECommands
 	{
@@ -74,6 +90,8 @@ protected:
 		eDecrement1	= 0b11000,
 		eReadData	= 0b1100
 	};
+	bool					SendCommand(
+								uint8_t					inCommand);
 
 };
 
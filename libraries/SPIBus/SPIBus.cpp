@@ -0,0 +1,70 @@
+/*
+*	SPIBus.cpp, Copyright Jonathan Mackey 2023
+*	SPI transactions that exclude an ISR that also uses the bus.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "SPIBus.h"
+
+#ifdef _STM32_DEF_
+IRQn_Type	SPIBus::sIRQn;
+bool		SPIBus::sHasIRQ;
+uint8_t		SPIBus::sDepth;
+
+/******************************** SetSharedIRQ ********************************/
+void SPIBus::SetSharedIRQ(
+	IRQn_Type	inIRQn)
+{
+	sIRQn = inIRQn;
+	sHasIRQ = true;
+}
+#endif
+
+/****************************** BeginTransaction ******************************/
+void SPIBus::BeginTransaction(
+	const SPISettings&	inSettings)
+{
+#ifdef _STM32_DEF_
+	if (sHasIRQ)
+	{
+		NVIC_DisableIRQ(sIRQn);
+		/*
+		*	Make sure the mask has taken effect before touching the bus.
+		*/
+		__DSB();
+		__ISB();
+		sDepth++;
+	}
+#endif
+	SPI.beginTransaction(inSettings);
+}
+
+/******************************* EndTransaction *******************************/
+void SPIBus::EndTransaction(void)
+{
+	SPI.endTransaction();
+#ifdef _STM32_DEF_
+	if (sHasIRQ &&
+		sDepth &&
+		--sDepth == 0)
+	{
+		NVIC_EnableIRQ(sIRQn);
+	}
+#endif
+}
@@ -0,0 +1,61 @@
+/*
+*	SPIBus.h, Copyright Jonathan Mackey 2023
+*	SPI transactions that exclude an ISR that also uses the bus.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef SPIBus_h
+#define SPIBus_h
+
+#include <SPI.h>
+
+/*
+*	When an ISR uses the SPI bus (e.g. the XPT2046 sampling timer), every
+*	other transaction on the bus must go through SPIBus.  BeginTransaction
+*	masks the ISR's IRQ before SPI.beginTransaction and EndTransaction
+*	unmasks it after SPI.endTransaction, so the ISR can never start while
+*	another device owns the bus, whatever state its chip select is in.  An
+*	IRQ raised while masked stays pending and runs as soon as the bus is
+*	released, so the ISR is delayed, never lost.
+*
+*	Transactions may nest.  The IRQ is unmasked when the outermost
+*	transaction ends.  The ISR itself may also use BeginTransaction, it
+*	only runs when no other transaction is open.
+*
+*	Without a registered IRQ (or on platforms other than STM32) these are
+*	plain SPI.beginTransaction/endTransaction.
+*/
+class SPIBus
+{
+public:
+#ifdef _STM32_DEF_
+	static void				SetSharedIRQ(
+								IRQn_Type				inIRQn);
+#endif
+	static void				BeginTransaction(
+								const SPISettings&		inSettings);
+	static void				EndTransaction(void);
+protected:
+#ifdef _STM32_DEF_
+	static IRQn_Type		sIRQn;
+	static bool				sHasIRQ;
+	static uint8_t			sDepth;
+#endif
+};
+#endif // SPIBus_h
@@ -0,0 +1,332 @@
+/*
+*	SdFatDataStream.cpp, Copyright Jonathan Mackey 2023
+*	Read-only DataStream class for accessing a file on an SD card.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "SdFatDataStream.h"
+#include <string.h>
+
+/****************************** SdFatDataStream *******************************/
+SdFatDataStream::SdFatDataStream(
+	uint8_t*	inBuffer,
+	uint16_t	inBufferSize,
+	uint8_t		inLines)
+	: DataStreamImpl(nullptr, 0),
+#ifdef __MACH__
+	  mFile(nullptr),
+#endif
+	  mBuffer(inBuffer), mClock(0), mFilePos(0), mHits(0), mMisses(0)
+{
+	if (inLines == 0)
+	{
+		inLines = 1;
+	} else if (inLines > kMaxLines)
+	{
+		inLines = kMaxLines;
+	}
+	mLines = inLines;
+	mLineSize = inBufferSize/inLines;
+	/*
+	*	If the lines can hold at least one sector THEN
+	*	make them whole sectors so that every read is sector aligned.
+	*/
+	if (mLineSize >= kSectorSize)
+	{
+		mLineSize &= ~(kSectorSize-1);
+	}
+	memset(mLine, 0, sizeof(mLine));
+}
+
+/****************************** ~SdFatDataStream ******************************/
+SdFatDataStream::~SdFatDataStream(void)
+{
+	Close();
+}
+
+/************************************ Open ************************************/
+bool SdFatDataStream::Open(
+	const char*	inPath)
+{
+	Close();
+	uint32_t	fileSize = 0;
+#ifdef __MACH__
+	mFile = fopen(inPath, "rb");
+	bool	success = mFile != nullptr;
+	if (success)
+	{
+		fseek(mFile, 0, SEEK_END);
+		fileSize = (uint32_t)ftell(mFile);
+		fseek(mFile, 0, SEEK_SET);
+	}
+#else
+	bool	success = mFile.open(inPath, O_RDONLY);
+	if (success)
+	{
+		fileSize = (uint32_t)mFile.fileSize();
+	}
+#endif
+	mCurrent = mStartAddr;
+	mEndAddr = mStartAddr + fileSize;
+	mFilePos = 0;
+	return(success);
+}
+
+/*********************************** Close ************************************/
+void SdFatDataStream::Close(void)
+{
+#ifdef __MACH__
+	if (mFile)
+	{
+		fclose(mFile);
+		mFile = nullptr;
+	}
+#else
+	if (mFile.isOpen())
+	{
+		mFile.close();
+	}
+#endif
+	for (uint8_t i = 0; i < mLines; i++)
+	{
+		mLine[i].bytes = 0;
+	}
+	mCurrent = mEndAddr = mStartAddr;
+}
+
+/*********************************** IsOpen ***********************************/
+bool SdFatDataStream::IsOpen(void) const
+{
+#ifdef __MACH__
+	return(mFile != nullptr);
+#else
+	return(mFile.isOpen());
+#endif
+}
+
+/********************************** ReadFile **********************************/
+/*
+*	Reads directly from the file.  The file is only repositioned when inPos
+*	isn't the current position of the file.
+*/
+uint32_t SdFatDataStream::ReadFile(
+	uint32_t	inPos,
+	uint32_t	inLength,
+	void*		outBuffer)
+{
+	uint32_t	bytesRead = 0;
+	bool	success = inPos == mFilePos;
+	if (!success)
+	{
+	#ifdef __MACH__
+		success = fseek(mFile, inPos, SEEK_SET) == 0;
+	#else
+		success = mFile.seekSet(inPos);
+	#endif
+	}
+	if (success)
+	{
+	#ifdef __MACH__
+		bytesRead = (uint32_t)fread(outBuffer, 1, inLength, mFile);
+	#else
+		int	result = mFile.read(outBuffer, inLength);
+		bytesRead = result > 0 ? (uint32_t)result : 0;
+	#endif
+		mFilePos = inPos + bytesRead;
+		mMisses++;
+	} else
+	{
+		mFilePos = 0xFFFFFFFF;	// Unknown, force a seek
+	}
+	return(bytesRead);
+}
+
+/********************************** FindLine **********************************/
+/*
+*	Returns the line containing the byte at inPos or nullptr if it isn't
+*	buffered.
+*/
+SdFatDataStream::SLine* SdFatDataStream::FindLine(
+	uint32_t	inPos)
+{
+	SLine*	line = mLine;
+	for (uint8_t i = 0; i < mLines; i++, line++)
+	{
+		if (line->bytes &&
+			inPos >= line->start &&
+			(inPos - line->start) < line->bytes)
+		{
+			line->lastUsed = ++mClock;
+			return(line);
+		}
+	}
+	return(nullptr);
+}
+
+/********************************** LoadLine **********************************/
+/*
+*	Replaces the least recently used line with the line containing inPos.
+*	Returns nullptr if the line couldn't be read.
+*/
+SdFatDataStream::SLine* SdFatDataStream::LoadLine(
+	uint32_t	inPos)
+{
+	SLine*	lruLine = mLine;
+	SLine*	line = mLine;
+	for (uint8_t i = 0; i < mLines; i++, line++)
+	{
+		if (!line->bytes)
+		{
+			lruLine = line;
+			break;
+		}
+		if ((uint16_t)(mClock - line->lastUsed) > (uint16_t)(mClock - lruLine->lastUsed))
+		{
+			lruLine = line;
+		}
+	}
+	lruLine->start = inPos - (inPos % mLineSize);
+	lruLine->bytes = ReadFile(lruLine->start, mLineSize,
+						&mBuffer[(lruLine - mLine) * mLineSize]);
+	lruLine->lastUsed = ++mClock;
+	return((inPos - lruLine->start) < lruLine->bytes ? lruLine : nullptr);
+}
+
+/************************************ Read ************************************/
+uint32_t SdFatDataStream::Read(
+	uint32_t	inLength,
+	void*		outBuffer)
+{
+	uint32_t	bytesRead = 0;
+	if (IsOpen())
+	{
+		uint32_t	length = Clip(inLength);
+		uint32_t	pos = GetPos();
+		uint8_t*	bufferPtr = (uint8_t*)outBuffer;
+		while (bytesRead < length)
+		{
+			uint32_t	bytesToCopy = length - bytesRead;
+			SLine*	line = FindLine(pos);
+			if (line)
+			{
+				mHits++;
+			/*
+			*	Else if the rest of the read starts on a line boundary and
+			*	is at least one line THEN
+			*	read the whole lines directly into the caller's buffer.
+			*/
+			} else if ((pos % mLineSize) == 0 &&
+				bytesToCopy >= mLineSize)
+			{
+				bytesToCopy -= (bytesToCopy % mLineSize);
+				uint32_t	bytesReadFromFile = ReadFile(pos, bytesToCopy, bufferPtr);
+				bytesRead += bytesReadFromFile;
+				pos += bytesReadFromFile;
+				bufferPtr += bytesReadFromFile;
+				if (bytesReadFromFile == bytesToCopy)
+				{
+					continue;
+				}
+				break;
+			} else
+			{
+				line = LoadLine(pos);
+				if (!line)
+				{
+					break;
+				}
+			}
+			uint32_t	offset = pos - line->start;
+			if (bytesToCopy > (line->bytes - offset))
+			{
+				bytesToCopy = line->bytes - offset;
+			}
+			memcpy(bufferPtr, &mBuffer[(line - mLine) * mLineSize + offset], bytesToCopy);
+			bytesRead += bytesToCopy;
+			pos += bytesToCopy;
+			bufferPtr += bytesToCopy;
+		}
+		mCurrent += bytesRead;
+	}
+	return(bytesRead);
+}
+
+/************************************ Peek ************************************/
+const void* SdFatDataStream::Peek(
+	uint32_t&	ioLength)
+{
+	const uint8_t*	data = nullptr;
+	uint32_t	length = IsOpen() ? Clip(ioLength) : 0;
+	if (length)
+	{
+		uint32_t	pos = GetPos();
+		SLine*	line = FindLine(pos);
+		if (line)
+		{
+			mHits++;
+		} else
+		{
+			line = LoadLine(pos);
+		}
+		if (line)
+		{
+			uint32_t	offset = pos - line->start;
+			if (length > (line->bytes - offset))
+			{
+				length = line->bytes - offset;
+			}
+			data = &mBuffer[(line - mLine) * mLineSize + offset];
+		}
+	}
+	ioLength = data ? length : 0;
+	return(data);
+}
+
+/********************************** Acquire ***********************************/
+const void* SdFatDataStream::Acquire(
+	uint32_t&	ioLength)
+{
+	const void*	data = SdFatDataStream::Peek(ioLength);
+	mCurrent += ioLength;
+	return(data);
+}
+
+/************************************ Peek ************************************/
+/*
+*	A pixel split across lines (only possible when the lines aren't whole
+*	sectors) isn't included.  If it's the first pixel, nullptr is returned
+*	and the caller falls back to Read.
+*/
+const void* SdFatPixelStream::Peek(
+	uint32_t&	ioLength)
+{
+	ioLength *= 2;
+	const void*	data = SdFatDataStream::Peek(ioLength);
+	ioLength /= 2;
+	return(ioLength ? data : nullptr);
+}
+
+/********************************** Acquire ***********************************/
+const void* SdFatPixelStream::Acquire(
+	uint32_t&	ioLength)
+{
+	const void*	data = SdFatPixelStream::Peek(ioLength);
+	mCurrent += ioLength * 2;
+	return(data);
+}
@@ -0,0 +1,164 @@
+/*
+*	SdFatDataStream.h, Copyright Jonathan Mackey 2023
+*	Read-only DataStream class for accessing a file on an SD card.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef SdFatDataStream_h
+#define SdFatDataStream_h
+
+#include "DataStream.h"
+#ifdef __MACH__
+#include <stdio.h>
+#else
+#include "SdFat.h"
+#endif
+
+/*
+*	SdFatDataStream allows large fonts (XFont::Font::glyphData) and full
+*	screen images (DisplayController::StreamCopyBlock) to be kept on the SD
+*	card rather than in flash.
+*
+*	The file is read in lines of whole sectors.  Reading a line is a single
+*	multi-block read, so small reads such as a glyph header or a 96 pixel
+*	StreamCopy chunk are served from RAM.  The application supplied buffer
+*	is divided into 1 to 4 lines.  The least recently used line is replaced
+*	on a miss.  This also acts as a seek cache: seeking is free, and seeking
+*	back to data in one of the lines doesn't touch the card.  The file is
+*	only repositioned (seekSet) when a line isn't the next part of the file.
+*	Reads of one or more whole lines that aren't already buffered go
+*	directly to the caller's buffer.
+*
+*	The buffer should be a multiple of 512 bytes per line.  For fonts, 2
+*	lines of 2KB work well.  Glyph headers and glyph data are usually in the
+*	same line.
+*
+*	SdFat.begin must be successfully called before calling Open.
+*
+*	Usage:
+*		uint8_t			sdBuffer[4096];
+*		SdFatDataStream	sdStream(sdBuffer, sizeof(sdBuffer), 2);
+*		sdStream.Open("Avenir_64.bin");	// glyphData of Avenir_64_4b.h
+*		XFont4BitDataStream	xFontDataStream(&xFont, &sdStream);
+*		XFont::Font	font(&Avenir_64_4b::fontHeader, Avenir_64_4b::charcodeRun,
+*						Avenir_64_4b::glyphDataOffset, &xFontDataStream);
+*/
+class SdFatDataStream : public DataStreamImpl
+{
+public:
+							SdFatDataStream(
+								uint8_t*				inBuffer,
+								uint16_t				inBufferSize,
+								uint8_t					inLines = 2);
+							~SdFatDataStream(void);
+	/*
+	*	Open: Opens the file for reading and seeks to the start.  Any
+	*	previously opened file is closed.  Returns true if successful.
+	*/
+	bool					Open(
+								const char*				inPath);
+	void					Close(void);
+	bool					IsOpen(void) const;
+	virtual uint32_t		Read(
+								uint32_t				inLength,
+								void*					outBuffer);
+	virtual uint32_t		Write(
+								uint32_t				inLength,
+								const void*				inBuffer)
+								{return(0);}
+	/*
+	*	Peek and Acquire return a pointer into the line containing the
+	*	current position, loading the line if needed.  The length returned
+	*	never extends past the end of the line.
+	*/
+	virtual const void*		Peek(
+								uint32_t&				ioLength);
+	virtual const void*		Acquire(
+								uint32_t&				ioLength);
+	// Hits are reads served from a line, misses are reads from the file.
+	uint32_t				Hits(void) const
+								{return(mHits);}
+	uint32_t				Misses(void) const
+								{return(mMisses);}
+	void					ResetStats(void)
+								{mHits = 0; mMisses = 0;}
+protected:
+	struct SLine
+	{
+		uint32_t	start;		// File position of the first byte
+		uint16_t	bytes;		// 0 if the line isn't used
+		uint16_t	lastUsed;
+	};
+	static const uint8_t	kMaxLines = 4;
+	static const uint16_t	kSectorSize = 512;
+#ifdef __MACH__
+	FILE*		mFile;
+#else
+	SdFile		mFile;
+#endif
+	uint8_t*	mBuffer;
+	uint16_t	mLineSize;
+	uint8_t		mLines;
+	SLine		mLine[kMaxLines];
+	uint16_t	mClock;			// Incremented each time a line is used
+	uint32_t	mFilePos;		// Current position of mFile
+	uint32_t	mHits;
+	uint32_t	mMisses;
+
+	SLine*					FindLine(
+								uint32_t				inPos);
+	SLine*					LoadLine(
+								uint32_t				inPos);
+	uint32_t				ReadFile(
+								uint32_t				inPos,
+								uint32_t				inLength,
+								void*					outBuffer);
+};
+
+/*
+*	SdFatPixelStream is the 16 bit data stream of a file of 565 pixels, such
+*	as a full screen background image, for DisplayController::StreamCopyBlock.
+*	Read lengths are in pixels.  Seek offsets are in bytes.
+*
+*	Peek and Acquire lengths are also in pixels, so StreamCopy can send the
+*	pixels to the display directly from the line.
+*
+*	Usage:
+*		display.MoveTo(0, 0);
+*		display.StreamCopyBlock(&pixelStream, 320, 480);
+*/
+class SdFatPixelStream : public SdFatDataStream
+{
+public:
+							SdFatPixelStream(
+								uint8_t*				inBuffer,
+								uint16_t				inBufferSize,
+								uint8_t					inLines = 2)
+								: SdFatDataStream(inBuffer, inBufferSize, inLines){}
+	virtual uint32_t		Read(
+								uint32_t				inLength,
+								void*					outBuffer)
+								{return(SdFatDataStream::Read(inLength * 2, outBuffer)/2);}
+	virtual const void*		Peek(
+								uint32_t&				ioLength);
+	virtual const void*		Acquire(
+								uint32_t&				ioLength);
+};
+
+#endif // SdFatDataStream_h
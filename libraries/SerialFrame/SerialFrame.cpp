@@ -0,0 +1,164 @@
+/*
+*	SerialFrame.cpp, Copyright Jonathan Mackey 2023
+*	Framing of binary messages sent over a serial line.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "SerialFrame.h"
+
+/*
+*	CRC-16/CCITT (polynomial 0x1021) computed a nibble at a time.  The 16
+*	entry table is a compromise between flash and speed.
+*/
+static const uint16_t kCRCNibbleTable[] =
+{
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/******************************** SerialFrame *********************************/
+SerialFrame::SerialFrame(void)
+	: mBodyLength(0), mInFrame(false), mEscaped(false), mOverflow(false),
+	  mDroppedFrames(0)
+{
+}
+
+/********************************** Receive ***********************************/
+SerialFrame::EReceiveState SerialFrame::Receive(
+	uint8_t	inByte)
+{
+	EReceiveState	state = eInFrame;
+	if (inByte == kFlag)
+	{
+		/*
+		*	If this is the closing flag THEN
+		*	validate the frame.
+		*/
+		if (mInFrame && mBodyLength)
+		{
+			if (!mOverflow &&
+				!mEscaped &&
+				mBodyLength >= 4 &&
+				CRC16(mBody, mBodyLength-2) == FrameCRC())
+			{
+				state = eFrameReceived;
+			} else
+			{
+				mDroppedFrames++;
+			}
+			mInFrame = false;
+		/*
+		*	Else it's an opening flag.  Back to back flags are treated as a
+		*	single opening flag.
+		*/
+		} else
+		{
+			mInFrame = true;
+			mBodyLength = 0;
+			mEscaped = false;
+			mOverflow = false;
+		}
+	} else if (mInFrame)
+	{
+		if (inByte == kEscape)
+		{
+			mEscaped = true;
+		} else
+		{
+			if (mEscaped)
+			{
+				inByte ^= kEscapeXOR;
+				mEscaped = false;
+			}
+			if (mBodyLength < kMaxBodySize)
+			{
+				mBody[mBodyLength++] = inByte;
+			} else
+			{
+				mOverflow = true;
+			}
+		}
+	} else
+	{
+		state = eIgnored;
+	}
+	return(state);
+}
+
+/*********************************** Encode ***********************************/
+uint16_t SerialFrame::Encode(
+	uint8_t		inSeq,
+	uint8_t		inType,
+	const void*	inPayload,
+	uint8_t		inLength,
+	uint8_t*	outBuffer)
+{
+	uint8_t	header[2] = {inSeq, inType};
+	if (inLength > kMaxPayload)
+	{
+		inLength = kMaxPayload;
+	}
+	uint16_t	crc = CRC16(header, 2);
+	crc = CRC16((const uint8_t*)inPayload, inLength, crc);
+	uint16_t	length = 0;
+	outBuffer[length++] = kFlag;
+	length += Stuff(inSeq, &outBuffer[length]);
+	length += Stuff(inType, &outBuffer[length]);
+	for (uint8_t i = 0; i < inLength; i++)
+	{
+		length += Stuff(((const uint8_t*)inPayload)[i], &outBuffer[length]);
+	}
+	length += Stuff(crc & 0xFF, &outBuffer[length]);
+	length += Stuff(crc >> 8, &outBuffer[length]);
+	outBuffer[length++] = kFlag;
+	return(length);
+}
+
+/*********************************** Stuff ************************************/
+uint16_t SerialFrame::Stuff(
+	uint8_t		inByte,
+	uint8_t*	outBuffer)
+{
+	uint16_t	length = 1;
+	if (inByte == kFlag ||
+		inByte == kEscape ||
+		inByte == kCommandChar)
+	{
+		*(outBuffer++) = kEscape;
+		inByte ^= kEscapeXOR;
+		length = 2;
+	}
+	*outBuffer = inByte;
+	return(length);
+}
+
+/*********************************** CRC16 ************************************/
+uint16_t SerialFrame::CRC16(
+	const uint8_t*	inData,
+	uint16_t		inLength,
+	uint16_t		inCRC)
+{
+	for (uint16_t i = 0; i < inLength; i++)
+	{
+		uint8_t	thisByte = inData[i];
+		inCRC = (inCRC << 4) ^ kCRCNibbleTable[(inCRC >> 12) ^ (thisByte >> 4)];
+		inCRC = (inCRC << 4) ^ kCRCNibbleTable[(inCRC >> 12) ^ (thisByte & 0x0F)];
+	}
+	return(inCRC);
+}
@@ -0,0 +1,114 @@
+/*
+*	SerialFrame.h, Copyright Jonathan Mackey 2023
+*	Framing of binary messages sent over a serial line.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef SerialFrame_h
+#define SerialFrame_h
+
+#include <inttypes.h>
+
+/*
+*	A frame is a sequence number, a message type, 0 to kMaxPayload bytes of
+*	payload, and a CRC-16/CCITT of the preceding bytes (low byte first.)
+*	The frame is delimited by kFlag bytes.  Any kFlag, kEscape or kCommandChar
+*	byte within the frame is sent as kEscape followed by the byte XOR
+*	kEscapeXOR (HDLC style byte stuffing.)
+*
+*	Received bytes are passed to Receive one at a time, so no more than one
+*	frame is ever buffered.  Bytes that aren't within a frame are returned as
+*	ignored so that the caller can also accept single character commands on
+*	the same line.  kCommandChar is escaped so that the body of a frame whose
+*	opening flag was lost is never mistaken for a command.  A frame that is
+*	too long or has a bad CRC is dropped.
+*
+*	Usage:
+*		SerialFrame	frame;
+*		...
+*		if (frame.Receive(Serial.read()) == SerialFrame::eFrameReceived)
+*		{
+*			// frame.Seq(), frame.Type(), frame.Payload(), frame.PayloadLength()
+*		}
+*		...
+*		uint8_t	buffer[SerialFrame::kMaxFrameSize];
+*		Serial.write(buffer, SerialFrame::Encode(seq, type, &msg, sizeof(msg), buffer));
+*/
+class SerialFrame
+{
+public:
+	static const uint8_t	kFlag = 0x7E;
+	static const uint8_t	kEscape = 0x7D;
+	static const uint8_t	kEscapeXOR = 0x20;
+	static const uint8_t	kCommandChar = '>';
+	static const uint8_t	kMaxPayload = 48;
+	static const uint8_t	kMaxBodySize = 2 + kMaxPayload + 2;	// Unstuffed
+	static const uint16_t	kMaxFrameSize = 2 + (kMaxBodySize * 2);	// Stuffed
+							SerialFrame(void);
+	enum EReceiveState
+	{
+		eIgnored,			// Not part of a frame
+		eInFrame,
+		eFrameReceived		// The frame is valid
+	};
+	EReceiveState			Receive(
+								uint8_t					inByte);
+	// The accessors below are valid after Receive returns eFrameReceived.
+	uint8_t					Seq(void) const
+								{return(mBody[0]);}
+	uint8_t					Type(void) const
+								{return(mBody[1]);}
+	const uint8_t*			Payload(void) const
+								{return(&mBody[2]);}
+	uint8_t					PayloadLength(void) const
+								{return(mBodyLength - 4);}
+	uint16_t				FrameCRC(void) const
+								{return(mBody[mBodyLength-2] | (mBody[mBodyLength-1] << 8));}
+	// Frames dropped because of a bad CRC or length.
+	uint16_t				DroppedFrames(void) const
+								{return(mDroppedFrames);}
+	/*
+	*	Encode: Writes the stuffed frame, including both flags, to outBuffer.
+	*	outBuffer must be at least kMaxFrameSize bytes.  Returns the length
+	*	of the frame.
+	*/
+	static uint16_t			Encode(
+								uint8_t					inSeq,
+								uint8_t					inType,
+								const void*				inPayload,
+								uint8_t					inLength,
+								uint8_t*				outBuffer);
+	static uint16_t			CRC16(
+								const uint8_t*			inData,
+								uint16_t				inLength,
+								uint16_t				inCRC = 0xFFFF);
+protected:
+	uint8_t		mBody[kMaxBodySize];
+	uint8_t		mBodyLength;
+	bool		mInFrame;
+	bool		mEscaped;
+	bool		mOverflow;
+	uint16_t	mDroppedFrames;
+
+	static uint16_t			Stuff(
+								uint8_t					inByte,
+								uint8_t*				outBuffer);
+};
+
+#endif // SerialFrame_h
@@ -28,7 +28,12 @@
 #include "DS3231SN.h"
 #else
 #include <iostream>
+#ifdef __APPLE__
 #include <CoreFoundation/CFTimeZone.h>
+#else
+#include <time.h>	// Linux host build
+#include <string.h>
+#endif
 #define PROGMEM
 #define pgm_read_word(xx) *(xx)
 #define pgm_read_byte(xx) *(xx)
@@ -139,9 +144,16 @@ void UnixTime::SetTime(
 /*************************** SetTimeFromExternalRTC ***************************/
 void UnixTime::SetTimeFromExternalRTC(void)
 {
+#ifdef __APPLE__
 	CFTimeZoneRef tz = CFTimeZoneCopySystem();
 	time32_t localTime = (time32_t)(time(nullptr) + CFTimeZoneGetSecondsFromGMT(tz, 0));
 	CFRelease(tz);
+#else
+	time_t	now = time(nullptr);
+	struct tm	localTm;
+	localtime_r(&now, &localTm);
+	time32_t localTime = (time32_t)(now + localTm.tm_gmtoff);
+#endif
 	sTime = localTime;
 }
 #else
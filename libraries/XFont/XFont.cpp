@@ -21,6 +21,8 @@
 *
 */
 #include "XFont.h"
+#include "XGlyphCache.h"
+#include "XGlyphIndex.h"
 #ifdef __MACH__
 #include "pgmspace_stub.h"
 #else
@@ -30,6 +32,7 @@
 #include <string.h>
 #include "DataStream.h"
 #include "DisplayController.h"
+#include "TintTable.h"
 /*
 *	The font header, charcode runs array, and glyph data offsets array are
 *	assumed to be in near PROGMEM.  The Glyph data is accessed via a DataStream.
@@ -43,7 +46,8 @@ const uint16_t	XFont::kEllipsisCharcode = 0x2026;
 
 /*********************************** XFont ************************************/
 XFont::XFont(void)
-	: mDisplay(nullptr), mFontRows(0),
+	: mDisplay(nullptr), mGlyphCache(nullptr), mLineBuffer(nullptr),
+	  mLineBufferPixels(0), mFontRows(0),
 	  mHighlightEnabled(false), mFont(nullptr),
 	  mTextColor(0xFFFF), mTextBGColor(0), mStartCol(0)
 {
@@ -79,6 +83,11 @@ void XFont::SetFont(
 					mFontRows = (mFontHeader.height + 7)/8;
 				}
 			}
+			if (mFont->glyphIndex &&
+				!mFont->glyphIndex->IsBuilt())
+			{
+				mFont->glyphIndex->Build(*this);
+			}
 			mEllipsisWidth = LoadGlyph(kEllipsisCharcode) ? mGlyph.advanceX : 0;
 		}
 	}
@@ -88,10 +97,16 @@ void XFont::SetFont(
 /*
 *	Returns entryIndex within the glyphDataOffsets for inCharcode.
 *	0xFFFF is returned if the glyph doesn't exist.
+*	Indexed charcodes are looked up rather than searched for, see XGlyphIndex.
 */
 uint16_t XFont::FindGlyph(
 	uint16_t	inCharcode)
 {
+	XGlyphIndex*	glyphIndex = GlyphIndex(inCharcode);
+	if (glyphIndex)
+	{
+		return(glyphIndex->EntryIndex(inCharcode));
+	}
 	uint16_t leftIndex = 0;
 	const CharcodeRun*	charcodeRuns = mFont->charcodeRuns;
 	const CharcodeRun*	charcodeRun = NULL;
@@ -155,9 +170,15 @@ bool XFont::LoadGlyphHeader(
 	uint16_t	inEntryIndex)
 {
 	bool	success = false;
+	mCharcode = 0;	// mGlyph is about to change, see LoadGlyph
 	if (inEntryIndex < mFontHeader.numCharCodes)
 	{
-		DataStream*	glyphData = mFont->glyphData;
+		/*
+		*	The header is read directly from the source stream.  The glyph
+		*	data stream is only used to unpack the glyph data.  See
+		*	SeekGlyphData.
+		*/
+		DataStream*	glyphData = mFont->glyphData->GetSourceStream();
 		// At this point we have the entry index of the glyph within the GlyphDataOffsets
 		// Load the glyph header
 		success = glyphData->Seek(pgm_read_word_near(&mFont->glyphDataOffsets[inEntryIndex]), DataStream::eSeekSet);
@@ -181,33 +202,69 @@ bool XFont::LoadGlyphHeader(
 
 /********************************* LoadGlyph **********************************/
 /*
-*	Seeks the DataStream mGlyphData to point to the glyph data for inCharcode.
+*	Loads the glyph header of inCharcode into mGlyph.
 *	Returns true if the glyph was loaded.
-*	mGlyph is initialized from the stream.
+*	If inCharcode is already loaded, nothing is read.
 */
 bool XFont::LoadGlyph(
 	uint16_t	inCharcode)
 {
-	bool	success = true;
-	uint16_t	entryIndex = mCharcode != inCharcode ? FindGlyph(inCharcode) : mCharcodeIndex;
-	/*
-	*	Note that LoadGlyphHeader needs to be called before each DrawCharcode
-	*	call because of a kluge in XFontDataStream::Read that uses the first
-	*	read as a flag to initialize state variables.  If this wasn't the case
-	*	then the loading could be skipped as an optimization. 
-	*/
-	if (entryIndex != 0xFFFF &&
-		LoadGlyphHeader(entryIndex))
-	{
-		mCharcode = inCharcode;
-		mCharcodeIndex = entryIndex;
-	} else
+	bool	success = inCharcode && mCharcode == inCharcode;
+	if (!success)
 	{
-		success = false;
+		XGlyphIndex*	glyphIndex = GlyphIndex(inCharcode);
+		uint16_t	entryIndex = glyphIndex ?
+						glyphIndex->EntryIndex(inCharcode) : FindGlyph(inCharcode);
+		if (entryIndex != 0xFFFF)
+		{
+			/*
+			*	If the glyph is indexed THEN
+			*	the glyph header was loaded when the index was built.
+			*/
+			if (glyphIndex)
+			{
+				mGlyph = glyphIndex->Glyph(inCharcode);
+				success = true;
+			} else
+			{
+				success = LoadGlyphHeader(entryIndex);
+			}
+			if (success)
+			{
+				mCharcode = inCharcode;
+				mCharcodeIndex = entryIndex;
+			}
+		}
 	}
 	return(success);
 }
 
+/********************************* GlyphIndex *********************************/
+/*
+*	Returns the glyph index of the current font if inCharcode is within the
+*	index, otherwise nullptr.
+*/
+XGlyphIndex* XFont::GlyphIndex(
+	uint16_t	inCharcode) const
+{
+	XGlyphIndex*	glyphIndex = mFont->glyphIndex;
+	return((glyphIndex &&
+			glyphIndex->IsBuilt() &&
+			XGlyphIndex::Contains(inCharcode)) ? glyphIndex : nullptr);
+}
+
+/******************************* SeekGlyphData ********************************/
+/*
+*	Seeks the glyph data stream to the data following the header of the loaded
+*	glyph.  Seeking resets the stream's unpack state.
+*/
+bool XFont::SeekGlyphData(void)
+{
+	return(mFont->glyphData->Seek(
+		pgm_read_word_near(&mFont->glyphDataOffsets[mCharcodeIndex]) + sizeof(GlyphHeader),
+			DataStream::eSeekSet));
+}
+
 /******************************** DrawCharcode ********************************/
 /*
 *	Draws a single glyph at the current display position.
@@ -219,18 +276,44 @@ bool XFont::DrawCharcode(
 	uint16_t	inCharcode,
 	uint8_t		inFakeMonospaceWidth)
 {
-	bool doContinue = LoadGlyph(inCharcode);
+	bool	rotated = mFontHeader.rotated;
+	/*
+	*	If the glyph cache is being used AND
+	*	the glyph is cached THEN
+	*	the glyph doesn't need to be loaded.
+	*/
+	const uint16_t*	cachedPixels = nullptr;
+	bool	useCache = mGlyphCache &&
+				!rotated &&
+				mDisplay->BitsPerPixel() == 16;
+	if (useCache)
+	{
+		uint16_t	entryIndex;
+		cachedPixels = mGlyphCache->Find(mFont, inCharcode, mTextColor,
+									mTextBGColor, mGlyph, entryIndex);
+		if (cachedPixels)
+		{
+			mCharcode = inCharcode;
+			mCharcodeIndex = entryIndex;
+		}
+	}
+	bool doContinue = cachedPixels || LoadGlyph(inCharcode);
 	while (doContinue)
 	{
-		bool	rotated = mFontHeader.rotated;
 		bool	vertical = false;
 		uint16_t	startRow = mDisplay->GetRow();
 		uint8_t	rows = mGlyph.rows;
 		uint8_t	columns = mGlyph.columns;
+		/*
+		*	glyphX and advanceX are local so that the fake monospace values
+		*	don't modify the loaded glyph header.
+		*/
+		int8_t	glyphX = mGlyph.x;
+		uint8_t	advanceX = mGlyph.advanceX;
 		if (inFakeMonospaceWidth)
 		{
-			mGlyph.x = (inFakeMonospaceWidth - columns)/2;
-			mGlyph.advanceX = inFakeMonospaceWidth;
+			glyphX = (inFakeMonospaceWidth - columns)/2;
+			advanceX = inFakeMonospaceWidth;
 		}
 		if (mFontHeader.oneBit)
 		{
@@ -259,9 +342,9 @@ bool XFont::DrawCharcode(
 		/*
 		*	Clear the pixels before the glyph...
 		*/
-		if (mGlyph.x)
+		if (glyphX)
 		{
-			mDisplay->FillBlock(mFontRows, mGlyph.x, mTextBGColor);
+			mDisplay->FillBlock(mFontRows, glyphX, mTextBGColor);
 		}
 		/*
 		*	One bit rotated will have the y offset shifted into the data
@@ -276,14 +359,39 @@ bool XFont::DrawCharcode(
 			columns)
 		{
 			mDisplay->FillBlock(mGlyph.y, columns, mTextBGColor);
-			mDisplay->MoveTo(startRow + mGlyph.y, startColumn + mGlyph.x);
+			mDisplay->MoveTo(startRow + mGlyph.y, startColumn + glyphX);
 			rowsWritten = mGlyph.y;
 		}
 		if (vertical)
 		{
 			mDisplay->SetAddressingMode(DisplayController::eVertical);
 		}
-		doContinue = mDisplay->StreamCopyBlock(mFont->glyphData, rows, columns);
+		/*
+		*	If the glyph wasn't cached AND
+		*	there's room for it in the cache THEN
+		*	unpack the glyph into the cache.
+		*/
+		if (useCache &&
+			!cachedPixels &&
+			mDisplay->WillFit(rows, columns))
+		{
+			uint16_t*	pixels = mGlyphCache->Add(mFont, inCharcode, mTextColor,
+										mTextBGColor, mGlyph, mCharcodeIndex, rows * columns);
+			if (pixels &&
+				SeekGlyphData())
+			{
+				mFont->glyphData->Read(rows * columns, pixels);
+				cachedPixels = pixels;
+			}
+		}
+		if (cachedPixels)
+		{
+			doContinue = mDisplay->CopyPixelBlock(cachedPixels, rows, columns);
+		} else
+		{
+			doContinue = SeekGlyphData() &&
+				mDisplay->StreamCopyBlock(mFont->glyphData, rows, columns);
+		}
 		if (vertical)
 		{
 			mDisplay->SetAddressingMode(DisplayController::eHorizontal);
@@ -298,7 +406,7 @@ bool XFont::DrawCharcode(
 				rowsWritten < mFontRows)
 			{
 				uint16_t	savedColumn = mDisplay->GetColumn();
-				mDisplay->MoveTo(startRow + rowsWritten, startColumn+mGlyph.x);
+				mDisplay->MoveTo(startRow + rowsWritten, startColumn+glyphX);
 				mDisplay->FillBlock(mFontRows-rowsWritten, columns, mTextBGColor);
 				mDisplay->MoveToColumn(savedColumn);
 			}
@@ -309,18 +417,277 @@ bool XFont::DrawCharcode(
 			*/
 			if (doContinue)
 			{
-				if (mGlyph.advanceX > (mGlyph.x + columns))
+				if (advanceX > (glyphX + columns))
 				{
-					mDisplay->FillBlock(mFontRows, mGlyph.advanceX - mGlyph.x - columns, mTextBGColor);
+					mDisplay->FillBlock(mFontRows, advanceX - glyphX - columns, mTextBGColor);
 					doContinue = mDisplay->GetColumn() != 0;	// don't wrap
 				}
-				mDisplay->MoveToColumn(startColumn+mGlyph.advanceX);
+				mDisplay->MoveToColumn(startColumn+advanceX);
 			}
 		}
 		break;
 	}
 	return(doContinue);
 }
+
+
+/********************************** DrawLine **********************************/
+/*
+*	Draws a single line at the current display position as blocks composed in
+*	mLineBuffer.  Each block is as many whole glyphs as fit in the buffer and
+*	is sent using a single address window.
+*
+*	inCharCount is the maximum number of charcodes of inUTF8Str to draw.
+*	Control characters are ignored.  inWidth is the measured width of the
+*	charcodes drawn, including the ellipsis when inAppendEllipsis is true.
+*	inLeadingColumns and inTrailingColumns of the text background color are
+*	drawn before and after the glyphs.
+*
+*	A glyph that can't be composed, e.g. it's wider than the buffer, is drawn
+*	using DrawCharcode.
+*
+*	CanDrawLine must be called first.  Returns false, having drawn nothing,
+*	if the line doesn't fit on the display.
+*/
+bool XFont::DrawLine(
+	const char*	inUTF8Str,
+	uint16_t	inCharCount,
+	uint16_t	inWidth,
+	bool		inAppendEllipsis,
+	uint8_t		inFakeMonospaceWidth,
+	uint16_t	inLeadingColumns,
+	uint16_t	inTrailingColumns)
+{
+	uint16_t	bufferColumns = mLineBufferPixels/mFontRows;
+	bool	success = mDisplay->WillFit(mFontRows, inLeadingColumns + inWidth + inTrailingColumns);
+	if (success)
+	{
+		const char*	strPtr = inUTF8Str;
+		uint16_t	fillColumns = inLeadingColumns;	// Background columns to add
+		uint16_t	columnsUsed = 0;	// Columns of mLineBuffer used
+		while (true)
+		{
+			/*
+			*	Get the next charcode.  Zero is the end of the line.
+			*/
+			uint16_t	charcode = 0;
+			while (inCharCount)
+			{
+				inCharCount--;
+				charcode = NextChar(strPtr);
+				if (charcode == 0)
+				{
+					inCharCount = 0;
+				} else if (charcode >= ' ')
+				{
+					break;
+				}
+			}
+			if (charcode == 0)
+			{
+				if (inAppendEllipsis)
+				{
+					inAppendEllipsis = false;
+					charcode = kEllipsisCharcode;
+				} else
+				{
+					fillColumns += inTrailingColumns;
+				}
+			}
+			/*
+			*	Add the background columns.  The buffer is cleared to the
+			*	background color before the first column is added, so only
+			*	the number of columns needs to be updated.
+			*/
+			while (fillColumns)
+			{
+				if (columnsUsed == 0)
+				{
+					FillLineBuffer(bufferColumns);
+				}
+				uint16_t	columns = bufferColumns - columnsUsed;
+				if (columns > fillColumns)
+				{
+					columns = fillColumns;
+				}
+				fillColumns -= columns;
+				columnsUsed += columns;
+				if (columnsUsed == bufferColumns)
+				{
+					FlushLine(columnsUsed, bufferColumns);
+					columnsUsed = 0;
+				}
+			}
+			if (charcode == 0)
+			{
+				break;
+			}
+			bool	loaded;
+			const uint16_t*	cachedPixels = LoadLineGlyph(charcode, loaded);
+			if (!loaded)
+			{
+				continue;	// Glyph doesn't exist, same as DrawCharcode
+			}
+			uint8_t	rows = mGlyph.rows;
+			uint8_t	columns = mGlyph.columns;
+			int16_t	glyphX = mGlyph.x;
+			uint16_t	advanceX = mGlyph.advanceX;
+			if (inFakeMonospaceWidth)
+			{
+				glyphX = ((int16_t)inFakeMonospaceWidth - columns)/2;
+				advanceX = inFakeMonospaceWidth;
+			}
+			if ((mGlyph.y + rows) > mFontRows)
+			{
+				rows = mGlyph.y < mFontRows ? mFontRows - mGlyph.y : 0;
+			}
+			/*
+			*	If the glyph won't fit in what remains of the buffer THEN
+			*	send what has been composed so far.
+			*/
+			if (columnsUsed &&
+				(columnsUsed + advanceX) > bufferColumns)
+			{
+				FlushLine(columnsUsed, bufferColumns);
+				columnsUsed = 0;
+			}
+			/*
+			*	If the glyph is within its advance AND
+			*	the advance fits in the buffer THEN
+			*	compose it.
+			*/
+			if (glyphX >= 0 &&
+				(glyphX + columns) <= advanceX &&
+				advanceX <= bufferColumns)
+			{
+				if (columnsUsed == 0)
+				{
+					FillLineBuffer(bufferColumns);
+				}
+				uint16_t*	dest = &mLineBuffer[(mGlyph.y * bufferColumns) + columnsUsed + glyphX];
+				if (cachedPixels)
+				{
+					for (uint8_t row = 0; row < rows; row++)
+					{
+						memcpy(dest, &cachedPixels[row * mGlyph.columns], columns*2);
+						dest += bufferColumns;
+					}
+				} else if (columns &&
+					SeekGlyphData())
+				{
+					for (uint8_t row = 0; row < rows; row++)
+					{
+						mFont->glyphData->Read(columns, dest);
+						dest += bufferColumns;
+					}
+				}
+				columnsUsed += advanceX;
+			/*
+			*	Else draw the glyph on its own.
+			*/
+			} else
+			{
+				if (columnsUsed)
+				{
+					FlushLine(columnsUsed, bufferColumns);
+					columnsUsed = 0;
+				}
+				DrawCharcode(charcode, inFakeMonospaceWidth);
+			}
+		}
+		if (columnsUsed)
+		{
+			FlushLine(columnsUsed, bufferColumns);
+		}
+	}
+	return(success);
+}
+
+/******************************** CanDrawLine *********************************/
+/*
+*	Returns true if DrawLine can be used with the current font, display and
+*	colors.  When the display has a packed fill of the background color,
+*	filling the padding of each glyph costs fewer bytes than sending the
+*	composed line, so DrawLine isn't used.
+*/
+bool XFont::CanDrawLine(void) const
+{
+	return(mFontRows &&
+		(mLineBufferPixels/mFontRows) != 0 &&
+		!mFontHeader.rotated &&
+		mDisplay->BitsPerPixel() == 16 &&
+		!mDisplay->HasPackedFill(mTextBGColor));
+}
+
+/******************************* LoadLineGlyph ********************************/
+/*
+*	Loads the glyph header of inCharcode into mGlyph.  outLoaded is set to
+*	false if the glyph doesn't exist.  Returns the glyph's pixels if they're in
+*	the glyph cache or could be added to it, else nullptr.
+*/
+const uint16_t* XFont::LoadLineGlyph(
+	uint16_t	inCharcode,
+	bool&		outLoaded)
+{
+	const uint16_t*	cachedPixels = nullptr;
+	if (mGlyphCache)
+	{
+		uint16_t	entryIndex;
+		cachedPixels = mGlyphCache->Find(mFont, inCharcode, mTextColor,
+									mTextBGColor, mGlyph, entryIndex);
+		if (cachedPixels)
+		{
+			mCharcode = inCharcode;
+			mCharcodeIndex = entryIndex;
+		}
+	}
+	outLoaded = cachedPixels || LoadGlyph(inCharcode);
+	if (outLoaded &&
+		!cachedPixels &&
+		mGlyphCache)
+	{
+		uint16_t	pixels = mGlyph.rows * mGlyph.columns;
+		uint16_t*	cachePixels = mGlyphCache->Add(mFont, inCharcode, mTextColor,
+									mTextBGColor, mGlyph, mCharcodeIndex, pixels);
+		if (cachePixels &&
+			SeekGlyphData())
+		{
+			mFont->glyphData->Read(pixels, cachePixels);
+			cachedPixels = cachePixels;
+		}
+	}
+	return(cachedPixels);
+}
+
+/******************************* FillLineBuffer *******************************/
+void XFont::FillLineBuffer(
+	uint16_t	inBufferColumns)
+{
+	uint16_t*	pixel = mLineBuffer;
+	for (uint16_t i = mFontRows * inBufferColumns; i; i--)
+	{
+		*(pixel++) = mTextBGColor;
+	}
+}
+
+/********************************* FlushLine **********************************/
+/*
+*	Sends the first inColumns of each row of mLineBuffer.  The rows are first
+*	packed so that they're contiguous.
+*/
+void XFont::FlushLine(
+	uint16_t	inColumns,
+	uint16_t	inBufferColumns)
+{
+	if (inColumns < inBufferColumns)
+	{
+		for (uint8_t row = 1; row < mFontRows; row++)
+		{
+			memmove(&mLineBuffer[row * inColumns], &mLineBuffer[row * inBufferColumns], inColumns*2);
+		}
+	}
+	mDisplay->CopyPixelBlock(mLineBuffer, mFontRows, inColumns);
+}
 	
 //#include <stdio.h>
 /********************************** DrawStr ***********************************/
@@ -347,6 +714,29 @@ void XFont::DrawStr(
 	{
 		inFakeMonospaceWidth = 0;
 	}
+	/*
+	*	If the string can be drawn as a composed line AND
+	*	the string is a single line THEN
+	*	try drawing it as a composed line.
+	*/
+	if (inCharacterLimit == 0 &&
+		CanDrawLine())
+	{
+		uint16_t	height, width;
+		uint8_t		lineCount = 1;
+		if (MeasureStr(inUTF8Str, height, width, inFakeMonospaceWidth, &lineCount) &&
+			lineCount == 1 &&
+			DrawLine(inUTF8Str, 0xFFFF, width, false, inFakeMonospaceWidth))
+		{
+			if (inClearTillEOL &&
+				mDisplay->GetColumn() &&
+				startColumn <= mDisplay->GetColumn())	// in case of wrap to 0
+			{
+				EraseTillEndOfLine();
+			}
+			return;
+		}
+	}
 	uint8_t	charactersDrawn = 0;
 	for (uint16_t charcode = NextChar(strPtr);
 			charcode && (inCharacterLimit == 0 || charactersDrawn < inCharacterLimit);
@@ -520,6 +910,36 @@ void XFont::DrawAligned(
 	{
 		x += ((inWidth - width)/2);
 	}
+	/*
+	*	If the string fits THEN
+	*	try drawing it, including the unused area to be erased, as a single
+	*	composed line.
+	*/
+	if (width <= inWidth &&
+		(!needsTruncation || inWidth > mEllipsisWidth) &&
+		CanDrawLine())
+	{
+		uint16_t	leadingColumns = 0;
+		uint16_t	trailingColumns = 0;
+		if (inEraseUnusedArea)
+		{
+			if (inAlignment != eAlignRight)
+			{
+				trailingColumns = inX + inWidth - x - width;
+			}
+			if (inAlignment != eAlignLeft)
+			{
+				leadingColumns = x - inX;
+			}
+		}
+		mDisplay->MoveTo(inY, x - leadingColumns);
+		if (DrawLine(inUTF8Str, charCount, width, needsTruncation, 0,
+						leadingColumns, trailingColumns))
+		{
+			mStartCol = x;
+			return;
+		}
+	}
 	mDisplay->MoveTo(inY, x);
 	DrawStr(inUTF8Str, false, 0, charCount);
 	if (needsTruncation &&
@@ -615,13 +1035,19 @@ uint8_t XFont::WidestGlyph(
 				uint16_t endEntryIndex = entryIndex + endChar - startChar;
 				if (endEntryIndex < mFontHeader.numCharCodes)
 				{
-					for (; entryIndex <= endEntryIndex; entryIndex++)
+					for (uint16_t charcode = startChar;
+							entryIndex <= endEntryIndex; entryIndex++, charcode++)
 					{
-						if (LoadGlyphHeader(entryIndex))
+						XGlyphIndex*	glyphIndex = GlyphIndex(charcode);
+						if (glyphIndex ?
+								(glyphIndex->EntryIndex(charcode) != 0xFFFF) :
+								LoadGlyphHeader(entryIndex))
 						{
-							if (mGlyph.advanceX > widestGlyph)
+							uint8_t	advanceX = glyphIndex ?
+										glyphIndex->Glyph(charcode).advanceX : mGlyph.advanceX;
+							if (advanceX > widestGlyph)
 							{
-								widestGlyph = mGlyph.advanceX;
+								widestGlyph = advanceX;
 							}
 							continue;
 						}
@@ -832,7 +1258,9 @@ bool XFont::MoveTo(
 uint16_t XFont::Calc565Color(
 	uint8_t		inTint)
 {
-	return(DisplayController::Calc565Color(mTextColor, mTextBGColor, inTint));
+	TintTable&	tints = DisplayController::GetTintTable();
+	tints.SetColors(mTextColor, mTextBGColor);
+	return(tints.Color(inTint));
 }
 
 /****************************** XFontDataStream *******************************/
@@ -28,6 +28,8 @@
 #include "XFontDataStream.h"
 
 class DisplayController;
+class XGlyphCache;
+class XGlyphIndex;
 
 class XFont
 {
@@ -38,18 +40,29 @@ public:
 		const CharcodeRun*	charcodeRuns;
 		const uint16_t*		glyphDataOffsets;
 		XFontDataStream*	glyphData;
+		XGlyphIndex*		glyphIndex;
 							Font(
 								const FontHeader*	inHeader,
 								const CharcodeRun*	inCharcodeRuns,
 								const uint16_t*		inGlyphDataOffsets,
-								XFontDataStream*	inGlyphData = nullptr)
+								XFontDataStream*	inGlyphData = nullptr,
+								XGlyphIndex*		inGlyphIndex = nullptr)
 								: header(inHeader),
 								  charcodeRuns(inCharcodeRuns),
 								  glyphDataOffsets(inGlyphDataOffsets),
-								  glyphData(inGlyphData){}
+								  glyphData(inGlyphData),
+								  glyphIndex(inGlyphIndex){}
 								  
 		XFont*				GetXFont(void) const
 								{return(glyphData->GetXFont());}
+		/*
+		*	SetGlyphIndex: Sets the optional direct index of the font's ASCII
+		*	glyphs.  The index is built when the font is made current, so
+		*	this should be called before the font is first used.
+		*/
+		void				SetGlyphIndex(
+								XGlyphIndex*		inGlyphIndex)
+								{glyphIndex = inGlyphIndex;}
 		XFont*				MakeCurrent(void);
 	};
 							XFont(void);
@@ -62,6 +75,44 @@ public:
 								Font*					inFont = nullptr);
 	DisplayController*		GetDisplay(void) const
 								{return(mDisplay);}
+	/*
+	*	SwapDisplay: Replaces the target display without reloading the font.
+	*	Used to temporarily draw into an off-screen StripDisplayController.
+	*	The bits per pixel of both displays must be the same.  Returns the
+	*	previous display.
+	*/
+	DisplayController*		SwapDisplay(
+								DisplayController*		inDisplay)
+								{
+									DisplayController*	display = mDisplay;
+									mDisplay = inDisplay;
+									return(display);
+								}
+
+	/*
+	*	SetGlyphCache: Sets the optional cache of decoded glyph pixels used by
+	*	16 bit displays.  Pass nullptr to stop using the cache.
+	*/
+	void					SetGlyphCache(
+								XGlyphCache*			inGlyphCache)
+								{mGlyphCache = inGlyphCache;}
+	XGlyphCache*			GetGlyphCache(void) const
+								{return(mGlyphCache);}
+
+	/*
+	*	SetLineBuffer: Sets the optional buffer used by 16 bit displays to
+	*	compose a line of text off-screen.  DrawStr and DrawAligned send the
+	*	composed line using one address window per buffer full rather than
+	*	several address windows per glyph.  The buffer holds inBufferPixels/
+	*	FontRows() columns of the line.  Pass nullptr to stop using it.
+	*/
+	void					SetLineBuffer(
+								uint16_t*				inBuffer,
+								uint16_t				inBufferPixels)
+								{
+									mLineBuffer = inBuffer;
+									mLineBufferPixels = inBuffer ? inBufferPixels : 0;
+								}
 
 	/*
 	*	SetFont: called to set the initial font or to change fonts.
@@ -176,6 +227,7 @@ public:
 								uint16_t				inCharcode);
 	bool					LoadGlyphHeader(
 								uint16_t				inEntryIndex);
+	bool					SeekGlyphData(void);
 	bool					LoadFirstGlyph(
 								const char*				inUTF8Str);
 	/*
@@ -246,6 +298,9 @@ protected:
 	FontHeader			mFontHeader;
 	Font*				mFont;
 	DisplayController*	mDisplay;
+	XGlyphCache*		mGlyphCache;
+	uint16_t*			mLineBuffer;
+	uint16_t			mLineBufferPixels;
 	uint16_t			mTextColor;
 	uint16_t			mTextBGColor;
 	uint16_t			mStartCol;	// Starting column of last call to DrawStr
@@ -256,6 +311,26 @@ protected:
 	bool				mHighlightEnabled;
 	uint8_t				mEllipsisWidth;	// 0 if current font has no ellipsis.
 	static const uint16_t	kEllipsisCharcode;
+
+	XGlyphIndex*			GlyphIndex(
+								uint16_t				inCharcode) const;
+	bool					DrawLine(
+								const char*				inUTF8Str,
+								uint16_t				inCharCount,
+								uint16_t				inWidth,
+								bool					inAppendEllipsis = false,
+								uint8_t					inFakeMonospaceWidth = 0,
+								uint16_t				inLeadingColumns = 0,
+								uint16_t				inTrailingColumns = 0);
+	bool					CanDrawLine(void) const;
+	const uint16_t*			LoadLineGlyph(
+								uint16_t				inCharcode,
+								bool&					outLoaded);
+	void					FillLineBuffer(
+								uint16_t				inBufferColumns);
+	void					FlushLine(
+								uint16_t				inColumns,
+								uint16_t				inBufferColumns);
 };
 
 #endif // XFont_h
@@ -23,8 +23,41 @@
 */
 #include "XFont16BitDataStream.h"
 #include "XFont.h"
+#include "DisplayController.h"
+#include "TintTable.h"
 #include <string.h>
 
+/*
+*	The 4 pixels of each nibble of 1 bit glyph data.  Bit 3 of the nibble is
+*	the first pixel.  All zeros is the correct table for the initial colors.
+*/
+static uint16_t	sNibblePixels[16][4];
+static uint16_t	sNibbleFGColor;
+static uint16_t	sNibbleBGColor;
+
+/****************************** LoadNibbleTable *******************************/
+/*
+*	Rebuilds sNibblePixels if the text colors have changed.
+*/
+static void LoadNibbleTable(
+	uint16_t	inFGColor,
+	uint16_t	inBGColor)
+{
+	if (inFGColor != sNibbleFGColor ||
+		inBGColor != sNibbleBGColor)
+	{
+		sNibbleFGColor = inFGColor;
+		sNibbleBGColor = inBGColor;
+		for (uint8_t nibble = 0; nibble < 16; nibble++)
+		{
+			for (uint8_t i = 0; i < 4; i++)
+			{
+				sNibblePixels[nibble][i] = (nibble & (8 >> i)) ? inFGColor : inBGColor;
+			}
+		}
+	}
+}
+
 /*************************** XFont16BitDataStream *****************************/
 XFont16BitDataStream::XFont16BitDataStream(
 	XFont*		inXFont,
@@ -38,8 +71,10 @@ bool XFont16BitDataStream::Seek(
 	int32_t		inOffset,
 	EOrigin		inOrigin)
 {
-	// Calling Seek flags the state data as waiting for the glyph header Read.
-	mReadGlyphHeader = true;
+	// Seek is called by XFont::SeekGlyphData before each glyph is unpacked.
+	// Reset the unpack state.
+	mNextByte = mEndByte = nullptr;
+	mSavedState.run = {0};
 	return(mSourceStream->Seek(inOffset, inOrigin));
 }
 
@@ -64,19 +99,27 @@ uint32_t XFont16BitDataStream::Clip(
 
 /********************************** NextByte **********************************/
 /*
-*	This routine manages a small buffer rather than constantly calling Read of
-*	the source stream.
+*	The glyph data is used in place when the source stream can be acquired
+*	(e.g. flash, or a line of an SdFatDataStream.)  Otherwise this routine
+*	manages a small buffer rather than constantly calling Read of the source
+*	stream.
 */
 uint8_t XFont16BitDataStream::NextByte(void)
 {
-	if (mBufferIndex == mBytesInBuffer)
+	if (mNextByte == mEndByte)
 	{
-		mBytesInBuffer = (uint8_t)mSourceStream->Read(sizeof(mBuffer), mBuffer);
-		mBufferIndex = 0;
+		uint32_t	length = 0xFFFF;
+		mNextByte = (const uint8_t*)mSourceStream->Acquire(length);
+		if (!mNextByte)
+		{
+			length = mSourceStream->Read(sizeof(mBuffer), mBuffer);
+			mNextByte = mBuffer;
+		}
+		mEndByte = &mNextByte[length];
 	}
-	if (mBytesInBuffer)
+	if (mNextByte != mEndByte)
 	{
-		return(mBuffer[mBufferIndex++]);
+		return(*(mNextByte++));
 	}
 	return(0);
 }
@@ -90,20 +133,13 @@ uint32_t XFont16BitDataStream::Read(
 	uint32_t	inLength,
 	void*		outBuffer)
 {
-	if (mReadGlyphHeader)
-	{
-		mReadGlyphHeader = false;
-		mBufferIndex = 0;
-		mBytesInBuffer = 0;
-		mSavedState.run = {0};
-		return(mSourceStream->Read(inLength, outBuffer));
-	}
 	if (inLength)
 	{
 		uint16_t*	oBufferPtr = (uint16_t*)outBuffer;
 		uint16_t*	oBufferEnd = &oBufferPtr[inLength];
 		if (mXFont->GetFontHeader().oneBit)
 		{
+			LoadNibbleTable(mXFont->GetTextColor(), mXFont->GetBGTextColor());
 			uint8_t	byteIn;
 			int8_t	bitsInByteIn = mSavedState.oneBit.bitsInByteIn;
 
@@ -124,9 +160,26 @@ uint32_t XFont16BitDataStream::Read(
 			}
 			do
 			{
-				for (; oBufferPtr != oBufferEnd && bitsInByteIn; byteIn <<= 1, bitsInByteIn--)
+				/*
+				*	If the whole byte fits in the output buffer THEN
+				*	expand it a nibble (4 pixels) at a time.
+				*/
+				if (bitsInByteIn == 8 &&
+					(oBufferEnd - oBufferPtr) >= 8)
+				{
+					memcpy(oBufferPtr, sNibblePixels[byteIn >> 4], 8);
+					memcpy(&oBufferPtr[4], sNibblePixels[byteIn & 0xF], 8);
+					oBufferPtr += 8;
+					bitsInByteIn = 0;
+				/*
+				*	Else expand what fits a pixel at a time.
+				*/
+				} else
 				{
-					*(oBufferPtr++) = (byteIn & 0x80) ? mXFont->GetTextColor() : mXFont->GetBGTextColor();
+					for (; oBufferPtr != oBufferEnd && bitsInByteIn; byteIn <<= 1, bitsInByteIn--)
+					{
+						*(oBufferPtr++) = (byteIn & 0x80) ? sNibbleFGColor : sNibbleBGColor;
+					}
 				}
 				/*
 				*	If not at the end of the output buffer THEN
@@ -148,12 +201,18 @@ uint32_t XFont16BitDataStream::Read(
 			} while (true);
 		} else
 		{
+			/*
+			*	The tints are converted using the shared tint table rather
+			*	than blending the text colors for each run.
+			*/
+			TintTable&	tints = DisplayController::GetTintTable();
+			tints.SetColors(mXFont->GetTextColor(), mXFont->GetBGTextColor());
 			int8_t runLength = mSavedState.run.length;
 			uint16_t	runColor;
 			if (runLength == 0)
 			{
 				runLength = NextByte();
-				runColor = mXFont->Calc565Color(NextByte());
+				runColor = tints.Color(NextByte());
 			} else
 			{
 				runColor = mSavedState.run.color;
@@ -172,7 +231,7 @@ uint32_t XFont16BitDataStream::Read(
 						runLength++;
 						if (runLength)
 						{
-							runColor = mXFont->Calc565Color(NextByte());
+							runColor = tints.Color(NextByte());
 							continue;
 						}
 						break;
@@ -198,7 +257,7 @@ uint32_t XFont16BitDataStream::Read(
 				if (oBufferPtr != oBufferEnd)
 				{
 					runLength = NextByte();
-					runColor = mXFont->Calc565Color(NextByte());
+					runColor = tints.Color(NextByte());
 				/*
 				*	else, save the state and exit.
 				*/
@@ -48,7 +48,6 @@ public:
 								uint32_t				inLength) const;
 protected:
 	bool		mOneBit;
-	bool		mReadGlyphHeader;
 	
 	// State data
 	union
@@ -65,9 +64,9 @@ protected:
 		} run;
 	} mSavedState;
 
-	uint8_t		mBuffer[32];
-	uint8_t		mBufferIndex;
-	uint8_t		mBytesInBuffer;
+	uint8_t		mBuffer[32];	// Used when the source can't be acquired
+	const uint8_t*	mNextByte;
+	const uint8_t*	mEndByte;
 	
 	uint8_t					NextByte(void);
 };
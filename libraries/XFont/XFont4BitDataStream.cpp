@@ -0,0 +1,222 @@
+/*
+*	XFont4BitDataStream.cpp, Copyright Jonathan Mackey 2023
+*	Class that handles expanding compressed 4 bit glyph data to 16 bit 565
+*	colors.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "XFont4BitDataStream.h"
+#include "XFont.h"
+#include "DisplayController.h"
+#include "TintTable.h"
+
+/*
+*	The 565 color of each of the 16 nibble tints.  All zeros is the correct
+*	table for the initial colors.
+*/
+static uint16_t	sNibbleColors[16];
+static uint16_t	sNibbleFGColor;
+static uint16_t	sNibbleBGColor;
+// The tints of the last 256 pixels unpacked, see XFont4BitDataStream.h
+static uint8_t	sHistory[256];
+
+/****************************** LoadColorTable ********************************/
+/*
+*	Rebuilds sNibbleColors if the text colors have changed.
+*/
+static void LoadColorTable(
+	uint16_t	inFGColor,
+	uint16_t	inBGColor)
+{
+	if (inFGColor != sNibbleFGColor ||
+		inBGColor != sNibbleBGColor)
+	{
+		sNibbleFGColor = inFGColor;
+		sNibbleBGColor = inBGColor;
+		TintTable&	tints = DisplayController::GetTintTable();
+		tints.SetColors(inFGColor, inBGColor);
+		for (uint8_t nibble = 0; nibble < 16; nibble++)
+		{
+			sNibbleColors[nibble] = tints.Color(nibble * 17);
+		}
+	}
+}
+
+/**************************** XFont4BitDataStream *****************************/
+XFont4BitDataStream::XFont4BitDataStream(
+	XFont*		inXFont,
+	DataStream*	inSourceStream)
+	: XFontDataStream(inXFont, inSourceStream)
+{
+}
+
+/************************************ Seek ************************************/
+bool XFont4BitDataStream::Seek(
+	int32_t		inOffset,
+	EOrigin		inOrigin)
+{
+	// Seek is called by XFont::SeekGlyphData before each glyph is unpacked.
+	// Reset the unpack state.  The glyph header has already been loaded.
+	mNextByte = mEndByte = nullptr;
+	mRunLength = 0;
+	mHasNibble = false;
+	mHistoryIndex = 0;
+	mColumns = mXFont->Glyph().columns;
+	return(mSourceStream->Seek(inOffset, inOrigin));
+}
+
+/*********************************** AtEOF ************************************/
+bool XFont4BitDataStream::AtEOF(void) const
+{
+	return(mSourceStream->AtEOF());
+}
+
+/*********************************** GetPos ***********************************/
+uint32_t XFont4BitDataStream::GetPos(void) const
+{
+	return(mSourceStream->GetPos());
+}
+
+/************************************ Clip ************************************/
+uint32_t XFont4BitDataStream::Clip(
+	uint32_t	inLength) const
+{
+	return(mSourceStream->Clip(inLength));
+}
+
+/********************************** NextByte **********************************/
+/*
+*	The glyph data is used in place when the source stream can be acquired
+*	(e.g. flash, or a line of an SdFatDataStream.)  Otherwise this routine
+*	manages a small buffer rather than constantly calling Read of the source
+*	stream.
+*/
+uint8_t XFont4BitDataStream::NextByte(void)
+{
+	if (mNextByte == mEndByte)
+	{
+		uint32_t	length = 0xFFFF;
+		mNextByte = (const uint8_t*)mSourceStream->Acquire(length);
+		if (!mNextByte)
+		{
+			length = mSourceStream->Read(sizeof(mBuffer), mBuffer);
+			mNextByte = mBuffer;
+		}
+		mEndByte = &mNextByte[length];
+	}
+	if (mNextByte != mEndByte)
+	{
+		return(*(mNextByte++));
+	}
+	return(0);
+}
+
+/********************************* NextLength *********************************/
+/*
+*	Returns the value of the length nibbles that follow a run code.
+*/
+uint16_t XFont4BitDataStream::NextLength(void)
+{
+	uint16_t	length = 0;
+	uint8_t		shift = 0;
+	uint8_t		nibble;
+	do
+	{
+		nibble = NextNibble();
+		length |= (uint16_t)(nibble & 7) << shift;
+		shift += 3;
+	} while ((nibble & 8) && shift < 16);
+	return(length);
+}
+
+/************************************ Read ************************************/
+/*
+*	Unpacks 4 bit glyph data to 565 pixel data.
+*	See XFont4BitDataStream.h for packing details.
+*/
+uint32_t XFont4BitDataStream::Read(
+	uint32_t	inLength,
+	void*		outBuffer)
+{
+	if (inLength)
+	{
+		LoadColorTable(mXFont->GetTextColor(), mXFont->GetBGTextColor());
+		uint16_t*	oBufferPtr = (uint16_t*)outBuffer;
+		uint16_t*	oBufferEnd = &oBufferPtr[inLength];
+		uint16_t	runLength = mRunLength;
+		uint8_t		runCode = mRunCode;
+		uint8_t		historyIndex = mHistoryIndex;
+		while (oBufferPtr != oBufferEnd)
+		{
+			/*
+			*	If not continuing a run THEN
+			*	load the next code.
+			*/
+			if (runLength == 0)
+			{
+				runCode = NextNibble();
+				/*
+				*	If this is a single pixel THEN
+				*	unpack it and continue.
+				*/
+				if (runCode != 0 && runCode < 14)
+				{
+					sHistory[historyIndex++] = runCode;
+					*(oBufferPtr++) = sNibbleColors[runCode];
+					continue;
+				}
+				runLength = NextLength() + (runCode == 14 ? 2 : 1);
+			}
+			uint16_t	pixels = oBufferEnd - oBufferPtr;
+			if (pixels > runLength)
+			{
+				pixels = runLength;
+			}
+			runLength -= pixels;
+			/*
+			*	If this is a run of pixels copied from the row above THEN
+			*	the tint of each pixel comes from the history.
+			*/
+			if (runCode == 14)
+			{
+				for (; pixels; pixels--)
+				{
+					uint8_t	tint = sHistory[(uint8_t)(historyIndex - mColumns)];
+					sHistory[historyIndex++] = tint;
+					*(oBufferPtr++) = sNibbleColors[tint];
+				}
+			/*
+			*	Else this is a run of the background or text color.
+			*/
+			} else
+			{
+				uint16_t	color = sNibbleColors[runCode];
+				for (; pixels; pixels--)
+				{
+					sHistory[historyIndex++] = runCode;
+					*(oBufferPtr++) = color;
+				}
+			}
+		}
+		mRunLength = runLength;
+		mRunCode = runCode;
+		mHistoryIndex = historyIndex;
+	}
+	return(inLength);
+}
@@ -0,0 +1,103 @@
+/*
+*	XFont4BitDataStream.h, Copyright Jonathan Mackey 2023
+*	Class that handles expanding compressed 4 bit glyph data to 16 bit 565
+*	colors.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef XFont4BitDataStream_h
+#define XFont4BitDataStream_h
+
+#include "XFontDataStream.h"
+
+/*
+*	The 4 bit format is created from an 8 bit (antialiased) font by
+*	HostTools/XFont4BitConverter.  It takes about 40% of the flash of the
+*	run length encoded 8 bit format.  The font header, charcode runs, glyph
+*	data offsets and glyph headers are the same as the 8 bit format, only the
+*	data following each glyph header differs.
+*
+*	The tints are reduced to 15 levels, 0 to 13 and 15 (tint * 17), and the
+*	glyph data is a stream of nibbles, high nibble first:
+*
+*	  1 to 13	One pixel of this tint.
+*	  0			A run of background (tint 0) pixels followed by a length.
+*	  15		A run of text color (tint 15) pixels followed by a length.
+*	  14		A run of pixels copied from the row above followed by a length.
+*
+*	Each nibble of a length holds 3 bits of the length, least significant
+*	first.  Bit 3 is set if another length nibble follows.  The length is
+*	the value + 1 for runs of tint 0 and 15, and the value + 2 for copies.
+*	As with the 8 bit format, runs don't break at the end of each row.
+*
+*	The copies need the tints of the previous row.  These are kept in a 256
+*	byte history shared by all 4 bit streams (glyph columns never exceed 255.)
+*	Only one glyph is unpacked at a time.
+*
+*	This is only supported by 16 bit displays.
+*/
+class XFont4BitDataStream : public XFontDataStream
+{
+public:
+							XFont4BitDataStream(
+								XFont*					inXFont,
+								DataStream*				inSourceStream);
+
+	virtual uint32_t		Read(
+								uint32_t				inLength,
+								void*					outBuffer);
+	virtual uint32_t		Write(
+								uint32_t				inLength,
+								const void*				inBuffer)
+								{return(0);}
+	virtual bool			Seek(
+								int32_t					inOffset,
+								EOrigin					inOrigin);
+	virtual uint32_t		GetPos(void) const;
+	virtual bool			AtEOF(void) const;
+	virtual uint32_t		Clip(
+								uint32_t				inLength) const;
+protected:
+	// State data
+	uint16_t	mRunLength;		// Pixels remaining in the current run
+	uint8_t		mRunCode;		// 0, 15 or 14 (copy)
+	uint8_t		mByteIn;		// Holds the low nibble when mHasNibble
+	bool		mHasNibble;
+	uint8_t		mColumns;		// Of the glyph being unpacked
+	uint8_t		mHistoryIndex;	// Wraps at 256
+
+	uint8_t		mBuffer[32];	// Used when the source can't be acquired
+	const uint8_t*	mNextByte;
+	const uint8_t*	mEndByte;
+
+	uint8_t					NextByte(void);
+	uint8_t					NextNibble(void)
+								{
+									if (mHasNibble)
+									{
+										mHasNibble = false;
+										return(mByteIn & 0xF);
+									}
+									mByteIn = NextByte();
+									mHasNibble = true;
+									return(mByteIn >> 4);
+								}
+	uint16_t				NextLength(void);
+};
+#endif // XFont4BitDataStream_h
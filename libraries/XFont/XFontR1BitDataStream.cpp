@@ -38,8 +38,11 @@ bool XFontR1BitDataStream::Seek(
 	int32_t		inOffset,
 	EOrigin		inOrigin)
 {
-	// Calling Seek flags the state data as waiting for the glyph header Read.
-	mReadGlyphHeader = true;
+	// Seek is called by XFont::SeekGlyphData before each glyph is unpacked.
+	// Reset the unpack state.
+	mNextByte = mEndByte = nullptr;
+	mBitsInByteIn = 0;
+	mBitsInColumn = 0;
 	return(mSourceStream->Seek(inOffset, inOrigin));
 }
 
@@ -64,19 +67,27 @@ uint32_t XFontR1BitDataStream::Clip(
 
 /********************************** NextByte **********************************/
 /*
-*	This routine manages a small buffer rather than constantly calling Read of
-*	the source stream.
+*	The glyph data is used in place when the source stream can be acquired
+*	(e.g. flash, or a line of an SdFatDataStream.)  Otherwise this routine
+*	manages a small buffer rather than constantly calling Read of the source
+*	stream.
 */
 uint8_t XFontR1BitDataStream::NextByte(void)
 {
-	if (mBufferIndex == mBytesInBuffer)
+	if (mNextByte == mEndByte)
 	{
-		mBytesInBuffer = (uint8_t)mSourceStream->Read(sizeof(mBuffer), mBuffer);
-		mBufferIndex = 0;
+		uint32_t	length = 0xFFFF;
+		mNextByte = (const uint8_t*)mSourceStream->Acquire(length);
+		if (!mNextByte)
+		{
+			length = mSourceStream->Read(sizeof(mBuffer), mBuffer);
+			mNextByte = mBuffer;
+		}
+		mEndByte = &mNextByte[length];
 	}
-	if (mBytesInBuffer)
+	if (mNextByte != mEndByte)
 	{
-		return(mBuffer[mBufferIndex++]);
+		return(*(mNextByte++));
 	}
 	return(0);
 }
@@ -124,15 +135,6 @@ uint32_t XFontR1BitDataStream::Read(
 	uint32_t	inLength,
 	void*		outBuffer)
 {
-	if (mReadGlyphHeader)
-	{
-		mReadGlyphHeader = false;
-		mBufferIndex = 0;
-		mBytesInBuffer = 0;
-		mBitsInByteIn = 0;
-		mBitsInColumn = 0;
-		return(mSourceStream->Read(inLength, outBuffer));
-	}
 	if (inLength)
 	{
 		uint8_t		offsetBitsBy = mXFont->Glyph().y;
@@ -48,16 +48,15 @@ public:
 	virtual uint32_t		Clip(
 								uint32_t				inLength) const;
 protected:
-	bool		mReadGlyphHeader;
 	
 	// State data
 	uint8_t		mBitsInByteIn;
 	uint8_t		mByteIn;
 	uint8_t		mBitsInColumn;
 
-	uint8_t		mBuffer[32];
-	uint8_t		mBufferIndex;
-	uint8_t		mBytesInBuffer;
+	uint8_t		mBuffer[32];	// Used when the source can't be acquired
+	const uint8_t*	mNextByte;
+	const uint8_t*	mEndByte;
 	
 	uint8_t					NextByte(void);
 };
@@ -62,7 +62,6 @@ public:
 	virtual uint32_t		Clip(
 								uint32_t				inLength) const;
 protected:
-	bool		mReadGlyphHeader;
 	
 	// State data
 	uint8_t		mBitsInByteIn;
@@ -70,9 +69,9 @@ protected:
 	uint8_t		mBitsInRowColumn;
 	uint8_t		mColumnsLeftInRow;
 
-	uint8_t		mBuffer[32];
-	uint8_t		mBufferIndex;
-	uint8_t		mBytesInBuffer;
+	uint8_t		mBuffer[32];	// Used when the source can't be acquired
+	const uint8_t*	mNextByte;
+	const uint8_t*	mEndByte;
 	
 	uint8_t					NextByte(void);
 };
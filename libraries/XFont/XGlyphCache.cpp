@@ -0,0 +1,240 @@
+/*
+*	XGlyphCache.cpp, Copyright Jonathan Mackey 2023
+*	Least recently used cache of decoded 16 bit glyph pixels.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "XGlyphCache.h"
+#include <string.h>
+
+/******************************** XGlyphCache *********************************/
+XGlyphCache::XGlyphCache(
+	uint16_t*	inBuffer,
+	uint16_t	inBufferPixels)
+	: mNextCandidate(0), mBuffer(inBuffer), mBufferPixels(inBufferPixels),
+	  mClock(0), mHits(0), mMisses(0)
+{
+	Clear();
+}
+
+/*********************************** Clear ************************************/
+void XGlyphCache::Clear(void)
+{
+	for (uint8_t i = 0; i < kMaxEntries; i++)
+	{
+		mEntries[i].pixels = 0;
+	}
+	memset(mCandidates, 0, sizeof(mCandidates));
+}
+
+/************************************ Find ************************************/
+const uint16_t* XGlyphCache::Find(
+	const XFont::Font*	inFont,
+	uint16_t			inCharcode,
+	uint16_t			inTextColor,
+	uint16_t			inBGColor,
+	GlyphHeader&		outGlyph,
+	uint16_t&			outEntryIndex)
+{
+	const uint16_t*	pixels = nullptr;
+	SEntry*	entry = mEntries;
+	for (uint8_t i = 0; i < kMaxEntries; i++, entry++)
+	{
+		if (entry->pixels &&
+			entry->charcode == inCharcode &&
+			entry->font == inFont &&
+			entry->textColor == inTextColor &&
+			entry->bgColor == inBGColor)
+		{
+			entry->lastUsed = ++mClock;
+			outGlyph = entry->glyph;
+			outEntryIndex = entry->entryIndex;
+			pixels = &mBuffer[entry->offset];
+			break;
+		}
+	}
+	if (pixels)
+	{
+		mHits++;
+	} else
+	{
+		mMisses++;
+	}
+	return(pixels);
+}
+
+/************************************ Add *************************************/
+uint16_t* XGlyphCache::Add(
+	const XFont::Font*	inFont,
+	uint16_t			inCharcode,
+	uint16_t			inTextColor,
+	uint16_t			inBGColor,
+	const GlyphHeader&	inGlyph,
+	uint16_t			inEntryIndex,
+	uint16_t			inPixels)
+{
+	uint16_t*	pixels = nullptr;
+	if (inPixels &&
+		inPixels <= mBufferPixels &&
+		IsCandidate(inFont, inCharcode, inTextColor, inBGColor))
+	{
+		while (true)
+		{
+			/*
+			*	Find an unused entry, the end of the used part of the buffer,
+			*	the total pixels used, and the least recently used entry.
+			*/
+			SEntry*		unusedEntry = nullptr;
+			SEntry*		lruEntry = nullptr;
+			uint16_t	end = 0;
+			uint16_t	used = 0;
+			SEntry*		entry = mEntries;
+			for (uint8_t i = 0; i < kMaxEntries; i++, entry++)
+			{
+				if (entry->pixels)
+				{
+					used += entry->pixels;
+					if ((entry->offset + entry->pixels) > end)
+					{
+						end = entry->offset + entry->pixels;
+					}
+					if (!lruEntry ||
+						(uint16_t)(mClock - entry->lastUsed) > (uint16_t)(mClock - lruEntry->lastUsed))
+					{
+						lruEntry = entry;
+					}
+				} else if (!unusedEntry)
+				{
+					unusedEntry = entry;
+				}
+			}
+			if (unusedEntry)
+			{
+				/*
+				*	If there's room after the last glyph THEN
+				*	add it there.
+				*/
+				uint16_t	offset = end;
+				if ((mBufferPixels - end) < inPixels &&
+					(mBufferPixels - used) >= inPixels)
+				{
+					/*
+					*	Else if there's room after compacting THEN
+					*	compact and add it after the last glyph.
+					*/
+					Compact();
+					offset = used;
+				}
+				if ((mBufferPixels - offset) >= inPixels)
+				{
+					unusedEntry->font = inFont;
+					unusedEntry->charcode = inCharcode;
+					unusedEntry->textColor = inTextColor;
+					unusedEntry->bgColor = inBGColor;
+					unusedEntry->entryIndex = inEntryIndex;
+					unusedEntry->offset = offset;
+					unusedEntry->pixels = inPixels;
+					unusedEntry->lastUsed = ++mClock;
+					unusedEntry->glyph = inGlyph;
+					pixels = &mBuffer[offset];
+					break;
+				}
+			}
+			/*
+			*	Remove the least recently used glyph and try again.
+			*/
+			lruEntry->pixels = 0;
+		}
+	}
+	return(pixels);
+}
+
+/******************************** IsCandidate *********************************/
+/*
+*	Returns true if the glyph is in the list of candidates.  If it isn't, it
+*	replaces the oldest candidate.
+*/
+bool XGlyphCache::IsCandidate(
+	const XFont::Font*	inFont,
+	uint16_t			inCharcode,
+	uint16_t			inTextColor,
+	uint16_t			inBGColor)
+{
+	bool	isCandidate = false;
+	SCandidate*	candidate = mCandidates;
+	for (uint8_t i = 0; i < kMaxCandidates; i++, candidate++)
+	{
+		if (candidate->charcode == inCharcode &&
+			candidate->font == inFont &&
+			candidate->textColor == inTextColor &&
+			candidate->bgColor == inBGColor)
+		{
+			isCandidate = true;
+			break;
+		}
+	}
+	if (!isCandidate)
+	{
+		candidate = &mCandidates[mNextCandidate];
+		candidate->font = inFont;
+		candidate->charcode = inCharcode;
+		candidate->textColor = inTextColor;
+		candidate->bgColor = inBGColor;
+		mNextCandidate = (mNextCandidate + 1) % kMaxCandidates;
+	}
+	return(isCandidate);
+}
+
+/********************************** Compact ***********************************/
+/*
+*	Moves the glyphs to the start of the buffer, preserving their order.
+*/
+void XGlyphCache::Compact(void)
+{
+	uint16_t	offset = 0;
+	SEntry*		prevEntry = nullptr;
+	while (true)
+	{
+		/*
+		*	Find the entry with the lowest offset after the previous entry.
+		*/
+		SEntry*	nextEntry = nullptr;
+		SEntry*	entry = mEntries;
+		for (uint8_t i = 0; i < kMaxEntries; i++, entry++)
+		{
+			if (entry->pixels &&
+				(!prevEntry || entry->offset > prevEntry->offset) &&
+				(!nextEntry || entry->offset < nextEntry->offset))
+			{
+				nextEntry = entry;
+			}
+		}
+		if (!nextEntry)
+		{
+			break;
+		}
+		if (nextEntry->offset != offset)
+		{
+			memmove(&mBuffer[offset], &mBuffer[nextEntry->offset], nextEntry->pixels * 2);
+			nextEntry->offset = offset;
+		}
+		offset += nextEntry->pixels;
+		prevEntry = nextEntry;
+	}
+}
@@ -0,0 +1,131 @@
+/*
+*	XGlyphCache.h, Copyright Jonathan Mackey 2023
+*	Least recently used cache of decoded 16 bit glyph pixels.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef XGlyphCache_h
+#define XGlyphCache_h
+
+#include "XFont.h"
+
+/*
+*	XGlyphCache holds the decoded RGB565 pixels of recently drawn glyphs so
+*	that redrawing a glyph is a single CopyPixels rather than a glyph lookup,
+*	a seek, and decoding the RLE or 1 bit glyph data.  Value fields and the
+*	info view redraw the same digits over and over, so most draws are hits.
+*
+*	A glyph is identified by its font, charcode, text color and background
+*	color.  Only the glyph's rows x columns block is cached, the padding
+*	around the glyph is still filled by XFont::DrawCharcode.
+*
+*	The pixel buffer is supplied by the caller.  Glyphs are packed into the
+*	buffer in the order they're added.  When there isn't room, the least
+*	recently used glyphs are removed and the remaining glyphs are compacted.
+*	A glyph larger than the buffer is never cached.
+*
+*	Most of the text of a dialog is only drawn when the dialog opens.  So that
+*	this text doesn't push the frequently redrawn glyphs out of the cache, a
+*	glyph is only added on its second miss.  The keys of the most recent
+*	first misses are kept in a small list of candidates.
+*
+*	Usage:
+*		uint16_t	glyphCacheBuffer[4096];
+*		XGlyphCache	glyphCache(glyphCacheBuffer, 4096);
+*		xFont.SetGlyphCache(&glyphCache);
+*/
+class XGlyphCache
+{
+public:
+							XGlyphCache(
+								uint16_t*				inBuffer,
+								uint16_t				inBufferPixels);
+	/*
+	*	Find: Returns the cached pixels of the glyph or nullptr if the glyph
+	*	isn't cached.  When found, outGlyph and outEntryIndex are set to the
+	*	glyph's header and glyph data offsets index.
+	*/
+	const uint16_t*			Find(
+								const XFont::Font*		inFont,
+								uint16_t				inCharcode,
+								uint16_t				inTextColor,
+								uint16_t				inBGColor,
+								GlyphHeader&			outGlyph,
+								uint16_t&				outEntryIndex);
+	/*
+	*	Add: Returns a buffer of inPixels to hold the decoded pixels of the
+	*	glyph.  The least recently used glyphs are removed as needed.  Returns
+	*	nullptr if this is the first miss of the glyph or if the glyph is
+	*	larger than the cache.
+	*/
+	uint16_t*				Add(
+								const XFont::Font*		inFont,
+								uint16_t				inCharcode,
+								uint16_t				inTextColor,
+								uint16_t				inBGColor,
+								const GlyphHeader&		inGlyph,
+								uint16_t				inEntryIndex,
+								uint16_t				inPixels);
+	void					Clear(void);
+	uint32_t				Hits(void) const
+								{return(mHits);}
+	uint32_t				Misses(void) const
+								{return(mMisses);}
+	void					ResetStats(void)
+								{mHits = 0; mMisses = 0;}
+protected:
+	struct SEntry
+	{
+		const XFont::Font*	font;
+		uint16_t	charcode;
+		uint16_t	textColor;
+		uint16_t	bgColor;
+		uint16_t	entryIndex;
+		uint16_t	offset;		// Within mBuffer
+		uint16_t	pixels;		// 0 if the entry isn't used
+		uint16_t	lastUsed;
+		GlyphHeader	glyph;
+	};
+	struct SCandidate
+	{
+		const XFont::Font*	font;
+		uint16_t	charcode;
+		uint16_t	textColor;
+		uint16_t	bgColor;
+	};
+	static const uint8_t	kMaxEntries = 32;
+	static const uint8_t	kMaxCandidates = 16;
+	SEntry		mEntries[kMaxEntries];
+	SCandidate	mCandidates[kMaxCandidates];
+	uint8_t		mNextCandidate;	// Oldest candidate, replaced next
+	uint16_t*	mBuffer;
+	uint16_t	mBufferPixels;
+	uint16_t	mClock;			// Incremented each time an entry is used
+	uint32_t	mHits;
+	uint32_t	mMisses;
+
+	void					Compact(void);
+	bool					IsCandidate(
+								const XFont::Font*		inFont,
+								uint16_t				inCharcode,
+								uint16_t				inTextColor,
+								uint16_t				inBGColor);
+};
+
+#endif // XGlyphCache_h
@@ -0,0 +1,45 @@
+/*
+*	XGlyphIndex.cpp, Copyright Jonathan Mackey 2023
+*	Direct index of the printable ASCII glyphs of a font.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#include "XGlyphIndex.h"
+#include "XFont.h"
+
+/*********************************** Build ************************************/
+void XGlyphIndex::Build(
+	XFont&	inXFont)
+{
+	SEntry*	entry = mEntries;
+	for (uint16_t charcode = kFirstCharcode; charcode <= kLastCharcode;
+													charcode++, entry++)
+	{
+		entry->entryIndex = inXFont.FindGlyph(charcode);
+		if (entry->entryIndex != 0xFFFF &&
+			inXFont.LoadGlyphHeader(entry->entryIndex))
+		{
+			entry->glyph = inXFont.Glyph();
+		} else
+		{
+			entry->entryIndex = 0xFFFF;
+		}
+	}
+	mBuilt = true;
+}
@@ -0,0 +1,88 @@
+/*
+*	XGlyphIndex.h, Copyright Jonathan Mackey 2023
+*	Direct index of the printable ASCII glyphs of a font.
+*
+*	GNU license:
+*	This program is free software: you can redistribute it and/or modify
+*	it under the terms of the GNU General Public License as published by
+*	the Free Software Foundation, either version 3 of the License, or
+*	(at your option) any later version.
+*
+*	This program is distributed in the hope that it will be useful,
+*	but WITHOUT ANY WARRANTY; without even the implied warranty of
+*	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*	GNU General Public License for more details.
+*
+*	You should have received a copy of the GNU General Public License
+*	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*	Please maintain this license information along with authorship and copyright
+*	notices in any redistribution of this code.
+*
+*/
+#ifndef XGlyphIndex_h
+#define XGlyphIndex_h
+
+#include <inttypes.h>
+#include "XFontGlyph.h"
+
+class XFont;
+
+/*
+*	XGlyphIndex replaces the binary search of the font's CharcodeRuns and the
+*	glyph header read for the printable ASCII charcodes (space to tilde) with
+*	a lookup.  Almost all of the text drawn and measured is ASCII, so
+*	MeasureStr, used to center and right justify text, no longer touches the
+*	glyph data stream.
+*
+*	Each font has its own index, supplied by the application.  The index is
+*	built by XFont::SetFont the first time the font is made current.  The
+*	glyph headers are stored as adjusted by XFont::LoadGlyphHeader.  Charcodes
+*	outside of the ASCII range are still found using FindGlyph.
+*
+*	Each index is 760 bytes.
+*
+*	Usage:
+*		XGlyphIndex	ui20ptGlyphIndex;
+*		MyriadPro_Regular_20::font.SetGlyphIndex(&ui20ptGlyphIndex);
+*/
+class XGlyphIndex
+{
+public:
+	static const uint16_t	kFirstCharcode = ' ';
+	static const uint16_t	kLastCharcode = '~';
+							XGlyphIndex(void)
+								: mBuilt(false){}
+	/*
+	*	Build: Loads the entry index and glyph header of each ASCII charcode
+	*	of the current font of inXFont.
+	*/
+	void					Build(
+								XFont&					inXFont);
+	bool					IsBuilt(void) const
+								{return(mBuilt);}
+	static bool				Contains(
+								uint16_t				inCharcode)
+								{return(inCharcode >= kFirstCharcode && inCharcode <= kLastCharcode);}
+	/*
+	*	EntryIndex: Returns the glyph data offsets index of inCharcode or
+	*	0xFFFF if the glyph doesn't exist.  inCharcode must be within the
+	*	index, see Contains.
+	*/
+	uint16_t				EntryIndex(
+								uint16_t				inCharcode) const
+								{return(mEntries[inCharcode - kFirstCharcode].entryIndex);}
+	const GlyphHeader&		Glyph(
+								uint16_t				inCharcode) const
+								{return(mEntries[inCharcode - kFirstCharcode].glyph);}
+protected:
+	struct SEntry
+	{
+		GlyphHeader	glyph;
+		uint16_t	entryIndex;	// 0xFFFF if the glyph doesn't exist
+	};
+	SEntry		mEntries[kLastCharcode - kFirstCharcode + 1];
+	bool		mBuilt;
+};
+
+#endif // XGlyphIndex_h
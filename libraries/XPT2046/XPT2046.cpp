@@ -25,7 +25,26 @@
 #include <SPI.h>
 #include "XPT2046.h"
 
+/********************************** Median ************************************/
+static inline uint16_t Median(
+	uint16_t	inA,
+	uint16_t	inB,
+	uint16_t	inC)
+{
+	if (inA > inB)
+	{
+		uint16_t	temp = inA;
+		inA = inB;
+		inB = temp;
+	}
+	// inA <= inB
+	return(inC <= inA ? inA : (inC >= inB ? inB : inC));
+}
+
 volatile bool	XPT2046::sPenStateChanged;
+#ifdef _STM32_DEF_
+XPT2046*	XPT2046::sSampler;
+#endif
 
 /********************************** XPT2046 ***********************************/
 XPT2046::XPT2046(
@@ -44,6 +63,10 @@ XPT2046::XPT2046(
 		mSPISettings(2000000, MSBFIRST, SPI_MODE0),
 		mMinMax{inMinX, inMaxX, inMinY, inMaxY},
 		mInvertX(inInvertX), mInvertY(inInvertY)
+#ifdef _STM32_DEF_
+		, mSampling(false), mTouching(false),
+		mEventHead(0), mEventTail(0), mDroppedEvents(0)
+#endif
 {
 }
 
@@ -211,6 +234,19 @@ bool XPT2046::ReadRaw(
 #endif
 	int32_t z = cmdData[eZ1].data + 0xFFF - cmdData[eZ2].data;
 
+	Orient(cmdData[eX1].data, cmdData[eY1].data, outX, outY);
+	outZ = z;
+	bool	isValid = z >= 100;
+	return(isValid);
+}
+
+/*********************************** Orient ***********************************/
+void XPT2046::Orient(
+	uint16_t	inRawX,
+	uint16_t	inRawY,
+	uint16_t&	outX,
+	uint16_t&	outY) const
+{
 	/*
 	*	The rotation applied below expects a certain orientation.  I decided on
 	*	a default based on one of my displays.  Any display that is wired
@@ -223,36 +259,32 @@ bool XPT2046::ReadRaw(
 	*/
 	if (mInvertX)
 	{
-		cmdData[eX1].data = 0xFFF - cmdData[eX1].data;
+		inRawX = 0xFFF - inRawX;
 	}
 	if (mInvertY)
 	{
-		cmdData[eY1].data = 0xFFF - cmdData[eY1].data;
+		inRawY = 0xFFF - inRawY;
 	}
 
-
 	switch (mRotation)
 	{
 		case 0: // 0
-			outX = cmdData[eY1].data;
-			outY = 0xFFF - cmdData[eX1].data;
+			outX = inRawY;
+			outY = 0xFFF - inRawX;
 			break;
 		case 1: // 90
-			outX = 0xFFF - cmdData[eX1].data;
-			outY = 0xFFF - cmdData[eY1].data;
+			outX = 0xFFF - inRawX;
+			outY = 0xFFF - inRawY;
 			break;
 		case 2: // 180
-			outX = 0xFFF - cmdData[eY1].data;
-			outY = cmdData[eX1].data;
+			outX = 0xFFF - inRawY;
+			outY = inRawX;
 			break;
 		case 3: // 270
-			outX = cmdData[eX1].data;
-			outY = cmdData[eY1].data;
+			outX = inRawX;
+			outY = inRawY;
 			break;
 	}
-	outZ = z;
-	bool	isValid = z >= 100;
-	return(isValid);
 }
 
 /************************************ Read ************************************/
@@ -274,9 +306,267 @@ bool XPT2046::Read(
 /***************************** PenStateChangedISR *****************************/
 void XPT2046::PenStateChangedISR(void)
 {
-	sPenStateChanged = true;
+#ifdef _STM32_DEF_
+	/*
+	*	If sampling THEN
+	*	the sample timer is started on the pen down.  The changes while the
+	*	timer is running, including the toggling of the pen IRQ pin during
+	*	each SPI transfer, are ignored.
+	*/
+	if (sSampler)
+	{
+		if (!sSampler->mSampling &&
+			sSampler->PenIsDown())
+		{
+			sSampler->StartSampling();
+		}
+	} else
+#endif
+	{
+		sPenStateChanged = true;
+	}
+}
+
+#ifdef _STM32_DEF_
+/******************************* BeginSampling ********************************/
+void XPT2046::BeginSampling(
+	TIM_TypeDef*	inTimer)
+{
+	mSampleTimer.setup(inTimer);
+	mSampleTimer.setOverflow(kSamplePeriodUS, MICROSEC_FORMAT);
+	/*
+	*	The lowest priority so that a sample (about 150us at 2MHz) never
+	*	delays the stepper ISRs.
+	*/
+	mSampleTimer.setInterruptPriority(15, 0);
+	mSampleTimer.attachInterrupt([this] {SampleISR();});
+	/*
+	*	From here on every other SPI transaction masks the sample IRQ.
+	*/
+	SPIBus::SetSharedIRQ(getTimerUpIrq(inTimer));
+	sSampler = this;
+	if (PenIsDown())
+	{
+		StartSampling();
+	}
+}
+
+/******************************* StartSampling ********************************/
+void XPT2046::StartSampling(void)
+{
+	mSampling = true;
+	mTouching = false;
+	mValidSamples = 0;
+	mInvalidSamples = 0;
+	mSampleTimer.setCount(0);
+	mSampleTimer.resume();
+}
+
+/********************************* SampleISR **********************************/
+/*
+*	Called by mSampleTimer every kSamplePeriodUS while the pen is down.
+*	The pen down is reported after kPenDownSamples consecutive samples with
+*	sufficient pressure, the pen up after kPenUpSamples without.  Light or
+*	bouncing contact is therefore never reported as a series of taps.
+*/
+void XPT2046::SampleISR(void)
+{
+	// Read before the transfer toggles the pen IRQ pin.
+	bool		penIsDown = PenIsDown();
+	uint16_t	x, y, z;
+	if (penIsDown &&
+		ReadMedian(x, y, z))
+	{
+		mInvalidSamples = 0;
+		if (mTouching)
+		{
+			/*
+			*	IIR low pass, filtered += (sample - filtered)/4.  The
+			*	filtered values have 4 fractional bits.
+			*/
+			mFilteredX += (((int32_t)x << 4) - (int32_t)mFilteredX) / 4;
+			mFilteredY += (((int32_t)y << 4) - (int32_t)mFilteredY) / 4;
+			QueueEvent(ePenMoved, z);
+		} else if (++mValidSamples >= kPenDownSamples)
+		{
+			mTouching = true;
+			mFilteredX = (uint32_t)x << 4;
+			mFilteredY = (uint32_t)y << 4;
+			QueueEvent(ePenDown, z);
+		}
+	} else
+	{
+		mValidSamples = 0;
+		if (mTouching)
+		{
+			if (++mInvalidSamples >= kPenUpSamples)
+			{
+				mTouching = false;
+				QueueEvent(ePenUp, 0);
+			}
+		/*
+		*	Else if the pen is up THEN
+		*	stop sampling.  The pen is checked again after clearing
+		*	mSampling in case the pen down interrupt was ignored just
+		*	before it was cleared.
+		*/
+		} else if (!penIsDown)
+		{
+			mSampling = false;
+			if (PenIsDown())
+			{
+				mSampling = true;
+			} else
+			{
+				mSampleTimer.pause();
+			}
+		}
+	}
+}
+
+/********************************* ReadMedian *********************************/
+/*
+*	Same as ReadRaw except that X and Y are the median of 3 readings and
+*	the pen IRQ is left attached.  Called from SampleISR.
+*/
+bool XPT2046::ReadMedian(
+	uint16_t&	outX,
+	uint16_t&	outY,
+	uint16_t&	outZ)
+{
+	enum
+	{
+		eZ1,
+		eZ2,
+		eX0,	// Ignored to allow for settling
+		eY0,	// Ignored to allow for settling
+		eX1,
+		eY1,
+		eX2,
+		eY2,
+		eX3,
+		eY3,
+		eNumCommands
+	};
+	struct SCmdData
+	{
+		uint8_t		cmd;
+		uint16_t	data;
+	} __attribute__ ((packed)) cmdData[eNumCommands] =
+			{{0xB1},{0xC1},{0x91},{0xD1},{0x91},{0xD1},{0x91},{0xD1},{0x91},{0xD0}};
+	BeginTransaction();
+	SPI.transfer(&cmdData[0].cmd, sizeof(cmdData));
+	EndTransaction();
+
+	uint16_t	values[eNumCommands];
+	for (uint8_t i = 0; i < eNumCommands; i++)
+	{
+		// See SCmdData::Adjust in ReadRaw
+		uint16_t	data = cmdData[i].data;
+	#if BYTE_ORDER == LITTLE_ENDIAN
+		values[i] = ((data & 0xff00) >> 11) | ((data & 0xff) << 5);
+	#else
+		values[i] = data >> 3;
+	#endif
+	}
+	int32_t z = values[eZ1] + 0xFFF - values[eZ2];
+	/*
+	*	The median of 3 rejects a single reading disturbed by noise, which
+	*	an average would only dilute.
+	*/
+	uint16_t	rawX = Median(values[eX1], values[eX2], values[eX3]);
+	uint16_t	rawY = Median(values[eY1], values[eY2], values[eY3]);
+	Orient(rawX, rawY, outX, outY);
+	outZ = z;
+	return(z >= kMinPressure);
 }
 
+/********************************* QueueEvent *********************************/
+/*
+*	Queues an event at the filtered position mapped to display coordinates.
+*	A move that doesn't change the mapped position isn't queued.  When the
+*	queue is full a move or pen up replaces a trailing move, so the latest
+*	position and the pen up are never lost to a backlog of moves.  A pen
+*	up that finds its own pen down at the end of a full queue retracts the
+*	pen down, so a touch is always seen as a pen down and pen up pair or
+*	not at all.
+*/
+void XPT2046::QueueEvent(
+	uint8_t		inType,
+	uint16_t	inZ)
+{
+	STouchEvent	event;
+	event.type = inType;
+	event.z = inZ;
+	event.time = millis();
+	if (inType == ePenUp)
+	{
+		event.x = mLastEvent.x;
+		event.y = mLastEvent.y;
+	} else
+	{
+		event.x = map(mFilteredX >> 4, mMinMax[eXMin], mMinMax[eXMax], 0, mColumns);
+		event.y = map(mFilteredY >> 4, mMinMax[eYMin], mMinMax[eYMax], 0, mRows);
+	}
+	if (inType != ePenMoved ||
+		event.x != mLastEvent.x ||
+		event.y != mLastEvent.y)
+	{
+		mLastEvent = event;
+		const uint8_t	kIndexMask = kEventQueueSize - 1;
+		uint8_t	head = mEventHead;
+		uint8_t	nextHead = (head + 1) & kIndexMask;
+		if (nextHead != mEventTail)
+		{
+			mEvents[head] = event;
+			// The event must be written before the head is advanced.
+			__DMB();
+			mEventHead = nextHead;
+		} else
+		{
+			/*
+			*	The queue is full.  The consumer is reading at mEventTail, so
+			*	the last event queued (head-1) can safely be replaced.
+			*/
+			STouchEvent&	lastQueued = mEvents[(head - 1) & kIndexMask];
+			if (inType != ePenDown &&
+				lastQueued.type == ePenMoved)
+			{
+				lastQueued = event;
+			/*
+			*	Else if this is the pen up of the pen down queued last THEN
+			*	remove the pen down.  Otherwise the consumer would see a pen
+			*	down without a pen up.
+			*/
+			} else if (inType == ePenUp &&
+				lastQueued.type == ePenDown)
+			{
+				mEventHead = (head - 1) & kIndexMask;
+				mDroppedEvents += 2;
+			} else
+			{
+				mDroppedEvents++;
+			}
+		}
+	}
+}
+
+/********************************** GetEvent **********************************/
+bool XPT2046::GetEvent(
+	STouchEvent&	outEvent)
+{
+	uint8_t	tail = mEventTail;
+	bool	eventQueued = tail != mEventHead;
+	if (eventQueued)
+	{
+		outEvent = mEvents[tail];
+		__DMB();
+		mEventTail = (tail + 1) & (kEventQueueSize - 1);
+	}
+	return(eventQueued);
+}
+#endif
+
 /********************************* DumpMinMax *********************************/
 void XPT2046::DumpMinMax(void) const
 {
@@ -24,12 +24,44 @@
 #define XPT2046_h
 #include <SPI.h>
 #include "PlatformDefs.h"
+#include "SPIBus.h"
 #include "MSPeriod.h"
 
 
+/*
+*	Touches can be read two ways:
+*
+*	- Polled: Call PenStateChanged() from loop(), then PenIsDown() and Read()
+*	  to take a single sample.
+*	- Sampled (STM32 only): After begin(), call BeginSampling().  While the
+*	  pen is down a hardware timer samples the touch screen every
+*	  kSamplePeriodUS.  Each sample is the median of 3 readings, gated by
+*	  pressure, and smoothed by an IIR filter.  The resulting pen down, moved
+*	  and up events are queued with their time.  Call GetEvent() from loop()
+*	  to consume them.  GetEvent never waits on the SPI bus.
+*
+*	The touch controller usually shares the SPI bus.  BeginSampling
+*	registers the sample timer's IRQ with SPIBus, so every other device on
+*	the bus must use SPIBus::BeginTransaction/EndTransaction.  A sample due
+*	during another transaction is delayed until that transaction ends.
+*/
 class XPT2046
 {
 public:
+	enum ETouchEvent
+	{
+		ePenDown,
+		ePenMoved,
+		ePenUp
+	};
+	struct STouchEvent
+	{
+		uint8_t		type;		// ETouchEvent
+		uint16_t	x;			// Display coordinates (see Read)
+		uint16_t	y;
+		uint16_t	z;			// Pressure
+		uint32_t	time;		// millis() when sampled
+	};
 							XPT2046(
 								pin_t					inCSPin,
 								pin_t					inPenIRQPin,
@@ -71,7 +103,21 @@ public:
 								uint16_t				outMinMax[4]) const;
 	void					SetMinMax(
 								const uint16_t			inMinMax[4]);
-	
+#ifdef _STM32_DEF_
+	static const uint32_t	kSamplePeriodUS = 5000;	// 200 samples/s
+	/*
+	*	BeginSampling: inTimer is a free hardware timer, e.g. one returned by
+	*	STMTimers::AllocateNextAvailable().
+	*/
+	void					BeginSampling(
+								TIM_TypeDef*			inTimer);
+	bool					GetEvent(
+								STouchEvent&			outEvent);
+	// Events lost because the queue was full.  Moves are coalesced first,
+	// a pen down and pen up pair is dropped together.
+	uint32_t				DroppedEvents(void) const
+								{return(mDroppedEvents);}
+#endif
 protected:
 	pin_t		mCSPin;
 	pin_t		mPenIRQPin;
@@ -98,7 +144,36 @@ protected:
 	port_t		mChipSelBitMask;
 	SPISettings	mSPISettings;
 	static volatile bool	sPenStateChanged;
+#ifdef _STM32_DEF_
+	static const uint16_t	kMinPressure = 100;	// Same as ReadRaw
+	static const uint8_t	kPenDownSamples = 2;	// Valid samples before ePenDown
+	static const uint8_t	kPenUpSamples = 2;	// Invalid samples before ePenUp
+	static const uint8_t	kEventQueueSize = 16;	// Power of 2
+	static XPT2046*			sSampler;
+	HardwareTimer			mSampleTimer;
+	volatile bool			mSampling;		// The sample timer is running
+	bool					mTouching;		// ePenDown queued, ePenUp not yet
+	uint8_t					mValidSamples;
+	uint8_t					mInvalidSamples;
+	// Filtered raw values, 4 fractional bits.
+	uint32_t				mFilteredX;
+	uint32_t				mFilteredY;
+	STouchEvent				mLastEvent;
+	STouchEvent				mEvents[kEventQueueSize];
+	volatile uint8_t		mEventHead;		// Written by the ISR
+	volatile uint8_t		mEventTail;		// Written by GetEvent
+	volatile uint32_t		mDroppedEvents;
 
+	void					StartSampling(void);
+	void					SampleISR(void);
+	bool					ReadMedian(
+								uint16_t&				outX,
+								uint16_t&				outY,
+								uint16_t&				outZ);
+	void					QueueEvent(
+								uint8_t					inType,
+								uint16_t				inZ);
+#endif
 
 	bool					ReadRaw(
 								uint16_t&				outX,
@@ -106,9 +181,14 @@ protected:
 								uint16_t&				outZ);
 	void					SetRotation(
 								uint8_t					inRotation);
+	void					Orient(
+								uint16_t				inRawX,
+								uint16_t				inRawY,
+								uint16_t&				outX,
+								uint16_t&				outY) const;
 	inline void				BeginTransaction(void)
 							{
-								SPI.beginTransaction(mSPISettings);
+								SPIBus::BeginTransaction(mSPISettings);
 								if (mCSPin >= 0)
 								{
 									*mChipSelPortReg &= ~mChipSelBitMask;
@@ -122,7 +202,7 @@ protected:
 								{
 									*mChipSelPortReg |= mChipSelBitMask;
 								}
-								SPI.endTransaction();
+								SPIBus::EndTransaction();
 							}
 
 	static void				PenStateChangedISR(void);
@@ -25,6 +25,7 @@
 #include "XDialogBox.h"
 #include "XRootView.h"
 #include "DisplayController.h"
+#include "DataStream.h"
 static const int16_t	kDialogFrameGap = 20;
 static const int16_t	kTitleBarHeight = 30;
 static const int16_t	kSpaceBetweenButtons = 10;
@@ -52,7 +53,8 @@ XDialogBox::XDialogBox(
 	  mTitleLine(0,0,0,0,inTag+eTitleLineTagOffset,&mTitleLabel, kSeparatorLineColor),
 	  mFGColor(inFGColor), mBGColor(inBGColor), mSavedModalView(nullptr),
 	  mViewChangedDelegate(inViewChangedDelegate), mValidatorDelegate(nullptr),
-	  mMinDialogWidth(0), mMinDialogHeight(0), mMinButtonWidth(80)
+	  mMinDialogWidth(0), mMinDialogHeight(0), mMinButtonWidth(80),
+	  mStaticLayer(nullptr), mDynamicViews(nullptr)
 {
 	SetSubViews(&mTitleLine);
 }
@@ -273,6 +275,7 @@ void XDialogBox::Draw(
 		mY + mHeight > inY &&
 		inY + inHeight > mY)
 	{
+		bool	drawSubViews = true;
 		/*
 		*	If the edge of the dialog is clipped THEN
 		*	draw the entire background.
@@ -282,12 +285,30 @@ void XDialogBox::Draw(
 			inX+inWidth > mX+mWidth ||
 			inY+inHeight > mY+mHeight)
 		{
-			DrawSelf();
-			// Because the entire background is being drawn, make sure
-			// all of the sub views are drawn, not just the views in the
-			// original area passed.
-			inX = inY = 0;
-			inWidth = inHeight = 0x7FF;
+			/*
+			*	If the static layer was drawn THEN
+			*	only the dynamic views need to be drawn.
+			*/
+			if (DrawStaticLayer())
+			{
+				for (XView* const* dynamicView = mDynamicViews;
+						dynamicView && *dynamicView; dynamicView++)
+				{
+					if ((*dynamicView)->IsVisible())
+					{
+						(*dynamicView)->DrawSelf();
+					}
+				}
+				drawSubViews = false;
+			} else
+			{
+				DrawSelf();
+				// Because the entire background is being drawn, make sure
+				// all of the sub views are drawn, not just the views in the
+				// original area passed.
+				inX = inY = 0;
+				inWidth = inHeight = 0x7FF;
+			}
 		/*
 		*	Else, the area being redrawn doesn't intersect, and is completely
 		*	within the dialog frame.  Just fill the area to be redrawn with
@@ -301,7 +322,8 @@ void XDialogBox::Draw(
 				xFont->GetDisplay()->FillRect(inX, inY, inWidth, inHeight, mFGColor);
 			}
 		}
-		if (mSubViews)
+		if (mSubViews &&
+			drawSubViews)
 		{
 			mSubViews->Draw(inX-mX, inY-mY, inWidth, inHeight);
 		}
@@ -327,3 +349,30 @@ void XDialogBox::DrawSelf(void)
 	}
 }
 
+/****************************** DrawStaticLayer *******************************/
+/*
+*	Copies the static layer to the display.  Returns false if there's no
+*	static layer or the layer wasn't rendered for this dialog, in which case
+*	the dialog needs to be drawn from its views.
+*/
+bool XDialogBox::DrawStaticLayer(void)
+{
+	bool	success = false;
+	if (mStaticLayer)
+	{
+		XFont*	xFont = mTitleLabel.MakeFontCurrent();
+		uint16_t	header[3];	// tag, width, height
+		if (xFont &&
+			mStaticLayer->Seek(0, DataStream::eSeekSet) &&
+			mStaticLayer->Read(3, header) == 3 &&
+			header[0] == mTag &&
+			header[1] == mWidth &&
+			header[2] == mHeight)
+		{
+			DisplayController*	display = xFont->GetDisplay();
+			display->MoveTo(mY, mX);
+			success = display->StreamCopyBlock(mStaticLayer, mHeight, mWidth);
+		}
+	}
+	return(success);
+}
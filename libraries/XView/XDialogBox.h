@@ -29,6 +29,7 @@
 #include "XLine.h"
 
 class XValidatorDelegate;
+class DataStream;
 
 class XDialogBox : public XView
 {
@@ -86,6 +87,25 @@ public:
 								{return(&mCancelButton);}
 	XLabel*					GetTitleLabel(void)
 								{return(&mTitleLabel);}
+	/*
+	*	SetStaticLayer: When the entire dialog is drawn, the pre-rendered
+	*	static layer is copied to the display rather than drawing the frame
+	*	and each of the layout views.  Only inDynamicViews, a null terminated
+	*	list of the views whose content changes, are then drawn over it.
+	*
+	*	inStaticLayer is a 16 bit data stream (Read lengths are in pixels.)
+	*	The first 3 pixels are a header: the dialog tag, width and height.
+	*	The header is followed by width*height 565 pixels of the dialog's
+	*	bounds, in rows.  See HostTools/KMDialogLayers.
+	*
+	*	If the header doesn't match this dialog (e.g. the stream isn't open)
+	*	the dialog is drawn from its views.
+	*/
+	void					SetStaticLayer(
+								DataStream*				inStaticLayer,
+								XView* const*			inDynamicViews)
+								{mStaticLayer = inStaticLayer;
+								 mDynamicViews = inDynamicViews;}
 
 	enum ETagOffset
 	{
@@ -108,7 +128,10 @@ protected:
 	uint16_t		mMinButtonWidth;
 	XViewChangedDelegate*	mViewChangedDelegate;
 	XValidatorDelegate*		mValidatorDelegate;
+	DataStream*		mStaticLayer;
+	XView* const*	mDynamicViews;
 
+	bool					DrawStaticLayer(void);
 	virtual	void			HandleChange(
 							XView*						inView,
 							uint16_t					inAction = 0);
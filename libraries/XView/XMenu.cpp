@@ -36,6 +36,7 @@ static const uint16_t	kSelectedItemBGColor = 0xFCA6;
 static const uint16_t	kSelectedItemTextColor = 0xFFFF;
 static const uint16_t	kItemTextColor = 0;
 static const uint16_t	kDisabledItemColor = 0xCE79;	// Text & separators
+static const uint16_t	kNoItemIndex = 0xFFFF;
 
 /*********************************** XMenu ************************************/
 XMenu::XMenu(
@@ -47,10 +48,32 @@ XMenu::XMenu(
 	: XView(0, 0, 0, 0, inTag, nullptr, nullptr, inAnchorView, false),
 	  mFont(inFont), mMenuItems(inMenuItems), mSelectedItem(nullptr),
 	  mAutoClearSelected(true),  mSuperViewAnchor(XMenu::eAnchorToBottom),
-	  mBGColor(inBGColor)
+	  mBGColor(inBGColor), mScrollable(false),
+	  mScrollTap(false), mTopItem(inMenuItems), mTopItemIndex(0),
+	  mItemCount(0), mVisibleRows(0), mItemsX(0),
+	  mItemsTop(0), mItemsBottom(0), mDataSource(nullptr),
+	  mVirtualItem(nullptr), mRecycledItems(nullptr), mRecycledCount(0),
+	  mVirtualItemIndex(kNoItemIndex), mSelectedIndex(kNoItemIndex)
 {
 }
 
+/******************************* SetDataSource ********************************/
+void XMenu::SetDataSource(
+	XMenuDataSource*	inDataSource,
+	XMenuItem*			inItems,
+	uint16_t			inItemCount)
+{
+	mDataSource = inDataSource;
+	mVirtualItem = inItems;
+	mRecycledItems = &inItems[1];
+	mRecycledCount = inItemCount - 1;
+	mVirtualItemIndex = kNoItemIndex;
+	mSelectedIndex = kNoItemIndex;
+	mSelectedItem = nullptr;
+	mMenuItems = nullptr;
+	mTopItem = nullptr;
+}
+
 /************************************ Show ************************************/
 void XMenu::Show(void)
 {
@@ -87,15 +110,41 @@ void XMenu::Show(void)
 	mQuarterItemHeight = (mHalfItemHeight+1)/2;		// Used as the view's corner radius
 	mEighthItemHeight = (mQuarterItemHeight+1)/2;	// Used as the selected item's corner radius
 	/*
+	*	In the virtual mode only the rows that can be shown are loaded.  They're
+	*	loaded here so that the width is based on them, then loaded again below
+	*	once the number of rows that fit on the display is known.
+	*/
+	if (mDataSource)
+	{
+		mItemCount = GetItemCount();
+		if (mSelectedIndex >= mItemCount)
+		{
+			ClearSelectedItem();
+		}
+		mVisibleRows = mItemCount < mRecycledCount ? mItemCount : mRecycledCount;
+		mTopItemIndex = GetCenteredTopItemIndex(mSelectedIndex);
+		LoadRows();
+	}
+	/*
 	*	Position the menu based on the mSuperViewAnchor hint and the location of
 	*	the menu relative to the bounds of the display.
 	*/
 	{
 		uint16_t	viewWidth = GetWidestItemWidth() + (mTextInset*2);
 		uint16_t	numSeparators = 0;
+		mItemCount = GetItemCount(&numSeparators);
 		uint16_t viewHeight = (mQuarterItemHeight*2) +
-								(GetItemCount(&numSeparators) * mItemHeight) -
+								(mItemCount * mItemHeight) -
 									(numSeparators*mHalfItemHeight);
+		uint16_t	unclippedViewHeight = viewHeight;
+		/*
+		*	In the virtual mode the rows are limited to the recycled items.
+		*/
+		bool	needsScroll = mDataSource && mItemCount > mRecycledCount;
+		if (needsScroll)
+		{
+			viewHeight = (mQuarterItemHeight*2) + (mHalfItemHeight*2) + (mRecycledCount*mItemHeight);
+		}
 		if (viewHeight > display->GetRows())
 		{
 			viewHeight = display->GetRows();
@@ -135,7 +184,21 @@ void XMenu::Show(void)
 				viewWidth = mSuperView->Width();
 			}
 			// Get the top of the selected item
-			int16_t	itemTop = GetItemTop(mSelectedItem ? mSelectedItem : mMenuItems);
+			int16_t	itemTop;
+			if (mDataSource)
+			{
+				/*
+				*	The loaded rows start at mTopItemIndex.
+				*/
+				itemTop = mQuarterItemHeight + (needsScroll ? mHalfItemHeight : 0);
+				if (mSelectedIndex < mItemCount)
+				{
+					itemTop += (mSelectedIndex - mTopItemIndex)*mItemHeight;
+				}
+			} else
+			{
+				itemTop = GetItemTop(mSelectedItem ? mSelectedItem : mMenuItems);
+			}
 			// Center it over the superview 
 			itemTop-=((mSuperView->Height() - mItemHeight)/2);
 			globalY -= itemTop;
@@ -172,26 +235,82 @@ void XMenu::Show(void)
 		{
 			globalX = displayWidth - viewWidth;
 		}
+		/*
+		*	If not all of the items fit THEN
+		*	use the scroll mode.  In the scroll mode the items are preceded
+		*	and followed by a scroll arrow strip mHalfItemHeight tall, and the
+		*	item area is a whole number of item rows.
+		*/
+		mTopItem = mMenuItems;
+		mTopItemIndex = 0;
+		mScrollable = false;
+		if (needsScroll || viewHeight < unclippedViewHeight)
+		{
+			mVisibleRows = (viewHeight - (mQuarterItemHeight*2) - (mHalfItemHeight*2))/mItemHeight;
+			mScrollable = mVisibleRows > 0 &&
+				viewHeight >= ((mQuarterItemHeight*2) + (mHalfItemHeight*2));
+		}
+		if (mScrollable)
+		{
+			viewHeight = (mQuarterItemHeight*2) + (mHalfItemHeight*2) + (mVisibleRows*mItemHeight);
+			/*
+			*	If the selected item isn't visible THEN
+			*	scroll so that it's in the middle of the item area.
+			*/
+			uint16_t	selectedIndex = mSelectedIndex;
+			if (mSelectedItem && !mDataSource)
+			{
+				selectedIndex = 0;
+				for (XMenuItem*	thisItem = mMenuItems; thisItem &&
+						thisItem != mSelectedItem; thisItem = thisItem->mNextItem)
+				{
+					selectedIndex++;
+				}
+			}
+			mTopItemIndex = GetCenteredTopItemIndex(selectedIndex);
+			if (!mDataSource)
+			{
+				mTopItem = GetItemAtIndex(mTopItemIndex);
+			}
+		}
+		if (mDataSource)
+		{
+			if (!mScrollable)
+			{
+				mVisibleRows = mItemCount;
+			}
+			LoadRows();
+		}
+		mItemsX = globalX;
+		mItemWidth = viewWidth - (mTextInset*2);
+		mItemFrameWidth =  viewWidth - (mQuarterItemHeight*2);
 		mX = globalX;
 		mY = globalY;
 		mWidth = viewWidth;
 		mHeight = viewHeight;
+		mItemsTop = mY + mQuarterItemHeight;
+		if (mScrollable)
+		{
+			mItemsTop += mHalfItemHeight;
+			mItemsBottom = mItemsTop + (mVisibleRows*mItemHeight);
+		} else
+		{
+			mItemsBottom = mY + mHeight - mQuarterItemHeight;
+		}
 	}
 	/*
 	*	Draw the menu
 	*/
 	{
-		mItemWidth = mWidth - (mTextInset*2);
-		mItemFrameWidth =  mWidth - (mQuarterItemHeight*2);
 		display->SetFGColor(0xB5B6);
 		display->SetBGColor(mBGColor);
 		display->DrawRoundedRect(mX, mY, mWidth, mHeight, mQuarterItemHeight, 255, true);
 		display->SetFGColor(kViewBGColor);
 		display->DrawRoundedRect(mX+1, mY+1, mWidth-2, mHeight-2, mQuarterItemHeight);
-		int16_t		itemY = mY+mQuarterItemHeight;
-		for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
+		DrawVisibleItems(false);
+		if (mScrollable)
 		{
-			itemY = DrawItem(itemY, thisItem);
+			DrawScrollArrows();
 		}
 	}
 }
@@ -229,6 +348,182 @@ int16_t XMenu::GetItemTop(
 	return(itemTop);
 }
 
+/******************************* GetItemAtIndex *******************************/
+XMenuItem* XMenu::GetItemAtIndex(
+	uint16_t	inIndex) const
+{
+	XMenuItem*	thisItem = mMenuItems;
+	/*
+	*	In the virtual mode only the visible rows exist.  mMenuItems is the
+	*	row of mTopItemIndex.
+	*/
+	if (mDataSource)
+	{
+		if (inIndex < mTopItemIndex)
+		{
+			thisItem = nullptr;
+		} else
+		{
+			inIndex -= mTopItemIndex;
+		}
+	}
+	for (; thisItem && inIndex; inIndex--)
+	{
+		thisItem = thisItem->mNextItem;
+	}
+	return(thisItem);
+}
+
+/************************** GetCenteredTopItemIndex ***************************/
+/*
+*	Returns the top item index that places inIndex in the middle of the
+*	visible rows, or 0 if inIndex is within the first page.
+*/
+uint16_t XMenu::GetCenteredTopItemIndex(
+	uint16_t	inIndex) const
+{
+	uint16_t	topItemIndex = 0;
+	if (inIndex < mItemCount &&
+		inIndex >= mVisibleRows)
+	{
+		topItemIndex = inIndex - (mVisibleRows/2);
+		if (topItemIndex > (mItemCount - mVisibleRows))
+		{
+			topItemIndex = mItemCount - mVisibleRows;
+		}
+	}
+	return(topItemIndex);
+}
+
+/******************************** GetRowIndex *********************************/
+/*
+*	Virtual mode.  Returns the item index of a visible row, or kNoItemIndex if
+*	inRow isn't a visible row.
+*/
+uint16_t XMenu::GetRowIndex(
+	XMenuItem*	inRow) const
+{
+	uint16_t	index = mTopItemIndex;
+	XMenuItem*	thisItem = mMenuItems;
+	for (; thisItem && thisItem != inRow; thisItem = thisItem->mNextItem)
+	{
+		index++;
+	}
+	return(thisItem ? index : kNoItemIndex);
+}
+
+/********************************** LoadItem **********************************/
+void XMenu::LoadItem(
+	XMenuItem*	ioItem,
+	uint16_t	inIndex)
+{
+	ioItem->SetState(XMenuItem::eOff);
+	mDataSource->LoadMenuItem(this, inIndex, ioItem);
+	if (inIndex == mSelectedIndex &&
+		ioItem->IsEnabled())
+	{
+		ioItem->SetState(XMenuItem::eOn);
+	}
+}
+
+/********************************** LoadRows **********************************/
+/*
+*	Virtual mode.  Links mVisibleRows recycled items and loads them starting
+*	with mTopItemIndex.
+*/
+void XMenu::LoadRows(void)
+{
+	XMenuItem**	link = &mMenuItems;
+	for (uint16_t row = 0; row < mVisibleRows; row++)
+	{
+		XMenuItem*	thisItem = &mRecycledItems[row];
+		LoadItem(thisItem, mTopItemIndex + row);
+		*link = thisItem;
+		link = &thisItem->mNextItem;
+	}
+	*link = nullptr;
+	mTopItem = mMenuItems;
+}
+
+/****************************** DrawVisibleItems ******************************/
+void XMenu::DrawVisibleItems(
+	bool	inRedrawBG)
+{
+	if (inRedrawBG)
+	{
+		mFont->GetXFont()->GetDisplay()->FillRect(mItemsX+mQuarterItemHeight,
+			mItemsTop, mItemFrameWidth, mItemsBottom - mItemsTop, kViewBGColor);
+	}
+	int16_t		itemY = mItemsTop;
+	for (XMenuItem*	thisItem = mTopItem; thisItem; thisItem = thisItem->mNextItem)
+	{
+		/*
+		*	In the scroll mode, stop at the first item that doesn't fit.
+		*/
+		if (mScrollable &&
+			(itemY + (thisItem->IsSeparator() ? mHalfItemHeight : mItemHeight)) > mItemsBottom)
+		{
+			break;
+		}
+		itemY = DrawItem(itemY, thisItem);
+	}
+}
+
+/****************************** DrawScrollArrows ******************************/
+/*
+*	The arrows are triangles mQuarterItemHeight tall centered within the
+*	strips above and below the items.  An arrow is drawn using the disabled
+*	color when there are no more items in its direction.
+*/
+void XMenu::DrawScrollArrows(void)
+{
+	DisplayController*	display = mFont->GetXFont()->GetDisplay();
+	uint16_t	arrowHeight = mQuarterItemHeight;
+	int16_t		centerX = mItemsX + (mQuarterItemHeight + mItemFrameWidth/2);
+	int16_t		upY = mItemsTop - mHalfItemHeight + ((mHalfItemHeight - arrowHeight)/2);
+	int16_t		downY = mItemsBottom + ((mHalfItemHeight - arrowHeight)/2) + arrowHeight - 1;
+	uint16_t	upColor = mTopItemIndex ? kItemTextColor : kDisabledItemColor;
+	uint16_t	downColor = (mTopItemIndex + mVisibleRows) < mItemCount ?
+									kItemTextColor : kDisabledItemColor;
+	for (uint16_t row = 0; row < arrowHeight; row++)
+	{
+		display->FillRect(centerX - row, upY + row, (row*2)+1, 1, upColor);
+		display->FillRect(centerX - row, downY - row, (row*2)+1, 1, downColor);
+	}
+}
+
+/********************************** ScrollBy **********************************/
+void XMenu::ScrollBy(
+	int16_t	inItems)
+{
+	if (mScrollable)
+	{
+		int32_t	topItemIndex = (int32_t)mTopItemIndex + inItems;
+		int32_t	maxTopItemIndex = (int32_t)mItemCount - mVisibleRows;
+		if (topItemIndex > maxTopItemIndex)
+		{
+			topItemIndex = maxTopItemIndex;
+		}
+		if (topItemIndex < 0)
+		{
+			topItemIndex = 0;
+		}
+		if (topItemIndex != mTopItemIndex)
+		{
+			mTopItemIndex = topItemIndex;
+			if (mDataSource)
+			{
+				LoadRows();
+			} else
+			{
+				mTopItem = GetItemAtIndex(mTopItemIndex);
+			}
+			DrawVisibleItems(true);
+			DrawScrollArrows();
+		}
+	}
+}
+
 /********************************** DrawItem **********************************/
 //void XMenu::DrawItem(
 //	XMenuItem*	inItem,
@@ -252,26 +547,26 @@ uint16_t XMenu::DrawItem(
 		{
 			if (inRedrawBG)
 			{
-				display->FillRect(mX+mQuarterItemHeight, inGlobalY, mItemFrameWidth, mItemHeight, kViewBGColor);
+				display->FillRect(mItemsX+mQuarterItemHeight, inGlobalY, mItemFrameWidth, mItemHeight, kViewBGColor);
 			}
 			xFont->SetBGTextColor(kViewBGColor);
 			xFont->SetTextColor(inItem->IsEnabled() ? kItemTextColor : kDisabledItemColor);
 		} else
 		{
 			display->SetFGColor(kSelectedItemBGColor);
-			display->DrawRoundedRect(mX+mQuarterItemHeight, inGlobalY, mItemFrameWidth, mItemHeight, mEighthItemHeight);
+			display->DrawRoundedRect(mItemsX+mQuarterItemHeight, inGlobalY, mItemFrameWidth, mItemHeight, mEighthItemHeight);
 			xFont->SetBGTextColor(kSelectedItemBGColor);
 			xFont->SetTextColor(kSelectedItemTextColor);
 		}
 
-		xFont->DrawAligned(inItem->GetString(), mX+mTextInset, inGlobalY+mTextItemInsetY, mItemWidth);
+		xFont->DrawAligned(inItem->GetString(), mItemsX+mTextInset, inGlobalY+mTextItemInsetY, mItemWidth);
 		inGlobalY+=mItemHeight;
 	/*
 	*	Else draw the separator
 	*/
 	} else
 	{
-		display->FillRect(mX+mTextInset, inGlobalY+mQuarterItemHeight, mItemWidth, 1, kDisabledItemColor);
+		display->FillRect(mItemsX+mTextInset, inGlobalY+mQuarterItemHeight, mItemWidth, 1, kDisabledItemColor);
 		inGlobalY+=mHalfItemHeight;
 	}
 	return(inGlobalY);
@@ -295,13 +590,36 @@ void XMenu::MouseDown(
 	*
 	*	Also, the item top (itemY) needs to be calculated for the same reason.
 	*/
-	int16_t		itemY = mY+mQuarterItemHeight;
+	int16_t		itemY = mItemsTop;
+	/*
+	*	If a scroll arrow was hit THEN
+	*	scroll by a page.  The selection isn't changed.
+	*/
+	mScrollTap = mScrollable &&
+		(inGlobalY < mItemsTop || inGlobalY >= mItemsBottom);
+	if (mScrollTap)
+	{
+		int16_t	page = mVisibleRows > 1 ? mVisibleRows - 1 : 1;
+		ScrollBy(inGlobalY < mItemsTop ? -page : page);
+		return;
+	}
 	bool	noSelectedItem = mSelectedItem == nullptr;
 	mSelectedItem = nullptr;
 	if (inGlobalY > itemY)
 	{
+		/*
+		*	Items scrolled out of view above the visible items aren't drawn.
+		*/
+		for (XMenuItem*	thisItem = mMenuItems; thisItem != mTopItem;
+				thisItem = thisItem->mNextItem)
+		{
+			if (thisItem->IsOn())
+			{
+				thisItem->SetState(XMenuItem::eOff);
+			}
+		}
 		int16_t		nextItemY = 0;
-		for (XMenuItem*	thisItem = mMenuItems; thisItem;
+		for (XMenuItem*	thisItem = mTopItem; thisItem;
 				thisItem = thisItem->mNextItem, itemY = nextItemY)
 		{
 			if (thisItem->IsSeparator())
@@ -317,7 +635,10 @@ void XMenu::MouseDown(
 				if (thisItem->IsOn())
 				{
 					thisItem->SetState(XMenuItem::eOff);
-					DrawItem(itemY, thisItem, true);
+					if (itemY < mItemsBottom)
+					{
+						DrawItem(itemY, thisItem, true);
+					}
 					if (mSelectedItem)
 					{
 						break;
@@ -349,6 +670,22 @@ void XMenu::MouseDown(
 			mSelectedItem = nullptr;
 		}
 	}
+	/*
+	*	In the virtual mode the selected row is recycled when it scrolls out of
+	*	view, so the selection is kept as an index and the selected item is
+	*	loaded into mVirtualItem.
+	*/
+	if (mDataSource)
+	{
+		mSelectedIndex = GetRowIndex(mSelectedItem);
+		mSelectedItem = nullptr;
+		if (mSelectedIndex != kNoItemIndex)
+		{
+			LoadItem(mVirtualItem, mSelectedIndex);
+			mVirtualItemIndex = mSelectedIndex;
+			mSelectedItem = mVirtualItem;
+		}
+	}
 }
 
 /********************************** MouseUp ***********************************/
@@ -363,12 +700,21 @@ void XMenu::MouseUp(
 	int16_t	inGlobalX,
 	int16_t	inGlobalY)
 {
-	int16_t		itemY = mY+mQuarterItemHeight;
+	int16_t		itemY = mItemsTop;
 
+	/*
+	*	If the mouse down was on a scroll arrow THEN
+	*	the menu remains open.
+	*/
+	if (mScrollTap)
+	{
+		mScrollTap = false;
+		return;
+	}
 	if (mSelectedItem &&
 		inGlobalY > itemY)
 	{
-		XMenuItem*	thisItem = mMenuItems;
+		XMenuItem*	thisItem = mTopItem;
 		for (; thisItem; thisItem = thisItem->mNextItem)
 		{
 			if (thisItem->IsSeparator())
@@ -384,7 +730,9 @@ void XMenu::MouseUp(
 			}
 			break;
 		}
-		if (thisItem != mSelectedItem &&
+		bool	hitSelectedItem = mDataSource ?
+					(GetRowIndex(thisItem) == mSelectedIndex) : (thisItem == mSelectedItem);
+		if (!hitSelectedItem &&
 			mAutoClearSelected)
 		{
 			ClearSelectedItem();
@@ -489,18 +837,24 @@ uint16_t XMenu::GetWidestItemWidth(void)
 
 /***************************** GetItemCount *****************************/
 uint16_t XMenu::GetItemCount(
-	uint16_t*	outNumSeparators) const
+	uint16_t*	outNumSeparators)
 {
 	uint16_t	itemCount = 0;
 	uint16_t	numSeparators = 0;
-	for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
+	if (mDataSource)
+	{
+		itemCount = mDataSource->GetMenuItemCount(this);
+	} else
 	{
-		itemCount++;
-		if (!thisItem->IsSeparator())
+		for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
 		{
-			continue;
+			itemCount++;
+			if (!thisItem->IsSeparator())
+			{
+				continue;
+			}
+			numSeparators++;
 		}
-		numSeparators++;
 	}
 	if (outNumSeparators)
 	{
@@ -511,21 +865,51 @@ uint16_t XMenu::GetItemCount(
 
 /**************************** FindMenuItemWithTag *****************************/
 XMenuItem* XMenu::FindMenuItemWithTag(
-	uint16_t	inTag) const
+	uint16_t	inTag)
 {
 	XMenuItem*	itemWithTag = nullptr;
-	for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
+	/*
+	*	In the virtual mode the item found is loaded into mVirtualItem.
+	*/
+	if (mDataSource)
 	{
-		if (thisItem->Tag() != inTag)
+		uint16_t	index = mDataSource->FindMenuItemIndex(this, inTag);
+		if (index < GetItemCount())
 		{
-			continue;
+			LoadItem(mVirtualItem, index);
+			mVirtualItemIndex = index;
+			itemWithTag = mVirtualItem;
+		}
+	} else
+	{
+		for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
+		{
+			if (thisItem->Tag() != inTag)
+			{
+				continue;
+			}
+			itemWithTag = thisItem;
+			break;
 		}
-		itemWithTag = thisItem;
-		break;
 	}
 	return(itemWithTag);
 }
 
+/**************************** FindMenuItemAtIndex *****************************/
+XMenuItem* XMenu::FindMenuItemAtIndex(
+	uint16_t	inIndex)
+{
+	XMenuItem*	itemAtIndex = nullptr;
+	if (mDataSource &&
+		inIndex < GetItemCount())
+	{
+		LoadItem(mVirtualItem, inIndex);
+		mVirtualItemIndex = inIndex;
+		itemAtIndex = mVirtualItem;
+	}
+	return(itemAtIndex);
+}
+
 /****************************** GetSelectedItem *******************************/
 XMenuItem* XMenu::GetSelectedItem(
 	bool	inClearSelection)
@@ -550,6 +934,14 @@ void XMenu::SelectMenuItem(
 	{
 		mSelectedItem = inMenuItem;
 		inMenuItem->SetState(XMenuItem::eOn);
+		/*
+		*	In the virtual mode inMenuItem is mVirtualItem, as returned by
+		*	FindMenuItemWithTag or GetSelectedItem.
+		*/
+		if (mDataSource)
+		{
+			mSelectedIndex = mVirtualItemIndex;
+		}
 	}
 }
 
@@ -565,5 +957,17 @@ void XMenu::ClearSelectedItem(void)
 		mSelectedItem->SetState(XMenuItem::eOff);
 		mSelectedItem = nullptr;
 	}
+	if (mDataSource &&
+		mSelectedItem == nullptr)
+	{
+		mSelectedIndex = kNoItemIndex;
+		for (XMenuItem*	thisItem = mMenuItems; thisItem; thisItem = thisItem->mNextItem)
+		{
+			if (thisItem->IsOn())
+			{
+				thisItem->SetState(XMenuItem::eOff);
+			}
+		}
+	}
 }
 
@@ -5,6 +5,11 @@
 *	XMenu is a container of menu items.  It contains a one directional, null
 *	terminated linked list.
 *
+*	In the virtual mode (see SetDataSource) the items are supplied on demand
+*	by an XMenuDataSource.  Only the visible rows exist as XMenuItems, so the
+*	RAM used and the time to draw the menu don't depend on the number of
+*	items.
+*
 *	GNU license:
 *	This program is free software: you can redistribute it and/or modify
 *	it under the terms of the GNU General Public License as published by
@@ -29,6 +34,7 @@
 #include "XFont.h"
 #include "XView.h"
 class XMenuItem;
+class XMenuDataSource;
 
 class XMenu : public XView
 {
@@ -41,8 +47,21 @@ public:
 								uint16_t				inBGColor = 0);
 	XMenuItem*				GetMenuItems(void)
 								{return(mMenuItems);}
+	/*
+	*	In the virtual mode the item returned is only valid until the next
+	*	call to FindMenuItemWithTag or the next selection change.
+	*/
 	XMenuItem*				FindMenuItemWithTag(
-								uint16_t				inTag) const;
+								uint16_t				inTag);
+	/*
+	*	Virtual mode only.  FindMenuItemAtIndex loads the item at inIndex
+	*	without searching, same lifetime as FindMenuItemWithTag.
+	*	GetSelectedIndex returns 0xFFFF when no item is selected.
+	*/
+	XMenuItem*				FindMenuItemAtIndex(
+								uint16_t				inIndex);
+	uint16_t				GetSelectedIndex(void) const
+								{return(mSelectedIndex);}
 	void					InsertMenuItem(
 								XMenuItem*				inMenuItem,
 								uint16_t				inAfterTag = 0);
@@ -57,7 +76,7 @@ public:
 								XMenuItem*				inMenuItem);
 	void					ClearSelectedItem(void);
 	uint16_t				GetItemCount(
-								uint16_t*				outNumSeparators = nullptr) const;
+								uint16_t*				outNumSeparators = nullptr);
 	void					MouseDown(
 								int16_t					inGlobalX,
 								int16_t					inGlobalY);
@@ -66,6 +85,30 @@ public:
 								int16_t					inGlobalY);
 	virtual void			Hide(void);
 	virtual void			Show(void);
+	/*
+	*	When the menu has more items than will fit on the display, the menu is
+	*	shown in the scroll mode.  In the scroll mode a tap on the scroll
+	*	arrow above or below the items scrolls by a page.  ScrollBy scrolls by
+	*	inItems, negative values scroll up.
+	*/
+	void					ScrollBy(
+								int16_t					inItems);
+	bool					IsScrollable(void) const
+								{return(mScrollable);}
+	/*
+	*	SetDataSource puts the menu in the virtual mode.  inItems[0] holds the
+	*	selected item.  inItems[1] to inItems[inItemCount-1] are recycled as the
+	*	visible rows, so at most inItemCount-1 rows are shown.  A menu with
+	*	more items than rows is shown in the scroll mode.  Separators, submenus,
+	*	InsertMenuItem and RemoveMenuItemWithTag aren't supported in the
+	*	virtual mode.
+	*/
+	void					SetDataSource(
+								XMenuDataSource*		inDataSource,
+								XMenuItem*				inItems,
+								uint16_t				inItemCount);
+	bool					IsVirtual(void) const
+								{return(mDataSource != nullptr);}
 	void					SetAutoClearSelected(
 								bool					inAutoClearSelected)
 								{mAutoClearSelected = inAutoClearSelected;}
@@ -99,9 +142,37 @@ protected:
 	uint16_t				mItemFrameWidth;
 	ESuperViewAnchor		mSuperViewAnchor;
 	bool					mAutoClearSelected;
+	bool					mScrollable;	// Not all items fit
+	bool					mScrollTap;		// MouseDown hit a scroll arrow
+	XMenuItem*				mTopItem;		// First visible item
+	uint16_t				mTopItemIndex;
+	uint16_t				mItemCount;
+	uint16_t				mVisibleRows;	// Scroll mode only
+	int16_t					mItemsX;		// Global x of the items frame
+	int16_t					mItemsTop;		// Global y of mTopItem
+	int16_t					mItemsBottom;
+	XMenuDataSource*		mDataSource;	// Virtual mode only
+	XMenuItem*				mVirtualItem;	// Selected or found item
+	XMenuItem*				mRecycledItems;	// The rows
+	uint16_t				mRecycledCount;
+	uint16_t				mVirtualItemIndex;	// Index loaded in mVirtualItem
+	uint16_t				mSelectedIndex;
 
 	int16_t					GetItemTop(
 								XMenuItem*				inItem);
+	XMenuItem*				GetItemAtIndex(
+								uint16_t				inIndex) const;
+	uint16_t				GetCenteredTopItemIndex(
+								uint16_t				inIndex) const;
+	uint16_t				GetRowIndex(
+								XMenuItem*				inRow) const;
+	void					LoadItem(
+								XMenuItem*				ioItem,
+								uint16_t				inIndex);
+	void					LoadRows(void);
+	void					DrawVisibleItems(
+								bool					inRedrawBG);
+	void					DrawScrollArrows(void);
 //	void					DrawItem(
 //								XMenuItem*				inItem,
 //								bool					inRedrawBG = false);
@@ -111,4 +182,45 @@ protected:
 								bool					inRedrawBG = false);
 
 };
+
+/*
+*	XMenuDataSource is a mixin class that supplies the items of a virtual
+*	XMenu.
+*
+*	Ex: 	class foo : public optionalSomeBase, public XMenuDataSource
+*			{
+*			public:
+*				foo(void);
+*				uint16_t GetMenuItemCount(
+*						XMenu*		inMenu);
+*				void LoadMenuItem(
+*						XMenu*		inMenu,
+*						uint16_t	inIndex,
+*						XMenuItem*	ioItem);
+*				uint16_t FindMenuItemIndex(
+*						XMenu*		inMenu,
+*						uint16_t	inTag);
+*			}
+*
+*	LoadMenuItem sets the tag and string of ioItem, and may set its state to
+*	disabled.  The string must remain valid until ioItem is loaded again.
+*	Usually the data source keeps a string buffer for each of the items
+*	passed to SetDataSource.  FindMenuItemIndex returns GetMenuItemCount()
+*	when no item has inTag.
+*/
+class XMenuDataSource
+{
+public:
+							XMenuDataSource(void){}
+	virtual uint16_t		GetMenuItemCount(
+								XMenu*					inMenu) = 0;
+	virtual void			LoadMenuItem(
+								XMenu*					inMenu,
+								uint16_t				inIndex,
+								XMenuItem*				ioItem) = 0;
+	virtual uint16_t		FindMenuItemIndex(
+								XMenu*					inMenu,
+								uint16_t				inTag) = 0;
+};
+
 #endif // XMenu_h
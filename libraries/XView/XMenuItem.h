@@ -35,7 +35,7 @@ class XMenuItem
 	friend class XMenu;
 public:
 							XMenuItem(
-								uint16_t				inTag,
+								uint16_t				inTag = 0,
 								const char*				inString = nullptr,
 								XMenuItem*				inNextItem = nullptr,
 								XMenu*					inSubmenu = nullptr);
@@ -22,7 +22,9 @@
 */
 
 #include "XNumberValueField.h"
-#include "DisplayController.h"
+#include "StripDisplayController.h"
+#include "XRootView.h"
+#include <string.h>
 
 /****************************** XNumberValueField *****************************/
 XNumberValueField::XNumberValueField(
@@ -48,6 +50,7 @@ XNumberValueField::XNumberValueField(
 	  mMinimum(inMinValue), mMaximum(inMaxValue), mValueWraps(inValueWraps),
 	  mRoundToIncrement(inRoundToIncrement)
 {
+	mDrawnString[0] = 0;
 }
 
 /********************************** DrawSelf **********************************/
@@ -63,10 +66,143 @@ void XNumberValueField::DrawSelf(void)
 		int16_t	x = 0;
 		int16_t	y = 0;
 		LocalToGlobal(x, y);
-		xFont->DrawAligned(mValueString, x, y, mWidth, mTextAlignment, true);
+		DrawString(xFont, mValueString, x, y, mWidth, mTextAlignment);
+		strcpy(mDrawnString, mValueString);
+		mDrawnTextColor = textColor;
+		mDrawnBGColor = mBGColor;
+	} else
+	{
+		mDrawnString[0] = 0;
+	}
+}
+
+/********************************* DrawString *********************************/
+void XNumberValueField::DrawString(
+	XFont*					inXFont,
+	const char*				inString,
+	int16_t					inX,
+	int16_t					inY,
+	uint16_t				inWidth,
+	XFont::ETextAlignment	inTextAlignment)
+{
+	StripDisplayController*	strip = XRootView::GetInstance()->GetStrip();
+	/*
+	*	If there's a strip compositor and the field fits in a single strip THEN
+	*	draw the string off-screen and flush it as one block.  This
+	*	eliminates the flicker caused by erasing before drawing.  A field
+	*	taller than one strip would have its string decoded and drawn again
+	*	for every strip, so it's drawn directly instead.  A background the
+	*	display can packed fill is cheaper to erase directly than to send
+	*	as composed pixels, so the strip isn't used for it either.
+	*/
+	if (strip &&
+		!inXFont->GetDisplay()->HasPackedFill(mBGColor) &&
+		strip->FitsOneStrip(inWidth, inXFont->FontRows()) &&
+		strip->BeginStrips(inXFont->GetDisplay(), inX, inY, inWidth,
+							inXFont->FontRows(), mBGColor))
+	{
+		DisplayController*	display = inXFont->SwapDisplay(strip);
+		inXFont->DrawAligned(inString, inX, inY, inWidth, inTextAlignment, true);
+		strip->NextStrip();
+		inXFont->SwapDisplay(display);
+	} else
+	{
+		inXFont->DrawAligned(inString, inX, inY, inWidth, inTextAlignment, true);
 	}
 }
 
+/******************************** DrawChanges *********************************/
+/*
+*	Draws only the runs of characters in mValueString that differ from the
+*	last drawn string.  This is only possible when each changed character is
+*	the same width as the character it replaces (e.g. the digits of a font
+*	with fixed width digits) so that none of the other characters move.
+*	Returns false if the whole field needs to be drawn.
+*/
+bool XNumberValueField::DrawChanges(void)
+{
+	XFont*	xFont = mDrawnString[0] && mVisible ? MakeFontCurrent() : nullptr;
+	if (!xFont)
+	{
+		return(false);
+	}
+	uint16_t	textColor = mEnabled ? mFGColor :
+					DisplayController::Calc565Color(mFGColor, 0, 184);
+	if (textColor != mDrawnTextColor ||
+		mBGColor != mDrawnBGColor)
+	{
+		return(false);
+	}
+	/*
+	*	Measure the drawn string, saving the position of each character
+	*	relative to the start of the string.  Multibyte UTF-8 characters
+	*	aren't supported.
+	*/
+	uint16_t	charX[sizeof(mValueString)];
+	uint16_t	width = 0;
+	uint8_t		i = 0;
+	for (; mValueString[i]; i++)
+	{
+		uint8_t	thisChar = mValueString[i];
+		uint8_t	drawnChar = mDrawnString[i];
+		if (thisChar < ' ' || thisChar >= 0x80 ||
+			drawnChar < ' ' || drawnChar >= 0x80 ||
+			!xFont->LoadGlyph(drawnChar))
+		{
+			return(false);
+		}
+		uint8_t	advanceX = xFont->Glyph().advanceX;
+		if (thisChar != drawnChar &&
+			(!xFont->LoadGlyph(thisChar) ||
+				xFont->Glyph().advanceX != advanceX))
+		{
+			return(false);
+		}
+		charX[i] = width;
+		width += advanceX;
+	}
+	/*
+	*	If the length changed OR
+	*	the string doesn't fit (it's drawn truncated) THEN
+	*	the whole field needs to be drawn.
+	*/
+	if (mDrawnString[i] ||
+		width > mWidth)
+	{
+		return(false);
+	}
+	charX[i] = width;
+	int16_t	x = 0;
+	int16_t	y = 0;
+	LocalToGlobal(x, y);
+	if (mTextAlignment == XFont::eAlignRight)
+	{
+		x += (mWidth - width);
+	} else if (mTextAlignment == XFont::eAlignCenter)
+	{
+		x += ((mWidth - width)/2);
+	}
+	xFont->SetTextColor(textColor);
+	xFont->SetBGTextColor(mBGColor);
+	for (i = 0; mValueString[i];)
+	{
+		if (mValueString[i] == mDrawnString[i])
+		{
+			i++;
+			continue;
+		}
+		uint8_t	runStart = i;
+		for (; mValueString[i] && mValueString[i] != mDrawnString[i]; i++){}
+		char	run[sizeof(mValueString)];
+		memcpy(run, &mValueString[runStart], i - runStart);
+		run[i - runStart] = 0;
+		DrawString(xFont, run, x + charX[runStart], y,
+					charX[i] - charX[runStart], XFont::eAlignLeft);
+	}
+	strcpy(mDrawnString, mValueString);
+	return(true);
+}
+
 /******************************** ValueIsValid ********************************/
 bool XNumberValueField::ValueIsValid(
 	int32_t	inValue)
@@ -116,6 +252,23 @@ bool XNumberValueField::DecrementValue(void)
 	return(SetValue(newValue, true));
 }
 
+/******************************** ValueChanged ********************************/
+/*
+*	When possible only the characters that changed are drawn.  This allows
+*	position readouts to be updated often without redrawing the field.
+*/
+void XNumberValueField::ValueChanged(
+	bool	inUpdate)
+{
+	UpdateStringForValue();
+	
+	if (inUpdate &&
+		!DrawChanges())
+	{
+		DrawSelf();
+	}
+}
+
 /**************************** UpdateStringForValue ****************************/
 void XNumberValueField::UpdateStringForValue(void)
 {
@@ -143,7 +296,8 @@ void XNumberValueField::OverrideValueString(
 	mValue = 0x6423FFF0;	// Set some random number so that setting any value
 							// will cause the displayed value to update
 							// mValueString.
-	if (inUpdate)
+	if (inUpdate &&
+		!DrawChanges())
 	{
 		DrawSelf();
 	}
@@ -71,8 +71,13 @@ public:
 								{mRoundToIncrement = inRoundToIncrement;}
 	virtual bool			IncrementValue(void);
 	virtual bool			DecrementValue(void);
+	virtual void			ValueChanged(
+								bool					inUpdate = true);
 protected:
 	char				mValueString[15];
+	char				mDrawnString[15];	// As last drawn, empty if unknown
+	uint16_t			mDrawnTextColor;
+	uint16_t			mDrawnBGColor;
 	ValueFormatterPtr	mValueFormatter;
 	uint32_t			mIncrement;
 	int32_t				mMinimum;
@@ -83,5 +88,13 @@ protected:
 	virtual bool			ValueIsValid(
 								int32_t					inValue);
 	virtual void			UpdateStringForValue(void);
+	bool					DrawChanges(void);
+	void					DrawString(
+								XFont*					inXFont,
+								const char*				inString,
+								int16_t					inX,
+								int16_t					inY,
+								uint16_t				inWidth,
+								XFont::ETextAlignment	inTextAlignment);
 };
 #endif // XNumberValueField_h
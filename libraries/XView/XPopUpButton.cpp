@@ -236,6 +236,13 @@ void XPopUpButton::SelectMenuItem(
 	SelectMenuItem(mMenu->FindMenuItemWithTag(inTag));
 }
 
+/*************************** SelectMenuItemAtIndex ****************************/
+void XPopUpButton::SelectMenuItemAtIndex(
+	uint16_t	inIndex)
+{
+	SelectMenuItem(mMenu->FindMenuItemAtIndex(inIndex));
+}
+
 /******************************* SelectMenuItem *******************************/
 void XPopUpButton::SelectMenuItem(
 	XMenuItem*	inMenuItem)
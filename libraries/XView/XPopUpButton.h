@@ -55,6 +55,9 @@ public:
 								int16_t					inGlobalY);
 	void					SelectMenuItem(
 								uint16_t				inTag);
+	// Virtual menus only, see XMenu::FindMenuItemAtIndex
+	void					SelectMenuItemAtIndex(
+								uint16_t				inIndex);
 protected:
 	EPopUpSize	mPopUpSize;
 	int16_t		mOffsetForShowMenu;
@@ -34,7 +34,7 @@ XRootView::XRootView(
 	XViewChangedDelegate*	inViewChangedDelegate,
 	DisplayController*		inDisplay)
 	: XView(0, 0, 0, 0, 0, nullptr, inSubViews),
-	  mDisplay(inDisplay),
+	  mDisplay(inDisplay), mStrip(nullptr),
 	  mViewChangedDelegate(inViewChangedDelegate),
 	  mModalView(nullptr)
 {
@@ -27,6 +27,7 @@
 #include "XView.h"
 
 class DisplayController;
+class StripDisplayController;
 
 class XRootView : public XView
 {
@@ -49,6 +50,17 @@ public:
 								{mDisplay = inDisplay;}
 	DisplayController*		GetDisplay(void) const
 								{return(mDisplay);}
+							/*
+							*	The optional strip compositor is used by
+							*	views that redraw frequently to avoid flicker
+							*	and to reduce the number of address windows
+							*	sent to the display.  See XNumberValueField.
+							*/
+	void					SetStrip(
+								StripDisplayController*	inStrip)
+								{mStrip = inStrip;}
+	StripDisplayController*	GetStrip(void) const
+								{return(mStrip);}
 	void					SetViewChangedDelegate(
 								XViewChangedDelegate*	inViewChangedDelegate)
 								{mViewChangedDelegate = inViewChangedDelegate;}
@@ -68,6 +80,7 @@ public:
 								{return(sInstance);}
 protected:
 	DisplayController*		mDisplay;
+	StripDisplayController*	mStrip;
 	XViewChangedDelegate*	mViewChangedDelegate;
 	XView*					mModalView;
 	static XRootView*		sInstance;
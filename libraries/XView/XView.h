@@ -62,6 +62,10 @@ public:
 	virtual void			MouseUp(
 								int16_t					inGlobalX,
 								int16_t					inGlobalY){}
+	// Called between MouseDown and MouseUp as the touch moves.
+	virtual void			MouseDragged(
+								int16_t					inGlobalX,
+								int16_t					inGlobalY){}
 	virtual XView*			HitTest(
 								int16_t					inX,
 								int16_t					inY);